@@ -0,0 +1,14 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class ArcaneBoardCore : ModuleRules
+{
+	public ArcaneBoardCore(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		// 엔진 비의존 코어, 모듈 등록에만 Core 사용
+		PublicDependencyModuleNames.AddRange(new string[] { "Core" });
+	}
+}
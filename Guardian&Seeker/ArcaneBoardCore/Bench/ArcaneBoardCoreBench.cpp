@@ -0,0 +1,269 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ArcaneBatchEvaluator.h"
+#include "ArcaneBoardCoreTypes.h"
+#include "ArcaneBoardLayout.h"
+#include "ArcaneBoardState.h"
+#include "ArcaneRuneCatalog.h"
+#include "ArcaneSynergy.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace ArcaneCore;
+
+/**
+ * 코어 벤치마크
+ * - 고정 시드로 임의 배치/제거/평가를 반복해 연산별 평균 시간 출력
+ * - 배치 평가는 단일 스레드와 전체 스레드 처리량 비교
+ * - 사용법: ArcaneBoardCoreBench [보드 크기] [반복 횟수] [배치 보드 수]
+ *          ArcaneBoardCoreBench scale [반복 횟수] (9x9 ~ 64x64 보드 크기별 비교)
+ */
+namespace
+{
+	using FClock = std::chrono::steady_clock;
+
+	struct FBenchTimer
+	{
+		const char* Name;
+		double TotalNs = 0.0;
+		int64_t Calls = 0;
+
+		void Report() const
+		{
+			std::printf("%-20s %10lld calls %10.1f ns/call\n", Name, static_cast<long long>(Calls), GetAverage());
+		}
+
+		double GetAverage() const { return Calls > 0 ? TotalNs / Calls : 0.0; }
+	};
+
+	template <typename FuncType>
+	auto Measure(FBenchTimer& Timer, FuncType&& Func)
+	{
+		const FClock::time_point Start = FClock::now();
+		auto Result = Func();
+		Timer.TotalNs += std::chrono::duration<double, std::nano>(FClock::now() - Start).count();
+		++Timer.Calls;
+		return Result;
+	}
+
+	void BuildCatalog(FRuneCatalog& Catalog, std::mt19937& Random)
+	{
+		static const std::vector<std::vector<FCellPos>> Shapes = {
+			{ {0, 0} },
+			{ {0, 0}, {0, 1} },
+			{ {0, 0}, {1, 0}, {1, 1} },
+			{ {0, 0}, {0, 1}, {0, 2} },
+			{ {0, 0}, {0, 1}, {1, 0}, {1, 1} },
+			{ {0, 0}, {1, 0}, {2, 0}, {2, 1} },
+			{ {0, 0}, {0, 1}, {0, 2}, {1, 1} }
+		};
+
+		std::uniform_int_distribution<int32_t> StatDist(0, StatIndex::Count - 1);
+		std::uniform_real_distribution<float> ValueDist(1.0f, 10.0f);
+
+		for (int32_t Id = 1; Id < MaxRuneCount; ++Id)
+		{
+			FRuneDef Def;
+			Def.Id = static_cast<RuneId>(Id);
+			Def.StatIndex = StatDist(Random);
+			Def.StatValue = ValueDist(Random);
+			Def.Shape = Shapes[Id % Shapes.size()];
+			Catalog.AddRune(Def);
+		}
+	}
+
+	std::vector<FSynergyRuleDef> BuildRules(std::mt19937& Random)
+	{
+		std::vector<FSynergyRuleDef> RuleDefs;
+		std::uniform_int_distribution<int32_t> StatDist(0, StatIndex::Count - 1);
+		std::uniform_int_distribution<int32_t> RuneDist(1, MaxRuneCount - 1);
+
+		for (int32_t i = 0; i < 32; ++i)
+		{
+			FSynergyRuleDef Def;
+			Def.Type = (i % 2 == 0) ? ESynergyType::Adjacency : ESynergyType::Set;
+			Def.FirstStat = StatDist(Random);
+			Def.SecondStat = StatDist(Random);
+			Def.RequiredCount = 1 + i % 3;
+			Def.RequiredRunes = { static_cast<RuneId>(RuneDist(Random)), static_cast<RuneId>(RuneDist(Random)) };
+			Def.Bonus[StatDist(Random)] = 1.0f;
+			RuleDefs.push_back(Def);
+		}
+		return RuleDefs;
+	}
+
+	// 정사각 보드, 가운데가 특수 셀
+	void BuildSquareLayout(int32_t BoardSize, FBoardLayout& OutLayout)
+	{
+		std::vector<FLayoutCellDef> Cells;
+		for (int32_t X = 0; X < BoardSize; ++X)
+		{
+			for (int32_t Y = 0; Y < BoardSize; ++Y)
+			{
+				FLayoutCellDef Cell;
+				Cell.Pos = FCellPos(X, Y);
+				Cell.bSpecial = (X == BoardSize / 2 && Y == BoardSize / 2);
+				Cells.push_back(Cell);
+			}
+		}
+		OutLayout.Build(Cells);
+	}
+
+	// 보드 크기 하나에 대해 임의 배치/제거/평가 반복, 연산별 타이머 반환
+	struct FBoardBenchResult
+	{
+		FBenchTimer Check{ "CheckPlacement" };
+		FBenchTimer Place{ "Place" };
+		FBenchTimer Remove{ "Remove" };
+		FBenchTimer Evaluate{ "Evaluate" };
+		FBenchTimer AnchorMap{ "BuildAnchorMap" };
+		double TotalMs = 0.0;
+		size_t NumPlaced = 0;
+		float Checksum = 0.0f;
+	};
+
+	FBoardBenchResult RunBoardBench(const FRuneCatalog& Catalog, const FSynergyRuleSet& Rules, int32_t BoardSize, int32_t Iterations, std::mt19937& Random)
+	{
+		FBoardLayout Layout;
+		BuildSquareLayout(BoardSize, Layout);
+
+		FBoardState Board;
+		Board.Reset(&Layout, &Catalog, &Rules);
+
+		std::uniform_int_distribution<int32_t> RuneDist(1, MaxRuneCount - 1);
+		std::uniform_int_distribution<int32_t> PosDist(0, BoardSize - 1);
+		std::uniform_int_distribution<int32_t> OrientDist(0, Orientation::Count - 1);
+
+		FBoardBenchResult Result;
+		FPlacementAnchorMap Anchors;
+		std::vector<RuneId> Removed;
+
+		const FClock::time_point Start = FClock::now();
+		for (int32_t i = 0; i < Iterations; ++i)
+		{
+			FPlacement Placement;
+			Placement.Id = static_cast<RuneId>(RuneDist(Random));
+			Placement.Pos = FCellPos(PosDist(Random), PosDist(Random));
+			Placement.Orientation = static_cast<uint8_t>(OrientDist(Random));
+
+			// 이미 배치된 룬이면 제거만
+			if (Board.FindPlacement(Placement.Id))
+			{
+				Measure(Result.Remove, [&]() { return Board.Remove(Placement.Id); });
+			}
+			else
+			{
+				const EPlacementResult CheckResult = Measure(Result.Check, [&]() { return Board.CheckPlacement(Placement.Id, Placement.Pos, Placement.Orientation); });
+				if (CheckResult != EPlacementResult::OutOfBounds)
+				{
+					Measure(Result.Place, [&]() { return Board.Place(Placement, &Removed); });
+				}
+			}
+
+			// 룬을 집을 때마다 한 번이므로 가끔만 측정
+			if (i % 16 == 0)
+			{
+				Measure(Result.AnchorMap, [&]() { return Board.BuildAnchorMap(Placement.Id, Placement.Orientation, Anchors); });
+			}
+
+			const FBoardStats Stats = Measure(Result.Evaluate, [&]() { return Board.Evaluate(); });
+			Result.Checksum += Stats.RuneStats[StatIndex::HP] + Stats.BonusStats[StatIndex::ATK];
+		}
+		Result.TotalMs = std::chrono::duration<double, std::milli>(FClock::now() - Start).count();
+		Result.NumPlaced = Board.GetPlacements().size();
+		return Result;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::mt19937 Random(0xA2CA7E);
+
+	FRuneCatalog Catalog;
+	BuildCatalog(Catalog, Random);
+
+	FSynergyRuleSet Rules;
+	Rules.Compile(BuildRules(Random), Catalog);
+
+	// scale: 지금 레이아웃 크기부터 64x64까지 연산별 비용 비교
+	if (argc > 1 && std::strcmp(argv[1], "scale") == 0)
+	{
+		const int32_t Iterations = argc > 2 ? std::atoi(argv[2]) : 100000;
+		std::printf("%-7s %8s %10s %10s %10s %10s %10s\n", "board", "placed", "check", "place", "remove", "evaluate", "anchormap");
+		for (int32_t BoardSize : { 9, 16, 24, 32, 48, 64 })
+		{
+			const FBoardBenchResult Result = RunBoardBench(Catalog, Rules, BoardSize, Iterations, Random);
+			char SizeLabel[16];
+			std::snprintf(SizeLabel, sizeof(SizeLabel), "%dx%d", BoardSize, BoardSize);
+			std::printf("%-7s %8zu %10.1f %10.1f %10.1f %10.1f %10.1f\n", SizeLabel, Result.NumPlaced,
+				Result.Check.GetAverage(), Result.Place.GetAverage(), Result.Remove.GetAverage(),
+				Result.Evaluate.GetAverage(), Result.AnchorMap.GetAverage());
+		}
+		std::printf("(ns/call)\n");
+		return 0;
+	}
+
+	const int32_t BoardSize = argc > 1 ? std::atoi(argv[1]) : 9;
+	const int32_t Iterations = argc > 2 ? std::atoi(argv[2]) : 200000;
+	const int32_t BatchBoards = argc > 3 ? std::atoi(argv[3]) : 200000;
+
+	const FBoardBenchResult Result = RunBoardBench(Catalog, Rules, BoardSize, Iterations, Random);
+	std::printf("board %dx%d, %d iterations, %.1f ms total\n", BoardSize, BoardSize, Iterations, Result.TotalMs);
+	Result.Check.Report();
+	Result.Place.Report();
+	Result.Remove.Report();
+	Result.Evaluate.Report();
+	Result.AnchorMap.Report();
+	std::printf("placed %zu, checksum %.3f\n", Result.NumPlaced, Result.Checksum);
+
+	std::uniform_int_distribution<int32_t> RuneDist(1, MaxRuneCount - 1);
+	std::uniform_int_distribution<int32_t> PosDist(0, BoardSize - 1);
+	std::uniform_int_distribution<int32_t> OrientDist(0, Orientation::Count - 1);
+
+	FBoardLayout Layout;
+	BuildSquareLayout(BoardSize, Layout);
+
+	// 배치 평가: 보드마다 6~12개 임의 배치
+	FBoardBatch Batch;
+	Batch.Reserve(BatchBoards, static_cast<size_t>(BatchBoards) * 12);
+	std::uniform_int_distribution<int32_t> CountDist(6, 12);
+	std::vector<FPlacement> Candidate;
+	for (int32_t i = 0; i < BatchBoards; ++i)
+	{
+		Candidate.resize(CountDist(Random));
+		for (FPlacement& Placement : Candidate)
+		{
+			Placement.Id = static_cast<RuneId>(RuneDist(Random));
+			Placement.Pos = FCellPos(PosDist(Random), PosDist(Random));
+			Placement.Orientation = static_cast<uint8_t>(OrientDist(Random));
+		}
+		Batch.AddBoard(0, Candidate.data(), static_cast<int32_t>(Candidate.size()));
+	}
+
+	const FBatchEvaluator Evaluator(Catalog, Rules, { &Layout });
+	std::vector<FBoardBatchResult> Results;
+
+	const int32_t MaxThreads = static_cast<int32_t>(std::max(1u, std::thread::hardware_concurrency()));
+	for (int32_t NumThreads : { 1, MaxThreads })
+	{
+		const FClock::time_point BatchStart = FClock::now();
+		Evaluator.EvaluateParallel(Batch, Results, NumThreads);
+		const double BatchMs = std::chrono::duration<double, std::milli>(FClock::now() - BatchStart).count();
+
+		int32_t NumValid = 0;
+		for (const FBoardBatchResult& Result : Results)
+		{
+			NumValid += Result.bValid ? 1 : 0;
+		}
+		std::printf("batch %d boards, %2d threads: %8.1f ms, %10.0f boards/s, %d valid\n",
+			BatchBoards, NumThreads, BatchMs, BatchBoards / (BatchMs / 1000.0), NumValid);
+	}
+	return 0;
+}
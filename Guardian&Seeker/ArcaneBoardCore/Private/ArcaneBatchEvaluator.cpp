@@ -0,0 +1,135 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ArcaneBatchEvaluator.h"
+#include "ArcaneBoardLayout.h"
+#include "ArcaneBoardState.h"
+#include "ArcaneRuneCatalog.h"
+#include "ArcaneSynergy.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace ArcaneCore
+{
+	namespace
+	{
+		// 스레드가 한 번에 가져가는 보드 수
+		constexpr int32_t BatchChunkSize = 256;
+	}
+
+	void FBoardBatch::Reserve(size_t NumBoards, size_t NumPlacements)
+	{
+		Boards.reserve(NumBoards);
+		Placements.reserve(NumPlacements);
+	}
+
+	void FBoardBatch::Clear()
+	{
+		Boards.clear();
+		Placements.clear();
+	}
+
+	int32_t FBoardBatch::AddBoard(uint8_t LayoutIndex, const FPlacement* InPlacements, int32_t InNumPlacements)
+	{
+		FBoard Board;
+		Board.FirstPlacement = static_cast<uint32_t>(Placements.size());
+		Board.NumPlacements = static_cast<uint16_t>(std::max(0, InNumPlacements));
+		Board.LayoutIndex = LayoutIndex;
+
+		Placements.insert(Placements.end(), InPlacements, InPlacements + Board.NumPlacements);
+		Boards.push_back(Board);
+		return static_cast<int32_t>(Boards.size()) - 1;
+	}
+
+	FBatchEvaluator::FBatchEvaluator(const FRuneCatalog& InCatalog, const FSynergyRuleSet& InRules, const std::vector<const FBoardLayout*>& InLayouts)
+		: Catalog(InCatalog)
+		, Rules(InRules)
+		, Layouts(InLayouts)
+	{
+	}
+
+	void FBatchEvaluator::EvaluateRange(const FBoardBatch& Batch, int32_t BeginIndex, int32_t EndIndex, FBoardBatchResult* OutResults) const
+	{
+		FBoardState State;
+		int32_t CurrLayoutIndex = -1;
+
+		for (int32_t BoardIndex = BeginIndex; BoardIndex < EndIndex; ++BoardIndex)
+		{
+			const FBoardBatch::FBoard& Board = Batch.Boards[BoardIndex];
+			FBoardBatchResult& Result = OutResults[BoardIndex];
+			Result = FBoardBatchResult();
+
+			const FBoardLayout* Layout = Board.LayoutIndex < Layouts.size() ? Layouts[Board.LayoutIndex] : nullptr;
+			if (!Layout)
+			{
+				Result.bValid = false;
+				continue;
+			}
+
+			// 같은 레이아웃이 이어지면 셀 배열을 다시 잡지 않고 초기화만
+			if (CurrLayoutIndex != Board.LayoutIndex)
+			{
+				State.Reset(Layout, &Catalog, &Rules);
+				CurrLayoutIndex = Board.LayoutIndex;
+			}
+			else
+			{
+				State.Clear();
+			}
+
+			const FPlacement* Placements = Batch.Placements.data() + Board.FirstPlacement;
+			for (uint16_t i = 0; i < Board.NumPlacements; ++i)
+			{
+				const FPlacement& Placement = Placements[i];
+				if (State.CheckPlacement(Placement.Id, Placement.Pos, Placement.Orientation) != EPlacementResult::Valid)
+				{
+					Result.bValid = false;
+				}
+				State.AddPlacementUnchecked(Placement);
+			}
+
+			Result.Stats = State.Evaluate();
+			Result.ConnectedRuneCount = State.GetConnectedRuneCount();
+		}
+	}
+
+	void FBatchEvaluator::EvaluateParallel(const FBoardBatch& Batch, std::vector<FBoardBatchResult>& OutResults, int32_t NumThreads) const
+	{
+		const int32_t NumBoards = Batch.Num();
+		OutResults.resize(NumBoards);
+		if (NumBoards == 0)
+		{
+			return;
+		}
+
+		const int32_t NumChunks = (NumBoards + BatchChunkSize - 1) / BatchChunkSize;
+		if (NumThreads <= 0)
+		{
+			NumThreads = static_cast<int32_t>(std::max(1u, std::thread::hardware_concurrency()));
+		}
+		NumThreads = std::min(NumThreads, NumChunks);
+
+		std::atomic<int32_t> NextChunk(0);
+		auto Worker = [&]()
+		{
+			for (int32_t Chunk = NextChunk++; Chunk < NumChunks; Chunk = NextChunk++)
+			{
+				const int32_t BeginIndex = Chunk * BatchChunkSize;
+				EvaluateRange(Batch, BeginIndex, std::min(BeginIndex + BatchChunkSize, NumBoards), OutResults.data());
+			}
+		};
+
+		std::vector<std::thread> Threads;
+		Threads.reserve(NumThreads - 1);
+		for (int32_t i = 1; i < NumThreads; ++i)
+		{
+			Threads.emplace_back(Worker);
+		}
+		Worker();
+
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+	}
+}
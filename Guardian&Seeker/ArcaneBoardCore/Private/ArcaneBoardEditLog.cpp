@@ -0,0 +1,172 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ArcaneBoardEditLog.h"
+#include <algorithm>
+#include <cstring>
+
+namespace ArcaneCore
+{
+	namespace
+	{
+		struct FEditLogFileHeader
+		{
+			uint32_t Magic;
+			uint16_t Version;
+			uint16_t RecordSize;
+			uint32_t NumRecords;
+			uint32_t Reserved;
+		};
+		static_assert(sizeof(FEditLogFileHeader) == 16, "FEditLogFileHeader는 16바이트");
+
+		bool HasRuneBlock(EBoardEditOp Op)
+		{
+			return Op == EBoardEditOp::Snapshot || Op == EBoardEditOp::Load;
+		}
+	}
+
+	void FBoardEditLog::Init(int32_t Capacity)
+	{
+		Records.clear();
+		if (Capacity > 0)
+		{
+			Records.resize(std::max(Capacity, MinCapacity));
+		}
+		Records.shrink_to_fit();
+		Clear();
+	}
+
+	void FBoardEditLog::Clear()
+	{
+		Head = 0;
+		NumRecords = 0;
+		SnapshotRecords = 0;
+		RecordsSinceSnapshot = 0;
+		bInSnapshotGroup = false;
+	}
+
+	void FBoardEditLog::Add(const FBoardEditRecord& Record)
+	{
+		if (Records.empty())
+		{
+			return;
+		}
+
+		Records[Head] = Record;
+		Head = Head + 1 < GetCapacity() ? Head + 1 : 0;
+		NumRecords = std::min(NumRecords + 1, GetCapacity());
+
+		// 첫 블록부터 다른 편집이 오기 전까지의 Snapshot/Rune 레코드가 한 묶음
+		if (Record.Op == EBoardEditOp::Snapshot && Record.X == 0)
+		{
+			SnapshotRecords = 0;
+			RecordsSinceSnapshot = 0;
+			bInSnapshotGroup = true;
+		}
+		else if (Record.Op != EBoardEditOp::Snapshot && Record.Op != EBoardEditOp::Rune)
+		{
+			bInSnapshotGroup = false;
+		}
+
+		if (bInSnapshotGroup)
+		{
+			++SnapshotRecords;
+		}
+		else
+		{
+			++RecordsSinceSnapshot;
+		}
+	}
+
+	void FBoardEditLog::GetReplayRecords(std::vector<FBoardEditRecord>& OutRecords) const
+	{
+		OutRecords.clear();
+
+		// 덮어써진 앞부분은 블록 꼬리나 기준 상태가 없는 편집이므로 첫 묶음 시작까지 버림
+		const int32_t Capacity = GetCapacity();
+		const int32_t Tail = NumRecords < Capacity ? 0 : Head;
+		int32_t First = 0;
+		while (First < NumRecords)
+		{
+			const FBoardEditRecord& Record = Records[(Tail + First) % Capacity];
+			if (Record.Op == EBoardEditOp::Snapshot && Record.X == 0)
+			{
+				break;
+			}
+			++First;
+		}
+
+		OutRecords.reserve(NumRecords - First);
+		for (int32_t i = First; i < NumRecords; ++i)
+		{
+			OutRecords.push_back(Records[(Tail + i) % Capacity]);
+		}
+	}
+
+	void FBoardEditLog::Serialize(std::vector<uint8_t>& OutBytes) const
+	{
+		std::vector<FBoardEditRecord> ReplayRecords;
+		GetReplayRecords(ReplayRecords);
+
+		FEditLogFileHeader Header;
+		Header.Magic = FileMagic;
+		Header.Version = FileVersion;
+		Header.RecordSize = sizeof(FBoardEditRecord);
+		Header.NumRecords = static_cast<uint32_t>(ReplayRecords.size());
+		Header.Reserved = 0;
+
+		const size_t RecordBytes = ReplayRecords.size() * sizeof(FBoardEditRecord);
+		OutBytes.resize(sizeof(Header) + RecordBytes);
+		std::memcpy(OutBytes.data(), &Header, sizeof(Header));
+		if (RecordBytes > 0)
+		{
+			std::memcpy(OutBytes.data() + sizeof(Header), ReplayRecords.data(), RecordBytes);
+		}
+	}
+
+	bool FBoardEditLog::Deserialize(const uint8_t* Data, size_t Size, std::vector<FBoardEditRecord>& OutRecords)
+	{
+		OutRecords.clear();
+
+		FEditLogFileHeader Header;
+		if (!Data || Size < sizeof(Header))
+		{
+			return false;
+		}
+		std::memcpy(&Header, Data, sizeof(Header));
+
+		if (Header.Magic != FileMagic || Header.Version != FileVersion || Header.RecordSize != sizeof(FBoardEditRecord) ||
+			Size - sizeof(Header) != static_cast<size_t>(Header.NumRecords) * sizeof(FBoardEditRecord))
+		{
+			return false;
+		}
+
+		OutRecords.resize(Header.NumRecords);
+		if (Header.NumRecords > 0)
+		{
+			std::memcpy(OutRecords.data(), Data + sizeof(Header), Header.NumRecords * sizeof(FBoardEditRecord));
+		}
+
+		// 알 수 없는 종류나 블록 길이가 맞지 않는 파일은 거부
+		for (size_t i = 0; i < OutRecords.size(); ++i)
+		{
+			const FBoardEditRecord& Record = OutRecords[i];
+			bool bValid = Record.Op < EBoardEditOp::Count && Record.Op != EBoardEditOp::Rune;
+			if (bValid && HasRuneBlock(Record.Op))
+			{
+				bValid = i + Record.Count < OutRecords.size();
+				for (size_t RuneIndex = i + 1; bValid && RuneIndex <= i + Record.Count; ++RuneIndex)
+				{
+					bValid = OutRecords[RuneIndex].Op == EBoardEditOp::Rune;
+				}
+				i += Record.Count;
+			}
+
+			if (!bValid)
+			{
+				OutRecords.clear();
+				return false;
+			}
+		}
+		return true;
+	}
+}
@@ -0,0 +1,221 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ArcaneBoardLayout.h"
+#include "ArcaneRuneCatalog.h"
+#include <algorithm>
+#include <climits>
+
+namespace ArcaneCore
+{
+	void FBoardLayout::Reset()
+	{
+		Origin = FCellPos();
+		Width = 0;
+		Height = 0;
+		NumValidCells = 0;
+		CellFlags.clear();
+		InitialCells.clear();
+		SourceCells.clear();
+		Neighbors.clear();
+		ValidRowMasks.clear();
+		RuneAnchorRows.clear();
+	}
+
+	int32_t FBoardLayout::Build(const std::vector<FLayoutCellDef>& Cells)
+	{
+		Reset();
+
+		if (Cells.empty())
+		{
+			return 0;
+		}
+
+		FCellPos MinPos(INT_MAX, INT_MAX);
+		FCellPos MaxPos(INT_MIN, INT_MIN);
+		for (const FLayoutCellDef& Cell : Cells)
+		{
+			MinPos.X = std::min(MinPos.X, Cell.Pos.X);
+			MinPos.Y = std::min(MinPos.Y, Cell.Pos.Y);
+			MaxPos.X = std::max(MaxPos.X, Cell.Pos.X);
+			MaxPos.Y = std::max(MaxPos.Y, Cell.Pos.Y);
+		}
+
+		Origin = MinPos;
+		Height = MaxPos.X - MinPos.X + 1;
+		Width = MaxPos.Y - MinPos.Y + 1;
+		CellFlags.assign(static_cast<size_t>(Width) * Height, 0);
+
+		int32_t NumDroppedSources = 0;
+
+		for (const FLayoutCellDef& Cell : Cells)
+		{
+			const int32_t Index = (Cell.Pos.X - Origin.X) * Width + (Cell.Pos.Y - Origin.Y);
+			if (!(CellFlags[Index] & LF_Valid))
+			{
+				++NumValidCells;
+			}
+			CellFlags[Index] |= LF_Valid;
+
+			// 같은 셀이 중복 정의되면 배율만 갱신, 제한을 넘는 특수 셀은 일반 셀로 두고 개수만 셈
+			if (Cell.bSpecial)
+			{
+				auto Existing = std::find_if(SourceCells.begin(), SourceCells.end(),
+					[Index](const FSourceCell& Source) { return Source.Index == Index; });
+				if (Existing != SourceCells.end())
+				{
+					Existing->Weight = Cell.SourceWeight;
+				}
+				else if (static_cast<int32_t>(SourceCells.size()) < MaxSourceCells)
+				{
+					CellFlags[Index] |= LF_Special;
+					SourceCells.push_back({ Index, Cell.SourceWeight });
+				}
+				else
+				{
+					++NumDroppedSources;
+				}
+			}
+
+			if (Cell.bOccupied)
+			{
+				InitialCells.push_back({ Index, Cell.Rune });
+			}
+		}
+
+		BuildDerivedTables();
+		return NumDroppedSources;
+	}
+
+	void FBoardLayout::BuildDerivedTables()
+	{
+		const int32_t NumCells = GetNumCells();
+		Neighbors.assign(static_cast<size_t>(NumCells) * 4, -1);
+		for (int32_t Index = 0; Index < NumCells; ++Index)
+		{
+			if (!IsValidCell(Index))
+			{
+				continue;
+			}
+
+			for (int32_t Dir = 0; Dir < 4; ++Dir)
+			{
+				Neighbors[Index * 4 + Dir] = ToIndex(ToPos(Index) + NeighborDirections[Dir]);
+			}
+		}
+
+		if (Width > 64)
+		{
+			return;
+		}
+
+		ValidRowMasks.assign(Height, 0);
+		for (int32_t Index = 0; Index < NumCells; ++Index)
+		{
+			if (IsValidCell(Index))
+			{
+				ValidRowMasks[Index / Width] |= 1ull << (Index % Width);
+			}
+		}
+	}
+
+	bool FBoardLayout::InitFromCooked(const FCookedData& Data)
+	{
+		Reset();
+
+		const int32_t NumCells = Data.Width * Data.Height;
+		const bool bHasRowMasks = Data.Width <= 64;
+		if (Data.Width <= 0 || Data.Height <= 0 || !Data.CellFlags || !Data.Neighbors ||
+			(bHasRowMasks && !Data.ValidRowMasks) ||
+			Data.NumSourceCells > MaxSourceCells || (Data.NumSourceCells > 0 && !Data.SourceCells) ||
+			(Data.NumRuneAnchorRows > 0 && (!Data.RuneAnchorRows || Data.NumRuneAnchorRows % (Orientation::Count * Data.Height) != 0)))
+		{
+			return false;
+		}
+
+		Origin = Data.Origin;
+		Width = Data.Width;
+		Height = Data.Height;
+		for (int32_t i = 0; i < Data.NumSourceCells; ++i)
+		{
+			if (Data.SourceCells[i].Index < 0 || Data.SourceCells[i].Index >= NumCells)
+			{
+				return false;
+			}
+		}
+
+		NumValidCells = Data.NumValidCells;
+		CellFlags.assign(Data.CellFlags, Data.CellFlags + NumCells);
+		Neighbors.assign(Data.Neighbors, Data.Neighbors + NumCells * 4);
+		if (bHasRowMasks)
+		{
+			ValidRowMasks.assign(Data.ValidRowMasks, Data.ValidRowMasks + Height);
+		}
+		if (Data.NumInitialCells > 0 && Data.InitialCells)
+		{
+			InitialCells.assign(Data.InitialCells, Data.InitialCells + Data.NumInitialCells);
+		}
+		if (Data.NumSourceCells > 0)
+		{
+			SourceCells.assign(Data.SourceCells, Data.SourceCells + Data.NumSourceCells);
+		}
+		if (Data.NumRuneAnchorRows > 0)
+		{
+			RuneAnchorRows.assign(Data.RuneAnchorRows, Data.RuneAnchorRows + Data.NumRuneAnchorRows);
+		}
+		return true;
+	}
+
+	bool FBoardLayout::ComputeRuneAnchorRows(const FRuneCatalog& Catalog, const FRuneVariant& Variant, uint64_t* OutRows) const
+	{
+		if (ValidRowMasks.empty() || static_cast<int32_t>(ValidRowMasks.size()) != Height)
+		{
+			return false;
+		}
+
+		// 앵커 (Row, Col)에 오프셋 (X, Y) 셀이 들어가려면 행 Row + X의 열 Col + Y가 유효해야 함
+		const uint64_t ColumnMask = Width == 64 ? ~0ull : (1ull << Width) - 1;
+		const FCellPos* Offsets = Catalog.GetOffsets(Variant);
+		for (int32_t Row = 0; Row < Height; ++Row)
+		{
+			uint64_t InBounds = ColumnMask;
+			for (uint16_t i = 0; i < Variant.NumOffsets && InBounds != 0; ++i)
+			{
+				const int32_t BoardRow = Row + Offsets[i].X;
+				InBounds = (BoardRow >= 0 && BoardRow < Height) ? InBounds & ShiftColumns(ValidRowMasks[BoardRow], Offsets[i].Y) : 0;
+			}
+			OutRows[Row] = InBounds;
+		}
+		return true;
+	}
+
+	void FBoardLayout::BakeRuneAnchorRows(const FRuneCatalog& Catalog)
+	{
+		RuneAnchorRows.clear();
+		if (ValidRowMasks.empty())
+		{
+			return;
+		}
+
+		// 카탈로그 최대 인덱스까지, 없는 룬은 0
+		RuneId MaxId = 0;
+		for (RuneId Id = 1; Id < MaxRuneCount; ++Id)
+		{
+			if (Catalog.Find(Id))
+			{
+				MaxId = Id;
+			}
+		}
+
+		RuneAnchorRows.assign((static_cast<size_t>(MaxId) + 1) * Orientation::Count * Height, 0);
+		for (RuneId Id = 1; Id <= MaxId; ++Id)
+		{
+			for (uint8_t Orient = 0; Orient < Orientation::Count; ++Orient)
+			{
+				if (const FRuneVariant* Variant = Catalog.FindVariant(Id, Orient))
+				{
+					ComputeRuneAnchorRows(Catalog, *Variant, RuneAnchorRows.data() + (static_cast<size_t>(Id) * Orientation::Count + Orient) * Height);
+				}
+			}
+		}
+	}
+}
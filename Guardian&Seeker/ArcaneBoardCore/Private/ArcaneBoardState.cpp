@@ -0,0 +1,820 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ArcaneBoardState.h"
+#include "ArcaneBoardLayout.h"
+#include "ArcaneRuneCatalog.h"
+#include <algorithm>
+
+namespace ArcaneCore
+{
+	void FBoardState::Reset(const FBoardLayout* InLayout, const FRuneCatalog* InCatalog, const FSynergyRuleSet* InRules)
+	{
+		Layout = InLayout;
+		Catalog = InCatalog;
+		Rules = InRules;
+		Clear();
+	}
+
+	void FBoardState::Clear()
+	{
+		Placements.clear();
+		PlacedRunes.Clear();
+		ConnectedRunes.Clear();
+		ConnectedRuneCount = 0;
+
+		if (Rules)
+		{
+			Synergy.Reset(*Rules);
+		}
+
+		if (!Layout)
+		{
+			CellFlags.clear();
+			CellRunes.clear();
+			CellSources.clear();
+			SourceRoots.clear();
+			SourceGroups.clear();
+			OccupiedRows.clear();
+			RuneRows.clear();
+			ConnectedRows.clear();
+			ScratchRows.clear();
+			return;
+		}
+
+		CellFlags.assign(Layout->GetNumCells(), 0);
+		CellRunes.assign(Layout->GetNumCells(), 0);
+		CellSources.assign(Layout->GetNumCells(), 0);
+
+		// 행 마스크가 있는 레이아웃(64열 이하)만 비트보드 사용
+		const size_t NumRows = Layout->GetValidRowMasks().empty() ? 0 : Layout->GetHeight();
+		OccupiedRows.assign(NumRows, 0);
+		RuneRows.assign(NumRows, 0);
+		ConnectedRows.assign(NumRows, 0);
+		ScratchRows.assign(NumRows, 0);
+
+		// 연결 탐색에서 할당하지 않도록 소스 수만큼 미리 확보
+		SourceRoots.assign(Layout->GetNumSourceCells(), -1);
+		SourceGroups.assign(Layout->GetNumSourceCells(), FSourceGroup());
+
+		for (const FBoardLayout::FInitialCell& Cell : Layout->GetInitialCells())
+		{
+			SetCellRune(Cell.Index, Cell.Rune, true);
+
+			FPlacement Placement;
+			Placement.Id = Cell.Rune;
+			Placement.Pos = Layout->ToPos(Cell.Index);
+			Placements.push_back(Placement);
+			PlacedRunes.Add(Cell.Rune);
+
+			// 나중에 Remove/밀어내기에서 빼므로 시너지 진행도에도 넣음
+			NotifySynergy(Placement, true);
+		}
+	}
+
+	EPlacementResult FBoardState::CheckPlacement(RuneId Id, const FCellPos& Pos, uint8_t InOrientation, std::vector<RuneId>* OutAffected) const
+	{
+		if (OutAffected)
+		{
+			OutAffected->clear();
+		}
+
+		const FRuneVariant* Variant = Catalog ? Catalog->FindVariant(Id, InOrientation) : nullptr;
+		if (!Variant || !Layout)
+		{
+			return EPlacementResult::OutOfBounds;
+		}
+
+		// 64열 이하 보드는 모양 행 마스크와 보드 행 비트보드 비교 (셀 단위 조회 없음)
+		if (!RuneRows.empty() && Variant->PlacementMask != 0)
+		{
+			return CheckPlacementByRows(*Variant, Pos, OutAffected);
+		}
+
+		bool bHasOverlapping = false;
+		bool bOutOfBounds = false;
+		const FCellPos* Offsets = Catalog->GetOffsets(*Variant);
+		for (uint16_t i = 0; i < Variant->NumOffsets; ++i)
+		{
+			const int32_t CellIndex = Layout->ToIndex(Pos + Offsets[i]);
+			if (CellIndex < 0)
+			{
+				bOutOfBounds = true;
+				continue;
+			}
+
+			const RuneId PlacedRune = CellRunes[CellIndex];
+			if ((CellFlags[CellIndex] & CF_Occupied) && PlacedRune > 0)
+			{
+				bHasOverlapping = true;
+				if (OutAffected && std::find(OutAffected->begin(), OutAffected->end(), PlacedRune) == OutAffected->end())
+				{
+					OutAffected->push_back(PlacedRune);
+				}
+			}
+		}
+
+		if (bOutOfBounds)
+		{
+			return EPlacementResult::OutOfBounds;
+		}
+		return bHasOverlapping ? EPlacementResult::ReplaceExisting : EPlacementResult::Valid;
+	}
+
+	EPlacementResult FBoardState::CheckPlacementByRows(const FRuneVariant& Variant, const FCellPos& Pos, std::vector<RuneId>* OutAffected) const
+	{
+		const int32_t Width = Layout->GetWidth();
+		const int32_t Height = Layout->GetHeight();
+		const std::vector<uint64_t>& ValidRows = Layout->GetValidRowMasks();
+		const int32_t FirstRow = Pos.X + Variant.MinOffset.X - Layout->GetOrigin().X;
+		const int32_t FirstCol = Pos.Y + Variant.MinOffset.Y - Layout->GetOrigin().Y;
+		const int32_t NumRows = Variant.MaxOffset.X - Variant.MinOffset.X + 1;
+
+		bool bOutOfBounds = false;
+		bool bHasOverlapping = false;
+		for (int32_t ShapeRow = 0; ShapeRow < NumRows; ++ShapeRow)
+		{
+			const uint64_t ShapeBits = (Variant.PlacementMask >> (ShapeRow * 8)) & 0xFF;
+			const int32_t Row = FirstRow + ShapeRow;
+			if (Row < 0 || Row >= Height)
+			{
+				bOutOfBounds |= ShapeBits != 0;
+				continue;
+			}
+
+			// 보드 밖/구멍으로 빠진 칸이 있으면 범위 밖
+			const uint64_t Cells = ShiftColumns(ShapeBits, -FirstCol) & ValidRows[Row];
+			bOutOfBounds |= CountBits(Cells) != CountBits(ShapeBits);
+
+			const uint64_t Overlap = Cells & RuneRows[Row];
+			bHasOverlapping |= Overlap != 0;
+			for (uint64_t Bits = OutAffected ? Overlap : 0; Bits != 0; Bits &= Bits - 1)
+			{
+				const RuneId PlacedRune = CellRunes[Row * Width + LowestBitIndex(Bits)];
+				if (std::find(OutAffected->begin(), OutAffected->end(), PlacedRune) == OutAffected->end())
+				{
+					OutAffected->push_back(PlacedRune);
+				}
+			}
+		}
+
+		if (bOutOfBounds)
+		{
+			return EPlacementResult::OutOfBounds;
+		}
+		return bHasOverlapping ? EPlacementResult::ReplaceExisting : EPlacementResult::Valid;
+	}
+
+	bool FBoardState::BuildAnchorMap(RuneId Id, uint8_t InOrientation, FPlacementAnchorMap& Out) const
+	{
+		Out.Reset();
+
+		const FRuneVariant* Variant = Catalog ? Catalog->FindVariant(Id, InOrientation) : nullptr;
+		if (!Variant || !Layout || Layout->GetNumCells() == 0)
+		{
+			return false;
+		}
+
+		const int32_t Width = Layout->GetWidth();
+		const int32_t Height = Layout->GetHeight();
+		const int32_t WordsPerRow = (Width + 63) >> 6;
+		const int32_t NumWords = Height * WordsPerRow;
+
+		Out.Id = Id;
+		Out.Orientation = InOrientation;
+		Out.Origin = Layout->GetOrigin();
+		Out.Width = Width;
+		Out.Height = Height;
+		Out.WordsPerRow = WordsPerRow;
+		Out.InBoundsRows.assign(NumWords, 0);
+		Out.FreeRows.assign(NumWords, 0);
+
+		// 64열을 넘는 보드는 앵커별 검사
+		if (WordsPerRow > 1)
+		{
+			for (int32_t Row = 0; Row < Height; ++Row)
+			{
+				for (int32_t Col = 0; Col < Width; ++Col)
+				{
+					const EPlacementResult Result = CheckPlacement(Id, FCellPos(Out.Origin.X + Row, Out.Origin.Y + Col), InOrientation);
+					const int32_t WordIndex = Row * WordsPerRow + (Col >> 6);
+					const uint64_t Bit = 1ull << (Col & 63);
+					if (Result != EPlacementResult::OutOfBounds)
+					{
+						Out.InBoundsRows[WordIndex] |= Bit;
+					}
+					if (Result == EPlacementResult::Valid)
+					{
+						Out.FreeRows[WordIndex] |= Bit;
+					}
+				}
+			}
+			return true;
+		}
+
+		// 범위 안 앵커는 빈 보드 기준이므로 레이아웃에 구워 둔 마스크가 있으면 그대로 사용
+		if (const uint64_t* BakedRows = Layout->FindRuneAnchorRows(Id, InOrientation))
+		{
+			std::copy(BakedRows, BakedRows + Height, Out.InBoundsRows.begin());
+		}
+		else
+		{
+			Layout->ComputeRuneAnchorRows(*Catalog, *Variant, Out.InBoundsRows.data());
+		}
+
+		// 룬이 없는 유효 셀 행 마스크 (CheckPlacement와 같이 룬 ID가 있는 점유 셀만 겹침)
+		const std::vector<uint64_t>& ValidRows = Layout->GetValidRowMasks();
+		Out.BoardFreeRows.resize(Height);
+		for (int32_t Row = 0; Row < Height; ++Row)
+		{
+			Out.BoardFreeRows[Row] = ValidRows[Row] & ~RuneRows[Row];
+		}
+
+		// 앵커 (Row, Col)의 오프셋 (X, Y) 셀이 모두 비어 있는지를 행 단위로 AND
+		const FCellPos* Offsets = Catalog->GetOffsets(*Variant);
+		for (int32_t Row = 0; Row < Height; ++Row)
+		{
+			uint64_t Free = Out.InBoundsRows[Row];
+			for (uint16_t i = 0; i < Variant->NumOffsets && Free != 0; ++i)
+			{
+				Free &= ShiftColumns(Out.BoardFreeRows[Row + Offsets[i].X], Offsets[i].Y);
+			}
+			Out.FreeRows[Row] = Free;
+		}
+
+		return true;
+	}
+
+	void FPlacementAnchorMap::Reset()
+	{
+		Id = 0;
+		Orientation = 0;
+		Width = 0;
+		Height = 0;
+		WordsPerRow = 0;
+		InBoundsRows.clear();
+		FreeRows.clear();
+	}
+
+	EPlacementResult FPlacementAnchorMap::Get(const FCellPos& Anchor) const
+	{
+		const int32_t Row = Anchor.X - Origin.X;
+		const int32_t Col = Anchor.Y - Origin.Y;
+		if (Row < 0 || Col < 0 || Row >= Height || Col >= Width)
+		{
+			return EPlacementResult::OutOfBounds;
+		}
+
+		const int32_t WordIndex = Row * WordsPerRow + (Col >> 6);
+		const int32_t Bit = Col & 63;
+		if ((FreeRows[WordIndex] >> Bit) & 1)
+		{
+			return EPlacementResult::Valid;
+		}
+		return (InBoundsRows[WordIndex] >> Bit) & 1 ? EPlacementResult::ReplaceExisting : EPlacementResult::OutOfBounds;
+	}
+
+	int32_t FPlacementAnchorMap::CountResult(EPlacementResult Result) const
+	{
+		int32_t NumFree = 0;
+		int32_t NumInBounds = 0;
+		for (size_t i = 0; i < InBoundsRows.size(); ++i)
+		{
+			NumFree += CountBits(FreeRows[i]);
+			NumInBounds += CountBits(InBoundsRows[i]);
+		}
+
+		switch (Result)
+		{
+		case EPlacementResult::Valid: return NumFree;
+		case EPlacementResult::ReplaceExisting: return NumInBounds - NumFree;
+		default: return Width * Height - NumInBounds;
+		}
+	}
+
+	bool FBoardState::Place(const FPlacement& Placement, std::vector<RuneId>* OutRemoved)
+	{
+		if (OutRemoved)
+		{
+			OutRemoved->clear();
+		}
+
+		const EPlacementResult Result = CheckPlacement(Placement.Id, Placement.Pos, Placement.Orientation, &ScratchRunes);
+		if (Result == EPlacementResult::OutOfBounds)
+		{
+			return false;
+		}
+
+		// 겹치는 룬들 제거
+		for (RuneId OverlappingRune : ScratchRunes)
+		{
+			if (Remove(OverlappingRune) && OutRemoved)
+			{
+				OutRemoved->push_back(OverlappingRune);
+			}
+		}
+
+		AddPlacementUnchecked(Placement);
+		return true;
+	}
+
+	bool FBoardState::Remove(RuneId Id)
+	{
+		auto It = std::find_if(Placements.begin(), Placements.end(),
+			[Id](const FPlacement& Placement) { return Placement.Id == Id; });
+		if (It == Placements.end())
+		{
+			return false;
+		}
+
+		const FPlacement Placement = *It;
+		NotifySynergy(Placement, false);
+		ApplyToCells(Placement, false);
+		Placements.erase(It);
+		PlacedRunes.Remove(Id);
+		return true;
+	}
+
+	void FBoardState::AddPlacementUnchecked(const FPlacement& Placement)
+	{
+		Placements.push_back(Placement);
+		PlacedRunes.Add(Placement.Id);
+		ApplyToCells(Placement, true);
+		NotifySynergy(Placement, true);
+	}
+
+	const FPlacement* FBoardState::FindPlacement(RuneId Id) const
+	{
+		for (const FPlacement& Placement : Placements)
+		{
+			if (Placement.Id == Id)
+			{
+				return &Placement;
+			}
+		}
+		return nullptr;
+	}
+
+	void FBoardState::UpdateConnections()
+	{
+		ConnectedRunes.Clear();
+		ConnectedRuneCount = 0;
+
+		if (!Layout)
+		{
+			return;
+		}
+
+		// 소스는 처음엔 각자 자기 그룹, 점유된 소스만 탐색 시작점
+		const std::vector<FBoardLayout::FSourceCell>& Sources = Layout->GetSourceCells();
+		for (int32_t Source = 0; Source < static_cast<int32_t>(Sources.size()); ++Source)
+		{
+			FSourceGroup& Group = SourceGroups[Source];
+			Group.Runes.Clear();
+			Group.RuneCount = 0;
+			Group.StatBits = 0;
+			Group.Weight = Sources[Source].Weight;
+			SourceRoots[Source] = -1;
+		}
+
+		if (!OccupiedRows.empty())
+		{
+			UpdateConnectionsByRows();
+		}
+		else
+		{
+			UpdateConnectionsByCells();
+		}
+
+		// 대표를 직접 가리키도록 정리하고 그룹별 룬 수 집계
+		for (int32_t Source = 0; Source < static_cast<int32_t>(Sources.size()); ++Source)
+		{
+			if (SourceRoots[Source] < 0)
+			{
+				continue;
+			}
+
+			SourceRoots[Source] = static_cast<int8_t>(FindSourceRoot(Source));
+			if (SourceRoots[Source] == Source)
+			{
+				FSourceGroup& Group = SourceGroups[Source];
+				Group.RuneCount = Group.Runes.Num();
+				ConnectedRunes.Union(Group.Runes);
+			}
+		}
+		ConnectedRuneCount = ConnectedRunes.Num();
+	}
+
+	void FBoardState::UpdateConnectionsByCells()
+	{
+		for (uint8_t& Flags : CellFlags)
+		{
+			Flags &= ~CF_Connected;
+		}
+		std::fill(CellSources.begin(), CellSources.end(), 0);
+
+		// 점유된 소스 셀을 모두 스택에 넣고 한 번에 탐색
+		ScratchStack.clear();
+		const std::vector<FBoardLayout::FSourceCell>& Sources = Layout->GetSourceCells();
+		for (int32_t Source = 0; Source < static_cast<int32_t>(Sources.size()); ++Source)
+		{
+			const int32_t CellIndex = Sources[Source].Index;
+			if (CellFlags[CellIndex] & CF_Occupied)
+			{
+				SourceRoots[Source] = static_cast<int8_t>(Source);
+				CellFlags[CellIndex] |= CF_Connected;
+				CellSources[CellIndex] = static_cast<uint8_t>(Source + 1);
+				ScratchStack.push_back(CellIndex);
+			}
+		}
+
+		// 재귀 대신 명시적 스택, 다른 소스가 칠한 셀을 만나면 두 그룹을 합침
+		while (!ScratchStack.empty())
+		{
+			const int32_t CellIndex = ScratchStack.back();
+			ScratchStack.pop_back();
+
+			const int32_t Root = FindSourceRoot(CellSources[CellIndex] - 1);
+			AddConnectedRune(SourceGroups[Root], CellRunes[CellIndex]);
+
+			const int32_t* CellNeighbors = Layout->GetNeighbors(CellIndex);
+			for (int32_t Dir = 0; Dir < 4; ++Dir)
+			{
+				const int32_t NextIndex = CellNeighbors[Dir];
+				if (NextIndex < 0 || !(CellFlags[NextIndex] & CF_Occupied))
+				{
+					continue;
+				}
+
+				if (!(CellFlags[NextIndex] & CF_Connected))
+				{
+					CellFlags[NextIndex] |= CF_Connected;
+					CellSources[NextIndex] = CellSources[CellIndex];
+					ScratchStack.push_back(NextIndex);
+					continue;
+				}
+
+				// 앞선 소스가 대표가 되도록 합침
+				const int32_t OtherRoot = FindSourceRoot(CellSources[NextIndex] - 1);
+				const int32_t CurrRoot = FindSourceRoot(Root);
+				if (OtherRoot != CurrRoot)
+				{
+					const int32_t NewRoot = std::min(OtherRoot, CurrRoot);
+					const int32_t OldRoot = std::max(OtherRoot, CurrRoot);
+					SourceRoots[OldRoot] = static_cast<int8_t>(NewRoot);
+
+					FSourceGroup& Merged = SourceGroups[NewRoot];
+					Merged.Runes.Union(SourceGroups[OldRoot].Runes);
+					Merged.StatBits |= SourceGroups[OldRoot].StatBits;
+					Merged.Weight += SourceGroups[OldRoot].Weight;
+				}
+			}
+		}
+	}
+
+	void FBoardState::UpdateConnectionsByRows()
+	{
+		const int32_t Width = Layout->GetWidth();
+		const int32_t Height = Layout->GetHeight();
+
+		// 이전에 연결됐던 셀만 되돌림
+		for (int32_t Row = 0; Row < Height; ++Row)
+		{
+			for (uint64_t Bits = ConnectedRows[Row]; Bits != 0; Bits &= Bits - 1)
+			{
+				const int32_t CellIndex = Row * Width + LowestBitIndex(Bits);
+				CellFlags[CellIndex] &= ~CF_Connected;
+				CellSources[CellIndex] = 0;
+			}
+			ConnectedRows[Row] = 0;
+		}
+
+		// 소스 순서대로, 아직 어느 영역에도 속하지 않은 소스에서만 영역 하나를 채움
+		// 이미 칠해진 소스는 앞선 소스의 그룹에 합류하므로 셀마다 한 번만 방문
+		const std::vector<FBoardLayout::FSourceCell>& Sources = Layout->GetSourceCells();
+		for (int32_t Source = 0; Source < static_cast<int32_t>(Sources.size()); ++Source)
+		{
+			const int32_t CellIndex = Sources[Source].Index;
+			if (!(CellFlags[CellIndex] & CF_Occupied))
+			{
+				continue;
+			}
+
+			if (CellSources[CellIndex] != 0)
+			{
+				const int32_t Root = CellSources[CellIndex] - 1;
+				SourceRoots[Source] = static_cast<int8_t>(Root);
+				SourceGroups[Root].Weight += Sources[Source].Weight;
+				continue;
+			}
+
+			SourceRoots[Source] = static_cast<int8_t>(Source);
+
+			int32_t MinRow = 0;
+			int32_t MaxRow = 0;
+			FloodRows(CellIndex / Width, 1ull << (CellIndex % Width), MinRow, MaxRow);
+
+			FSourceGroup& Group = SourceGroups[Source];
+			for (int32_t Row = MinRow; Row <= MaxRow; ++Row)
+			{
+				for (uint64_t Bits = ScratchRows[Row]; Bits != 0; Bits &= Bits - 1)
+				{
+					const int32_t Index = Row * Width + LowestBitIndex(Bits);
+					CellFlags[Index] |= CF_Connected;
+					CellSources[Index] = static_cast<uint8_t>(Source + 1);
+					AddConnectedRune(Group, CellRunes[Index]);
+				}
+				ConnectedRows[Row] |= ScratchRows[Row];
+				ScratchRows[Row] = 0;
+			}
+		}
+	}
+
+	void FBoardState::FloodRows(int32_t SeedRow, uint64_t SeedBits, int32_t& OutMinRow, int32_t& OutMaxRow)
+	{
+		const int32_t Height = Layout->GetHeight();
+
+		// 행 안은 가로 구간 채우기, 행이 넓어지면 위아래 행을 다시 검사 (바뀐 행만 방문)
+		ScratchRows[SeedRow] = FillRowSpans(SeedBits, OccupiedRows[SeedRow]);
+		OutMinRow = SeedRow;
+		OutMaxRow = SeedRow;
+
+		ScratchStack.clear();
+		ScratchStack.push_back(SeedRow - 1);
+		ScratchStack.push_back(SeedRow + 1);
+		while (!ScratchStack.empty())
+		{
+			const int32_t Row = ScratchStack.back();
+			ScratchStack.pop_back();
+			if (Row < 0 || Row >= Height)
+			{
+				continue;
+			}
+
+			const uint64_t Above = Row > 0 ? ScratchRows[Row - 1] : 0;
+			const uint64_t Below = Row + 1 < Height ? ScratchRows[Row + 1] : 0;
+			const uint64_t Seed = (Above | Below) & OccupiedRows[Row] & ~ScratchRows[Row];
+			if (Seed == 0)
+			{
+				continue;
+			}
+
+			ScratchRows[Row] = FillRowSpans(ScratchRows[Row] | Seed, OccupiedRows[Row]);
+			OutMinRow = std::min(OutMinRow, Row);
+			OutMaxRow = std::max(OutMaxRow, Row);
+			ScratchStack.push_back(Row - 1);
+			ScratchStack.push_back(Row + 1);
+		}
+	}
+
+	void FBoardState::AddConnectedRune(FSourceGroup& Group, RuneId Rune) const
+	{
+		if (Rune == 0 || Group.Runes.Contains(Rune))
+		{
+			return;
+		}
+
+		Group.Runes.Add(Rune);
+		const FRuneEntry* Entry = Catalog ? Catalog->Find(Rune) : nullptr;
+		if (Entry && Entry->StatIndex != StatIndex::None)
+		{
+			Group.StatBits |= 1u << Entry->StatIndex;
+		}
+	}
+
+	int32_t FBoardState::FindSourceRoot(int32_t Source)
+	{
+		while (SourceRoots[Source] != Source)
+		{
+			SourceRoots[Source] = SourceRoots[SourceRoots[Source]];
+			Source = SourceRoots[Source];
+		}
+		return Source;
+	}
+
+	const FRuneIdSet& FBoardState::GetSourceConnectedRunes(int32_t SourceIndex) const
+	{
+		static const FRuneIdSet EmptySet;
+		if (SourceIndex < 0 || SourceIndex >= static_cast<int32_t>(SourceRoots.size()) || SourceRoots[SourceIndex] < 0)
+		{
+			return EmptySet;
+		}
+		return SourceGroups[SourceRoots[SourceIndex]].Runes;
+	}
+
+	int32_t FBoardState::GetSourceConnectedRuneCount(int32_t SourceIndex) const
+	{
+		if (SourceIndex < 0 || SourceIndex >= static_cast<int32_t>(SourceRoots.size()) || SourceRoots[SourceIndex] < 0)
+		{
+			return 0;
+		}
+		return SourceGroups[SourceRoots[SourceIndex]].RuneCount;
+	}
+
+	FBoardStats FBoardState::ComputeStats() const
+	{
+		FBoardStats Stats;
+		if (!Catalog)
+		{
+			return Stats;
+		}
+
+		// 룬별 스탯 행을 레인 단위로 누적
+		for (const FPlacement& Placement : Placements)
+		{
+			const FRuneEntry* Entry = Catalog->Find(Placement.Id);
+			if (Entry && Entry->StatIndex != StatIndex::None)
+			{
+				Stats.RuneStats += Entry->StatRow;
+			}
+		}
+
+		// 소스 그룹마다, 그룹에 연결된 룬이 있는 스탯에 (연결 룬 개수 x 배율) 보너스
+		for (int32_t Source = 0; Source < static_cast<int32_t>(SourceRoots.size()); ++Source)
+		{
+			if (SourceRoots[Source] != Source)
+			{
+				continue;
+			}
+
+			const FSourceGroup& Group = SourceGroups[Source];
+			const float ConnectionBonus = static_cast<float>(Group.RuneCount) * Group.Weight;
+			for (int32_t Stat = 0; Stat < StatIndex::Count; ++Stat)
+			{
+				if ((Group.StatBits >> Stat) & 1)
+				{
+					Stats.BonusStats[Stat] += ConnectionBonus;
+				}
+			}
+		}
+
+		// 시너지 보너스는 배치 델타마다 누적된 값을 그대로 사용
+		Stats.BonusStats += Synergy.GetBonusStats();
+		return Stats;
+	}
+
+	FBoardStats FBoardState::Evaluate()
+	{
+		UpdateConnections();
+		return ComputeStats();
+	}
+
+	size_t FBoardState::GetAllocatedSize() const
+	{
+		return CellFlags.capacity() + CellRunes.capacity() * sizeof(RuneId) + CellSources.capacity()
+			+ SourceRoots.capacity() + SourceGroups.capacity() * sizeof(FSourceGroup)
+			+ (OccupiedRows.capacity() + RuneRows.capacity() + ConnectedRows.capacity() + ScratchRows.capacity()) * sizeof(uint64_t)
+			+ Placements.capacity() * sizeof(FPlacement) + ScratchStack.capacity() * sizeof(int32_t)
+			+ ScratchRunes.capacity() * sizeof(RuneId);
+	}
+
+	void FBoardState::ApplyToCells(const FPlacement& Placement, bool bOccupy)
+	{
+		const FRuneVariant* Variant = Catalog ? Catalog->FindVariant(Placement.Id, Placement.Orientation) : nullptr;
+		if (!Variant || !Layout)
+		{
+			return;
+		}
+
+		const FCellPos* Offsets = Catalog->GetOffsets(*Variant);
+		for (uint16_t i = 0; i < Variant->NumOffsets; ++i)
+		{
+			const int32_t CellIndex = Layout->ToIndex(Placement.Pos + Offsets[i]);
+			if (CellIndex < 0)
+			{
+				continue;
+			}
+
+			SetCellRune(CellIndex, bOccupy ? Placement.Id : 0, bOccupy);
+		}
+	}
+
+	void FBoardState::SetCellRune(int32_t CellIndex, RuneId Rune, bool bOccupy)
+	{
+		if (bOccupy)
+		{
+			CellFlags[CellIndex] |= CF_Occupied;
+		}
+		else
+		{
+			CellFlags[CellIndex] &= ~(CF_Occupied | CF_Connected);
+		}
+		CellRunes[CellIndex] = Rune;
+
+		if (OccupiedRows.empty())
+		{
+			return;
+		}
+
+		const int32_t Width = Layout->GetWidth();
+		const int32_t Row = CellIndex / Width;
+		const uint64_t Bit = 1ull << (CellIndex % Width);
+		OccupiedRows[Row] = bOccupy ? OccupiedRows[Row] | Bit : OccupiedRows[Row] & ~Bit;
+		RuneRows[Row] = Rune > 0 ? RuneRows[Row] | Bit : RuneRows[Row] & ~Bit;
+	}
+
+	int32_t FBoardState::GatherNeighbors(const FPlacement& Placement, RuneId* OutNeighbors, int32_t MaxNeighbors) const
+	{
+		const FRuneVariant* Variant = Catalog ? Catalog->FindVariant(Placement.Id, Placement.Orientation) : nullptr;
+		if (!Variant || !Layout)
+		{
+			return 0;
+		}
+
+		uint64_t Seen[MaxRuneCount / 64] = {};
+		int32_t NumNeighbors = 0;
+
+		const FCellPos* Offsets = Catalog->GetOffsets(*Variant);
+		for (uint16_t i = 0; i < Variant->NumOffsets; ++i)
+		{
+			const int32_t CellIndex = Layout->ToIndex(Placement.Pos + Offsets[i]);
+			if (CellIndex < 0)
+			{
+				continue;
+			}
+
+			const int32_t* CellNeighbors = Layout->GetNeighbors(CellIndex);
+			for (int32_t Dir = 0; Dir < 4; ++Dir)
+			{
+				const int32_t NeighborIndex = CellNeighbors[Dir];
+				if (NeighborIndex < 0)
+				{
+					continue;
+				}
+
+				const RuneId NeighborRune = CellRunes[NeighborIndex];
+				if (NeighborRune == 0 || NeighborRune == Placement.Id)
+				{
+					continue;
+				}
+
+				uint64_t& SeenWord = Seen[NeighborRune >> 6];
+				const uint64_t SeenBit = 1ull << (NeighborRune & 63);
+				if (!(SeenWord & SeenBit) && NumNeighbors < MaxNeighbors)
+				{
+					SeenWord |= SeenBit;
+					OutNeighbors[NumNeighbors++] = NeighborRune;
+				}
+			}
+		}
+
+		return NumNeighbors;
+	}
+
+	void FBoardState::NotifySynergy(const FPlacement& Placement, bool bPlaced)
+	{
+		if (!Rules || Rules->GetNumRules() == 0)
+		{
+			return;
+		}
+
+		RuneId Neighbors[MaxRuneCount];
+		const int32_t NumNeighbors = GatherNeighbors(Placement, Neighbors, MaxRuneCount);
+		if (bPlaced)
+		{
+			Synergy.OnRunePlaced(*Rules, Placement.Id, Neighbors, NumNeighbors);
+		}
+		else
+		{
+			Synergy.OnRuneRemoved(*Rules, Placement.Id, Neighbors, NumNeighbors);
+		}
+	}
+
+	bool PreviewPlacement(const FBoardState& Base, const FPlacement& Placement, FBoardState& Scratch, FPlacementPreview& Out)
+	{
+		Out.bValid = false;
+		Out.Stats = FBoardStats();
+		Out.StatDelta = FBoardStats();
+		Out.Displaced.clear();
+		Out.NewlyConnected.clear();
+		Out.Disconnected.clear();
+
+		// 벡터 용량은 유지되므로 보드 크기가 같으면 재할당 없음
+		Scratch = Base;
+		if (Scratch.FindPlacement(Placement.Id))
+		{
+			Scratch.Remove(Placement.Id);
+		}
+
+		if (!Scratch.Place(Placement, &Out.Displaced))
+		{
+			return false;
+		}
+
+		Out.Stats = Scratch.Evaluate();
+
+		const FBoardStats BaseStats = Base.ComputeStats();
+		Out.StatDelta = Out.Stats;
+		Out.StatDelta.RuneStats.AddScaled(BaseStats.RuneStats, -1.0f);
+		Out.StatDelta.BonusStats.AddScaled(BaseStats.BonusStats, -1.0f);
+
+		FRuneIdSet Changed;
+		Scratch.GetConnectedRunes().Difference(Base.GetConnectedRunes(), Changed);
+		Changed.ForEach([&Out](RuneId Id) { Out.NewlyConnected.push_back(Id); });
+
+		Base.GetConnectedRunes().Difference(Scratch.GetConnectedRunes(), Changed);
+		Changed.ForEach([&Out](RuneId Id) { Out.Disconnected.push_back(Id); });
+
+		Out.bValid = true;
+		return true;
+	}
+}
@@ -0,0 +1,352 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ArcaneBoardTelemetry.h"
+#include "ArcaneBoardLayout.h"
+#include "ArcaneRuneCatalog.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace ArcaneCore
+{
+	namespace
+	{
+		constexpr uint64_t FNVOffsetBasis = 0xCBF29CE484222325ull;
+		constexpr uint64_t FNVPrime = 0x100000001B3ull;
+
+		struct FTelemetryFileHeader
+		{
+			uint32_t Magic;
+			uint16_t Version;
+			uint16_t NumStats;
+			uint32_t NumBoards;
+			uint32_t NumExternalIds;
+			uint32_t NumTopConfigs;
+			uint32_t Reserved;
+		};
+		static_assert(sizeof(FTelemetryFileHeader) == 24, "FTelemetryFileHeader는 24바이트");
+
+		uint64_t HashBytes(uint64_t Hash, const void* Data, size_t Size)
+		{
+			const uint8_t* Bytes = static_cast<const uint8_t*>(Data);
+			for (size_t i = 0; i < Size; ++i)
+			{
+				Hash = (Hash ^ Bytes[i]) * FNVPrime;
+			}
+			return Hash;
+		}
+
+		template <typename T>
+		uint64_t HashValue(uint64_t Hash, const T& Value)
+		{
+			return HashBytes(Hash, &Value, sizeof(T));
+		}
+
+		// splitmix64 마무리 단계, 스케치 행마다 다른 시드로 독립 해시
+		uint64_t MixBits(uint64_t Value)
+		{
+			Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+			Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+			return Value ^ (Value >> 31);
+		}
+
+		uint64_t MakePairKey(RuneId A, RuneId B)
+		{
+			return A < B ? (static_cast<uint64_t>(A) << 16) | B : (static_cast<uint64_t>(B) << 16) | A;
+		}
+
+		void WriteBytes(std::vector<uint8_t>& OutBytes, const void* Data, size_t Size)
+		{
+			const uint8_t* Bytes = static_cast<const uint8_t*>(Data);
+			OutBytes.insert(OutBytes.end(), Bytes, Bytes + Size);
+		}
+
+		template <typename T>
+		void WriteArray(std::vector<uint8_t>& OutBytes, const std::vector<T>& Values)
+		{
+			WriteBytes(OutBytes, Values.data(), Values.size() * sizeof(T));
+		}
+
+		// 남은 길이가 모자라면 false
+		bool ReadBytes(const uint8_t*& Data, size_t& Size, void* Out, size_t Bytes)
+		{
+			if (Size < Bytes)
+			{
+				return false;
+			}
+			std::memcpy(Out, Data, Bytes);
+			Data += Bytes;
+			Size -= Bytes;
+			return true;
+		}
+
+		template <typename T>
+		bool ReadArray(const uint8_t*& Data, size_t& Size, std::vector<T>& Values)
+		{
+			return ReadBytes(Data, Size, Values.data(), Values.size() * sizeof(T));
+		}
+	}
+
+	uint64_t HashLayout(const FBoardLayout& Layout)
+	{
+		// 고정 룬은 칸만 반영 (내부 인덱스는 룬 테이블에 따라 바뀜)
+		uint64_t Hash = FNVOffsetBasis;
+		Hash = HashValue(Hash, Layout.GetOrigin().X);
+		Hash = HashValue(Hash, Layout.GetOrigin().Y);
+		Hash = HashValue(Hash, Layout.GetWidth());
+		Hash = HashValue(Hash, Layout.GetHeight());
+		Hash = HashBytes(Hash, Layout.GetCellFlags().data(), Layout.GetCellFlags().size());
+		for (const FBoardLayout::FInitialCell& Cell : Layout.GetInitialCells())
+		{
+			Hash = HashValue(Hash, Cell.Index);
+		}
+		return Hash;
+	}
+
+	uint64_t HashRuneSet(const FRuneIdSet& Runes)
+	{
+		return HashBytes(FNVOffsetBasis, Runes.Words, sizeof(Runes.Words));
+	}
+
+	void FCountMinSketch::Init(int32_t InDepth, int32_t InWidth)
+	{
+		int32_t Width = 1;
+		while (Width < InWidth)
+		{
+			Width <<= 1;
+		}
+
+		Depth = std::max(InDepth, 1);
+		WidthMask = Width - 1;
+		Counters.assign(static_cast<size_t>(Depth) * Width, 0);
+	}
+
+	void FCountMinSketch::Clear()
+	{
+		std::fill(Counters.begin(), Counters.end(), 0u);
+	}
+
+	void FCountMinSketch::Add(uint64_t Key, uint32_t Count)
+	{
+		const int32_t Width = GetWidth();
+		for (int32_t Row = 0; Row < Depth; ++Row)
+		{
+			const uint64_t Slot = MixBits(Key + (Row + 1) * 0x9E3779B97F4A7C15ull) & WidthMask;
+			uint32_t& Counter = Counters[Row * Width + Slot];
+			Counter = Counter > UINT32_MAX - Count ? UINT32_MAX : Counter + Count;
+		}
+	}
+
+	uint32_t FCountMinSketch::Estimate(uint64_t Key) const
+	{
+		if (Counters.empty())
+		{
+			return 0;
+		}
+
+		const int32_t Width = GetWidth();
+		uint32_t Result = UINT32_MAX;
+		for (int32_t Row = 0; Row < Depth; ++Row)
+		{
+			const uint64_t Slot = MixBits(Key + (Row + 1) * 0x9E3779B97F4A7C15ull) & WidthMask;
+			Result = std::min(Result, Counters[Row * Width + Slot]);
+		}
+		return Result;
+	}
+
+	FBoardTelemetryAggregator::FBoardTelemetryAggregator()
+		: RuneUseCounts(MaxRuneCount, 0)
+		, RuneCountHistogram(MaxRunesPerBoard + 1, 0)
+		, LayoutCounts(MaxLayouts, 0)
+		, StatHistograms(StatIndex::Count * NumStatBins, 0)
+	{
+		ConfigSketch.Init(SketchDepth, SketchWidth);
+		PairSketch.Init(SketchDepth, SketchWidth);
+		TopConfigs.reserve(NumTopConfigs);
+	}
+
+	void FBoardTelemetryAggregator::Clear()
+	{
+		NumBoards = 0;
+		std::fill(RuneUseCounts.begin(), RuneUseCounts.end(), 0u);
+		std::fill(RuneCountHistogram.begin(), RuneCountHistogram.end(), 0u);
+		std::fill(LayoutCounts.begin(), LayoutCounts.end(), 0u);
+		std::fill(StatHistograms.begin(), StatHistograms.end(), 0u);
+		ConfigSketch.Clear();
+		PairSketch.Clear();
+		TopConfigs.clear();
+	}
+
+	int32_t FBoardTelemetryAggregator::GetStatBin(float Value)
+	{
+		if (!(Value >= 1.0f))
+		{
+			return 0;
+		}
+		return std::min(1 + std::ilogb(Value), NumStatBins - 1);
+	}
+
+	uint64_t FBoardTelemetryAggregator::MakeConfigKey(uint64_t LayoutHash, const FRuneIdSet& Runes)
+	{
+		return MixBits(LayoutHash ^ HashRuneSet(Runes));
+	}
+
+	uint32_t FBoardTelemetryAggregator::EstimateConfigCount(uint64_t LayoutHash, const FRuneIdSet& Runes) const
+	{
+		return ConfigSketch.Estimate(MakeConfigKey(LayoutHash, Runes));
+	}
+
+	uint32_t FBoardTelemetryAggregator::EstimatePairCount(RuneId A, RuneId B) const
+	{
+		return PairSketch.Estimate(MakePairKey(A, B));
+	}
+
+	void FBoardTelemetryAggregator::Add(const FBoardFingerprint& Fingerprint)
+	{
+		++NumBoards;
+		LayoutCounts[std::min<int32_t>(Fingerprint.LayoutIndex, MaxLayouts - 1)]++;
+
+		// 룬 목록은 스택 배열에 모아 쌍 갱신에 재사용 (보드당 MaxRunesPerBoard개까지)
+		RuneId Runes[MaxRunesPerBoard];
+		int32_t NumRunes = 0;
+		int32_t NumTotalRunes = 0;
+		Fingerprint.Runes.ForEach([&](RuneId Id)
+		{
+			RuneUseCounts[Id]++;
+			if (NumRunes < MaxRunesPerBoard)
+			{
+				Runes[NumRunes++] = Id;
+			}
+			++NumTotalRunes;
+		});
+		RuneCountHistogram[std::min(NumTotalRunes, MaxRunesPerBoard)]++;
+
+		for (int32_t i = 0; i < NumRunes; ++i)
+		{
+			for (int32_t j = i + 1; j < NumRunes; ++j)
+			{
+				PairSketch.Add(MakePairKey(Runes[i], Runes[j]));
+			}
+		}
+
+		for (int32_t Stat = 0; Stat < StatIndex::Count; ++Stat)
+		{
+			StatHistograms[Stat * NumStatBins + GetStatBin(Fingerprint.StatTotals[Stat])]++;
+		}
+
+		const uint64_t Key = MakeConfigKey(Fingerprint.LayoutHash, Fingerprint.Runes);
+		ConfigSketch.Add(Key);
+		UpdateTopConfigs(Key, ConfigSketch.Estimate(Key), Fingerprint);
+	}
+
+	void FBoardTelemetryAggregator::UpdateTopConfigs(uint64_t Key, uint32_t Estimate, const FBoardFingerprint& Fingerprint)
+	{
+		FTopConfig* MinConfig = nullptr;
+		for (FTopConfig& Config : TopConfigs)
+		{
+			if (Config.Key == Key)
+			{
+				Config.Estimate = Estimate;
+				return;
+			}
+			if (!MinConfig || Config.Estimate < MinConfig->Estimate)
+			{
+				MinConfig = &Config;
+			}
+		}
+
+		// 표가 차면 가장 적은 후보보다 많을 때만 교체
+		if (static_cast<int32_t>(TopConfigs.size()) < NumTopConfigs)
+		{
+			MinConfig = &TopConfigs.emplace_back();
+		}
+		else if (Estimate <= MinConfig->Estimate)
+		{
+			return;
+		}
+
+		MinConfig->Key = Key;
+		MinConfig->Estimate = Estimate;
+		MinConfig->LayoutIndex = Fingerprint.LayoutIndex;
+		MinConfig->Runes = Fingerprint.Runes;
+	}
+
+	void FBoardTelemetryAggregator::Serialize(const FRuneIdRemap* Remap, std::vector<uint8_t>& OutBytes) const
+	{
+		std::vector<int32_t> ExternalIds;
+		if (Remap)
+		{
+			ExternalIds.reserve(Remap->Num() + 1);
+			for (int32_t Id = 0; Id <= Remap->Num(); ++Id)
+			{
+				ExternalIds.push_back(Remap->ToExternal(static_cast<RuneId>(Id)));
+			}
+		}
+
+		FTelemetryFileHeader Header;
+		Header.Magic = FileMagic;
+		Header.Version = FileVersion;
+		Header.NumStats = StatIndex::Count;
+		Header.NumBoards = NumBoards;
+		Header.NumExternalIds = static_cast<uint32_t>(ExternalIds.size());
+		Header.NumTopConfigs = static_cast<uint32_t>(TopConfigs.size());
+		Header.Reserved = 0;
+
+		OutBytes.clear();
+		WriteBytes(OutBytes, &Header, sizeof(Header));
+		WriteArray(OutBytes, ExternalIds);
+		WriteArray(OutBytes, RuneUseCounts);
+		WriteArray(OutBytes, RuneCountHistogram);
+		WriteArray(OutBytes, LayoutCounts);
+		WriteArray(OutBytes, StatHistograms);
+		WriteArray(OutBytes, ConfigSketch.GetCounters());
+		WriteArray(OutBytes, PairSketch.GetCounters());
+		for (const FTopConfig& Config : TopConfigs)
+		{
+			WriteBytes(OutBytes, &Config.Key, sizeof(Config.Key));
+			WriteBytes(OutBytes, &Config.Estimate, sizeof(Config.Estimate));
+			WriteBytes(OutBytes, &Config.LayoutIndex, sizeof(Config.LayoutIndex));
+			WriteBytes(OutBytes, Config.Runes.Words, sizeof(Config.Runes.Words));
+		}
+	}
+
+	bool FBoardTelemetryAggregator::Deserialize(const uint8_t* Data, size_t Size, std::vector<int32_t>* OutExternalIds)
+	{
+		Clear();
+
+		FTelemetryFileHeader Header;
+		if (!Data || !ReadBytes(Data, Size, &Header, sizeof(Header)) ||
+			Header.Magic != FileMagic || Header.Version != FileVersion || Header.NumStats != StatIndex::Count ||
+			Header.NumExternalIds > MaxRuneCount || Header.NumTopConfigs > NumTopConfigs)
+		{
+			return false;
+		}
+
+		std::vector<int32_t> ExternalIds(Header.NumExternalIds);
+		TopConfigs.resize(Header.NumTopConfigs);
+		bool bValid = ReadArray(Data, Size, ExternalIds) && ReadArray(Data, Size, RuneUseCounts) &&
+			ReadArray(Data, Size, RuneCountHistogram) && ReadArray(Data, Size, LayoutCounts) &&
+			ReadArray(Data, Size, StatHistograms) && ReadArray(Data, Size, ConfigSketch.Counters) &&
+			ReadArray(Data, Size, PairSketch.Counters);
+		for (FTopConfig& Config : TopConfigs)
+		{
+			bValid = bValid && ReadBytes(Data, Size, &Config.Key, sizeof(Config.Key)) &&
+				ReadBytes(Data, Size, &Config.Estimate, sizeof(Config.Estimate)) &&
+				ReadBytes(Data, Size, &Config.LayoutIndex, sizeof(Config.LayoutIndex)) &&
+				ReadBytes(Data, Size, Config.Runes.Words, sizeof(Config.Runes.Words));
+		}
+
+		if (!bValid || Size != 0)
+		{
+			Clear();
+			return false;
+		}
+
+		NumBoards = Header.NumBoards;
+		if (OutExternalIds)
+		{
+			*OutExternalIds = std::move(ExternalIds);
+		}
+		return true;
+	}
+}
@@ -0,0 +1,129 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ArcaneBoardValidator.h"
+#include "ArcaneBoardState.h"
+#include "ArcaneRuneCatalog.h"
+#include <vector>
+
+namespace ArcaneCore
+{
+	EValidationResult ApplySubmittedBoard(FBoardState& State, const FPlacement* Placements, int32_t NumPlacements,
+		const FRuneIdSet& OwnedRunes, FValidationDiff* OutDiff)
+	{
+		FValidationDiff Diff;
+		const FRuneCatalog* Catalog = State.GetCatalog();
+		if (!Catalog || NumPlacements < 0 || NumPlacements >= MaxRuneCount)
+		{
+			return EValidationResult::UnknownRune;
+		}
+
+		// 룬 ID -> 제출 목록 인덱스
+		int16_t SubmittedIndex[MaxRuneCount];
+		for (int16_t& Index : SubmittedIndex)
+		{
+			Index = -1;
+		}
+
+		for (int32_t i = 0; i < NumPlacements; ++i)
+		{
+			// ID 0은 레이아웃에 고정된 셀, 제출 여부와 관계없이 유지
+			const FPlacement& Placement = Placements[i];
+			if (Placement.Id == 0)
+			{
+				continue;
+			}
+			if (!Catalog->Find(Placement.Id) || Placement.Orientation >= Orientation::Count)
+			{
+				return EValidationResult::UnknownRune;
+			}
+			if (SubmittedIndex[Placement.Id] >= 0)
+			{
+				return EValidationResult::DuplicateRune;
+			}
+			SubmittedIndex[Placement.Id] = static_cast<int16_t>(i);
+		}
+
+		// 위치/방향까지 같은 룬은 유지, 나머지는 제거 대상
+		FRuneIdSet KeptRunes;
+		KeptRunes.Add(0);
+		std::vector<FPlacement> Removed;
+		for (const FPlacement& Current : State.GetPlacements())
+		{
+			if (Current.Id == 0)
+			{
+				continue;
+			}
+
+			const int16_t Index = SubmittedIndex[Current.Id];
+			if (Index >= 0 && Placements[Index].Pos == Current.Pos && Placements[Index].Orientation == Current.Orientation)
+			{
+				KeptRunes.Add(Current.Id);
+				++Diff.NumKept;
+			}
+			else
+			{
+				Removed.push_back(Current);
+			}
+		}
+
+		// 새로 놓이는 룬만 소유 검사
+		for (int32_t i = 0; i < NumPlacements; ++i)
+		{
+			if (!KeptRunes.Contains(Placements[i].Id) && !OwnedRunes.Contains(Placements[i].Id))
+			{
+				return EValidationResult::NotOwned;
+			}
+		}
+
+		for (const FPlacement& Placement : Removed)
+		{
+			State.Remove(Placement.Id);
+		}
+		Diff.NumRemoved = static_cast<int32_t>(Removed.size());
+
+		EValidationResult Result = EValidationResult::Accepted;
+		int32_t NumApplied = 0;
+		for (int32_t i = 0; i < NumPlacements; ++i)
+		{
+			const FPlacement& Placement = Placements[i];
+			if (KeptRunes.Contains(Placement.Id))
+			{
+				continue;
+			}
+
+			const EPlacementResult PlacementResult = State.CheckPlacement(Placement.Id, Placement.Pos, Placement.Orientation);
+			if (PlacementResult != EPlacementResult::Valid)
+			{
+				Result = (PlacementResult == EPlacementResult::OutOfBounds) ? EValidationResult::OutOfBounds : EValidationResult::Overlapping;
+				break;
+			}
+
+			State.AddPlacementUnchecked(Placement);
+			++NumApplied;
+		}
+		Diff.NumAdded = NumApplied;
+
+		if (Result != EValidationResult::Accepted)
+		{
+			// 되돌리기: 이번에 놓은 룬 제거 후 제거했던 룬 복원
+			for (int32_t i = 0; i < NumPlacements && NumApplied > 0; ++i)
+			{
+				if (!KeptRunes.Contains(Placements[i].Id) && State.Remove(Placements[i].Id))
+				{
+					--NumApplied;
+				}
+			}
+			for (const FPlacement& Placement : Removed)
+			{
+				State.AddPlacementUnchecked(Placement);
+			}
+			return Result;
+		}
+
+		if (OutDiff)
+		{
+			*OutDiff = Diff;
+		}
+		return EValidationResult::Accepted;
+	}
+}
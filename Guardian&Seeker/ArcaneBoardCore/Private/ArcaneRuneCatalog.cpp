@@ -0,0 +1,146 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ArcaneRuneCatalog.h"
+#include <algorithm>
+#include <cassert>
+#include <climits>
+
+namespace ArcaneCore
+{
+	FRuneIdRemap::FRuneIdRemap()
+	{
+		Clear();
+	}
+
+	int32_t FRuneIdRemap::Build(std::vector<int32_t> InExternalIds)
+	{
+		std::sort(InExternalIds.begin(), InExternalIds.end());
+		InExternalIds.erase(std::unique(InExternalIds.begin(), InExternalIds.end()), InExternalIds.end());
+		InExternalIds.erase(InExternalIds.begin(), std::upper_bound(InExternalIds.begin(), InExternalIds.end(), 0));
+		Clear();
+		if (static_cast<int32_t>(InExternalIds.size()) >= MaxRuneCount)
+		{
+			NumDropped = static_cast<int32_t>(InExternalIds.size()) - (MaxRuneCount - 1);
+			InExternalIds.resize(MaxRuneCount - 1);
+		}
+
+		ExternalIds.insert(ExternalIds.end(), InExternalIds.begin(), InExternalIds.end());
+		return Num();
+	}
+
+	void FRuneIdRemap::Clear()
+	{
+		ExternalIds.assign(1, 0);
+		NumDropped = 0;
+	}
+
+	RuneId FRuneIdRemap::ToInternal(int32_t ExternalId) const
+	{
+		const auto It = std::lower_bound(ExternalIds.begin() + 1, ExternalIds.end(), ExternalId);
+		return It != ExternalIds.end() && *It == ExternalId ? static_cast<RuneId>(It - ExternalIds.begin()) : 0;
+	}
+
+	FRuneCatalog::FRuneCatalog()
+	{
+		Clear();
+	}
+
+	void FRuneCatalog::Clear()
+	{
+		Entries.assign(1, FRuneEntry());
+		OffsetPool.clear();
+		NumRunes = 0;
+	}
+
+	bool FRuneCatalog::AddRune(const FRuneDef& Def)
+	{
+		// 내부 인덱스는 FRuneIdRemap이 상한 안에서만 부여
+		assert(Def.Id < MaxRuneCount);
+		if (Def.Id == 0 || Def.Id >= MaxRuneCount || Def.Shape.empty())
+		{
+			return false;
+		}
+
+		if (Def.Id >= Entries.size())
+		{
+			Entries.resize(Def.Id + 1);
+		}
+
+		FRuneEntry& Entry = Entries[Def.Id];
+		const bool bReuseOffsets = Entry.bValid && Entry.Variants[0].NumOffsets == Def.Shape.size();
+		if (!Entry.bValid)
+		{
+			++NumRunes;
+		}
+
+		Entry.Id = Def.Id;
+		Entry.bValid = true;
+		Entry.StatIndex = static_cast<int8_t>(Def.StatIndex);
+		Entry.StatValue = Def.StatValue;
+		Entry.StatRow = FStatBlock();
+		if (Def.StatIndex >= 0 && Def.StatIndex < StatIndex::Count)
+		{
+			Entry.StatRow[Def.StatIndex] = Def.StatValue;
+		}
+
+		for (uint8_t Orient = 0; Orient < Orientation::Count; ++Orient)
+		{
+			FRuneVariant& Variant = Entry.Variants[Orient];
+			const uint32_t FirstOffset = bReuseOffsets ? Variant.FirstOffset : static_cast<uint32_t>(OffsetPool.size());
+			Variant = FRuneVariant();
+			Variant.FirstOffset = FirstOffset;
+			Variant.NumOffsets = static_cast<uint16_t>(Def.Shape.size());
+			Variant.MinOffset = FCellPos(INT_MAX, INT_MAX);
+			Variant.MaxOffset = FCellPos(INT_MIN, INT_MIN);
+
+			for (size_t i = 0; i < Def.Shape.size(); ++i)
+			{
+				const FCellPos Offset = Orientation::Transform(Def.Shape[i], Orient);
+				if (bReuseOffsets)
+				{
+					OffsetPool[FirstOffset + i] = Offset;
+				}
+				else
+				{
+					OffsetPool.push_back(Offset);
+				}
+
+				Variant.MinOffset.X = std::min(Variant.MinOffset.X, Offset.X);
+				Variant.MinOffset.Y = std::min(Variant.MinOffset.Y, Offset.Y);
+				Variant.MaxOffset.X = std::max(Variant.MaxOffset.X, Offset.X);
+				Variant.MaxOffset.Y = std::max(Variant.MaxOffset.Y, Offset.Y);
+			}
+
+			const FCellPos Extent = Variant.MaxOffset - Variant.MinOffset + FCellPos(1, 1);
+			if (Extent.X <= 8 && Extent.Y <= 8)
+			{
+				const FCellPos* Offsets = GetOffsets(Variant);
+				for (uint16_t i = 0; i < Variant.NumOffsets; ++i)
+				{
+					const FCellPos LocalPos = Offsets[i] - Variant.MinOffset;
+					Variant.PlacementMask |= 1ull << (LocalPos.X * 8 + LocalPos.Y);
+				}
+			}
+		}
+
+		return true;
+	}
+
+	bool FRuneCatalog::Matches(const FRuneDef& Def) const
+	{
+		const FRuneEntry* Entry = Find(Def.Id);
+		if (!Entry || Entry->StatIndex != Def.StatIndex || Entry->StatValue != Def.StatValue ||
+			Entry->Variants[0].NumOffsets != Def.Shape.size())
+		{
+			return false;
+		}
+
+		// 0방향은 원래 모양 그대로
+		return std::equal(Def.Shape.begin(), Def.Shape.end(), GetOffsets(Entry->Variants[0]));
+	}
+
+	size_t FRuneCatalog::GetAllocatedSize() const
+	{
+		return Entries.capacity() * sizeof(FRuneEntry) + OffsetPool.capacity() * sizeof(FCellPos);
+	}
+}
@@ -0,0 +1,204 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ArcaneRuneInventory.h"
+#include "ArcaneRuneCatalog.h"
+#include <algorithm>
+
+namespace ArcaneCore
+{
+	namespace
+	{
+		constexpr uint32_t StatViewsDirtyBit = 1u << static_cast<int32_t>(EInventoryView::Count);
+
+		int32_t GetShapeSize(const FRuneCatalog* Catalog, RuneId Id)
+		{
+			const FRuneVariant* Variant = Catalog ? Catalog->FindVariant(Id, 0) : nullptr;
+			return Variant ? Variant->NumOffsets : 0;
+		}
+	}
+
+	FRuneInventory::FRuneInventory()
+		: Counts(MaxRuneCount, 0)
+	{
+	}
+
+	void FRuneInventory::SetCatalog(const FRuneCatalog* InCatalog)
+	{
+		Catalog = InCatalog;
+		DirtyViews = ~0u;
+	}
+
+	void FRuneInventory::Clear()
+	{
+		Owned.Clear();
+		std::fill(Counts.begin(), Counts.end(), 0);
+		NumOwned = 0;
+		MarkChanged();
+	}
+
+	uint16_t FRuneInventory::Add(RuneId Id, uint16_t Count)
+	{
+		if (Id == 0 || Id >= MaxRuneCount || Count == 0)
+		{
+			return GetCount(Id);
+		}
+
+		if (Counts[Id] == 0)
+		{
+			Owned.Add(Id);
+			++NumOwned;
+		}
+		Counts[Id] = static_cast<uint16_t>(std::min<uint32_t>(Counts[Id] + Count, UINT16_MAX));
+		MarkChanged();
+		return Counts[Id];
+	}
+
+	bool FRuneInventory::Remove(RuneId Id, uint16_t Count)
+	{
+		if (Id == 0 || Id >= MaxRuneCount || Counts[Id] < Count)
+		{
+			return false;
+		}
+
+		Counts[Id] = static_cast<uint16_t>(Counts[Id] - Count);
+		if (Counts[Id] == 0)
+		{
+			Owned.Remove(Id);
+			--NumOwned;
+		}
+		MarkChanged();
+		return true;
+	}
+
+	int32_t FRuneInventory::Remap(const FRuneIdRemap& OldRemap, const FRuneIdRemap& NewRemap)
+	{
+		const FRuneIdSet OldOwned = Owned;
+		const std::vector<uint16_t> OldCounts = Counts;
+		Clear();
+
+		int32_t NumDropped = 0;
+		OldOwned.ForEach([this, &OldRemap, &NewRemap, &OldCounts, &NumDropped](RuneId OldId)
+		{
+			const RuneId NewId = NewRemap.ToInternal(OldRemap.ToExternal(OldId));
+			if (NewId != 0)
+			{
+				Add(NewId, OldCounts[OldId]);
+			}
+			else
+			{
+				++NumDropped;
+			}
+		});
+		return NumDropped;
+	}
+
+	void FRuneInventory::MarkChanged()
+	{
+		++Revision;
+		DirtyViews = ~0u;
+	}
+
+	const std::vector<RuneId>& FRuneInventory::GetView(EInventoryView View) const
+	{
+		// 범위 밖 값은 다른 보기 캐시를 덮어쓰지 않도록 빈 보기
+		static const std::vector<RuneId> EmptyView;
+		const int32_t ViewIndex = static_cast<int32_t>(View);
+		if (ViewIndex < 0 || ViewIndex >= static_cast<int32_t>(EInventoryView::Count))
+		{
+			return EmptyView;
+		}
+
+		std::vector<RuneId>& Result = Views[ViewIndex];
+		if (!(DirtyViews & (1u << ViewIndex)))
+		{
+			return Result;
+		}
+
+		Result.clear();
+		Result.reserve(NumOwned);
+		Owned.ForEach([&Result](RuneId Id) { Result.push_back(Id); });
+
+		// ById는 비트 순서 그대로, 나머지는 안정 정렬로 같은 키끼리 ID 순서 유지
+		if (View == EInventoryView::ByStat)
+		{
+			const FRuneCatalog* InCatalog = Catalog;
+			std::stable_sort(Result.begin(), Result.end(), [InCatalog](RuneId A, RuneId B)
+			{
+				const FRuneEntry* EntryA = InCatalog ? InCatalog->Find(A) : nullptr;
+				const FRuneEntry* EntryB = InCatalog ? InCatalog->Find(B) : nullptr;
+				const int32_t StatA = EntryA ? EntryA->StatIndex : StatIndex::Count;
+				const int32_t StatB = EntryB ? EntryB->StatIndex : StatIndex::Count;
+				if (StatA != StatB)
+				{
+					// 스탯 없는 룬은 뒤로
+					return static_cast<uint32_t>(StatA) < static_cast<uint32_t>(StatB);
+				}
+				return (EntryA ? EntryA->StatValue : 0.0f) > (EntryB ? EntryB->StatValue : 0.0f);
+			});
+		}
+		else if (View == EInventoryView::ByShapeSize)
+		{
+			const FRuneCatalog* InCatalog = Catalog;
+			std::stable_sort(Result.begin(), Result.end(), [InCatalog](RuneId A, RuneId B)
+			{
+				return GetShapeSize(InCatalog, A) < GetShapeSize(InCatalog, B);
+			});
+		}
+
+		DirtyViews &= ~(1u << ViewIndex);
+		return Result;
+	}
+
+	const std::vector<RuneId>& FRuneInventory::GetStatView(int32_t InStatIndex) const
+	{
+		static const std::vector<RuneId> EmptyView;
+		if (InStatIndex < 0 || InStatIndex >= StatIndex::Count)
+		{
+			return EmptyView;
+		}
+
+		if (DirtyViews & StatViewsDirtyBit)
+		{
+			BuildStatViews();
+			DirtyViews &= ~StatViewsDirtyBit;
+		}
+		return StatViews[InStatIndex];
+	}
+
+	void FRuneInventory::BuildStatViews() const
+	{
+		for (std::vector<RuneId>& StatView : StatViews)
+		{
+			StatView.clear();
+		}
+
+		if (!Catalog)
+		{
+			return;
+		}
+
+		// ByStat 보기가 이미 스탯 -> 수치 순이므로 나눠 담기만 함
+		for (RuneId Id : GetView(EInventoryView::ByStat))
+		{
+			const FRuneEntry* Entry = Catalog->Find(Id);
+			if (Entry && Entry->StatIndex >= 0 && Entry->StatIndex < StatIndex::Count)
+			{
+				StatViews[Entry->StatIndex].push_back(Id);
+			}
+		}
+	}
+
+	size_t FRuneInventory::GetAllocatedSize() const
+	{
+		size_t Size = Counts.capacity() * sizeof(uint16_t);
+		for (const std::vector<RuneId>& View : Views)
+		{
+			Size += View.capacity() * sizeof(RuneId);
+		}
+		for (const std::vector<RuneId>& StatView : StatViews)
+		{
+			Size += StatView.capacity() * sizeof(RuneId);
+		}
+		return Size;
+	}
+}
@@ -0,0 +1,166 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ArcaneSynergy.h"
+#include "ArcaneRuneCatalog.h"
+#include <algorithm>
+
+namespace ArcaneCore
+{
+	FSynergyRuleSet::FSynergyRuleSet()
+	{
+		Clear();
+	}
+
+	int32_t FSynergyRuleSet::Compile(const std::vector<FSynergyRuleDef>& Defs, const FRuneCatalog& Catalog)
+	{
+		Clear();
+
+		for (int32_t Id = 1; Id < MaxRuneCount; ++Id)
+		{
+			if (const FRuneEntry* Entry = Catalog.Find(static_cast<RuneId>(Id)))
+			{
+				RuneStatIndices[Id] = Entry->StatIndex;
+			}
+		}
+
+		for (const FSynergyRuleDef& Def : Defs)
+		{
+			FCompiledRule NewRule;
+			NewRule.Type = Def.Type;
+			NewRule.Bonus = Def.Bonus;
+
+			const int32_t RuleIndex = static_cast<int32_t>(Rules.size());
+
+			if (Def.Type == ESynergyType::Set)
+			{
+				std::vector<RuneId> RequiredRunes = Def.RequiredRunes;
+				std::sort(RequiredRunes.begin(), RequiredRunes.end());
+				RequiredRunes.erase(std::unique(RequiredRunes.begin(), RequiredRunes.end()), RequiredRunes.end());
+				RequiredRunes.erase(std::remove(RequiredRunes.begin(), RequiredRunes.end(), RuneId(0)), RequiredRunes.end());
+				if (RequiredRunes.empty())
+				{
+					continue;
+				}
+
+				NewRule.Threshold = static_cast<int32_t>(RequiredRunes.size());
+				for (RuneId Id : RequiredRunes)
+				{
+					SetRulesByRune[Id].push_back(RuleIndex);
+				}
+			}
+			else
+			{
+				if (Def.FirstStat < 0 || Def.FirstStat >= StatIndex::Count ||
+					Def.SecondStat < 0 || Def.SecondStat >= StatIndex::Count)
+				{
+					continue;
+				}
+
+				NewRule.Threshold = std::max(1, Def.RequiredCount);
+				AdjacencyRulesByPair[GetPairKey(Def.FirstStat, Def.SecondStat)].push_back(RuleIndex);
+			}
+
+			Rules.push_back(NewRule);
+		}
+
+		return GetNumRules();
+	}
+
+	void FSynergyRuleSet::Clear()
+	{
+		Rules.clear();
+		RuneStatIndices.assign(MaxRuneCount, static_cast<int8_t>(StatIndex::None));
+		SetRulesByRune.assign(MaxRuneCount, std::vector<int32_t>());
+		AdjacencyRulesByPair.assign(StatIndex::Count * StatIndex::Count, std::vector<int32_t>());
+	}
+
+	const std::vector<int32_t>& FSynergyRuleSet::GetAdjacencyRules(int32_t StatA, int32_t StatB) const
+	{
+		static const std::vector<int32_t> EmptyRules;
+		if (StatA == StatIndex::None || StatB == StatIndex::None)
+		{
+			return EmptyRules;
+		}
+		return AdjacencyRulesByPair[GetPairKey(StatA, StatB)];
+	}
+
+	size_t FSynergyRuleSet::GetAllocatedSize() const
+	{
+		size_t Size = Rules.capacity() * sizeof(FCompiledRule) + RuneStatIndices.capacity()
+			+ (SetRulesByRune.capacity() + AdjacencyRulesByPair.capacity()) * sizeof(std::vector<int32_t>);
+		for (const std::vector<int32_t>& RuleIndices : SetRulesByRune)
+		{
+			Size += RuleIndices.capacity() * sizeof(int32_t);
+		}
+		for (const std::vector<int32_t>& RuleIndices : AdjacencyRulesByPair)
+		{
+			Size += RuleIndices.capacity() * sizeof(int32_t);
+		}
+		return Size;
+	}
+
+	int32_t FSynergyRuleSet::GetPairKey(int32_t StatA, int32_t StatB)
+	{
+		// 순서 무관하게 같은 키
+		return std::min(StatA, StatB) * StatIndex::Count + std::max(StatA, StatB);
+	}
+
+	void FSynergyState::Reset(const FSynergyRuleSet& RuleSet)
+	{
+		RuleProgress.assign(RuleSet.GetNumRules(), 0);
+		BonusStats = FStatBlock();
+		NumActiveRules = 0;
+	}
+
+	void FSynergyState::OnRunePlaced(const FSynergyRuleSet& RuleSet, RuneId Id, const RuneId* Neighbors, int32_t NumNeighbors)
+	{
+		ApplyDelta(RuleSet, Id, Neighbors, NumNeighbors, 1);
+	}
+
+	void FSynergyState::OnRuneRemoved(const FSynergyRuleSet& RuleSet, RuneId Id, const RuneId* Neighbors, int32_t NumNeighbors)
+	{
+		ApplyDelta(RuleSet, Id, Neighbors, NumNeighbors, -1);
+	}
+
+	void FSynergyState::ApplyDelta(const FSynergyRuleSet& RuleSet, RuneId Id, const RuneId* Neighbors, int32_t NumNeighbors, int32_t Delta)
+	{
+		if (RuleSet.GetNumRules() == 0)
+		{
+			return;
+		}
+
+		for (int32_t RuleIndex : RuleSet.GetSetRules(Id))
+		{
+			AdvanceRule(RuleSet, RuleIndex, Delta);
+		}
+
+		const int32_t Stat = RuleSet.GetRuneStatIndex(Id);
+		for (int32_t i = 0; i < NumNeighbors; ++i)
+		{
+			for (int32_t RuleIndex : RuleSet.GetAdjacencyRules(Stat, RuleSet.GetRuneStatIndex(Neighbors[i])))
+			{
+				AdvanceRule(RuleSet, RuleIndex, Delta);
+			}
+		}
+	}
+
+	void FSynergyState::AdvanceRule(const FSynergyRuleSet& RuleSet, int32_t RuleIndex, int32_t Delta)
+	{
+		if (RuleIndex < 0 || RuleIndex >= static_cast<int32_t>(RuleProgress.size()))
+		{
+			return;
+		}
+
+		const FSynergyRuleSet::FCompiledRule& Rule = RuleSet.GetRule(RuleIndex);
+		const bool bWasActive = RuleProgress[RuleIndex] >= Rule.Threshold;
+		RuleProgress[RuleIndex] += Delta;
+		const bool bIsActive = RuleProgress[RuleIndex] >= Rule.Threshold;
+
+		// 임계값을 넘나들 때만 보너스 가감
+		if (bIsActive != bWasActive)
+		{
+			BonusStats.AddScaled(Rule.Bonus, bIsActive ? 1.0f : -1.0f);
+			NumActiveRules += bIsActive ? 1 : -1;
+		}
+	}
+}
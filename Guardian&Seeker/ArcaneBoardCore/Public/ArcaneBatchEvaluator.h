@@ -0,0 +1,69 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ArcaneBoardCoreTypes.h"
+#include <vector>
+
+namespace ArcaneCore
+{
+	class FRuneCatalog;
+	class FBoardLayout;
+	class FSynergyRuleSet;
+
+	/**
+	 * 여러 보드를 한 버퍼에 담은 배치 입력
+	 * - 보드마다 레이아웃 인덱스와 배치 범위만 기록, 배치는 Placements에 연속 저장
+	 */
+	struct ARCANEBOARDCORE_API FBoardBatch
+	{
+		struct FBoard
+		{
+			uint32_t FirstPlacement = 0;
+			uint16_t NumPlacements = 0;
+			uint8_t LayoutIndex = 0;
+		};
+
+		std::vector<FBoard> Boards;
+		std::vector<FPlacement> Placements;
+
+		void Reserve(size_t NumBoards, size_t NumPlacements);
+		void Clear();
+
+		// 보드 하나 추가 후 인덱스 반환
+		int32_t AddBoard(uint8_t LayoutIndex, const FPlacement* InPlacements, int32_t InNumPlacements);
+
+		int32_t Num() const { return static_cast<int32_t>(Boards.size()); }
+	};
+
+	struct FBoardBatchResult
+	{
+		FBoardStats Stats;
+		int32_t ConnectedRuneCount = 0;
+
+		// 범위를 벗어나거나 겹치는 배치가 있었는지 (평가는 저장 데이터 복원과 같은 방식으로 계속)
+		bool bValid = true;
+	};
+
+	/**
+	 * 배치 평가기
+	 * - 레이아웃 목록은 LayoutIndex로 참조, 없는 레이아웃이면 결과는 bValid = false
+	 * - 작업 단위마다 FBoardState 하나를 재사용하므로 보드별 할당 없음
+	 */
+	class ARCANEBOARDCORE_API FBatchEvaluator
+	{
+	public:
+		FBatchEvaluator(const FRuneCatalog& InCatalog, const FSynergyRuleSet& InRules, const std::vector<const FBoardLayout*>& InLayouts);
+
+		// [BeginIndex, EndIndex) 구간 평가, 스레드마다 따로 호출 가능
+		void EvaluateRange(const FBoardBatch& Batch, int32_t BeginIndex, int32_t EndIndex, FBoardBatchResult* OutResults) const;
+
+		// 표준 스레드로 전체 배치 평가, NumThreads <= 0이면 하드웨어 스레드 수
+		void EvaluateParallel(const FBoardBatch& Batch, std::vector<FBoardBatchResult>& OutResults, int32_t NumThreads = 0) const;
+
+	private:
+		const FRuneCatalog& Catalog;
+		const FSynergyRuleSet& Rules;
+		std::vector<const FBoardLayout*> Layouts;
+	};
+}
@@ -0,0 +1,262 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#ifndef ARCANEBOARDCORE_API
+#define ARCANEBOARDCORE_API
+#endif
+
+/**
+ * 아케인 보드 코어 (엔진 비의존)
+ * - UObject/UE 컨테이너 없이 배치, 연결성, 스탯 계산을 수행
+ * - UE에서는 UGS_ArcaneBoardManager가 어댑터로 감싸서 사용
+ */
+namespace ArcaneCore
+{
+	// 내부 룬 인덱스 (외부 룬 ID를 FRuneIdRemap으로 조밀하게 재매핑), 0은 빈 칸
+	using RuneId = uint16_t;
+	constexpr int32_t MaxRuneCount = 1024;
+
+	// 0이 아닌 64비트 값의 가장 낮은 1비트 위치
+	inline int32_t LowestBitIndex(uint64_t Word)
+	{
+#if defined(_MSC_VER)
+		unsigned long Index;
+		_BitScanForward64(&Index, Word);
+		return static_cast<int32_t>(Index);
+#else
+		return __builtin_ctzll(Word);
+#endif
+	}
+
+	inline int32_t CountBits(uint64_t Word)
+	{
+#if defined(_MSC_VER)
+		return static_cast<int32_t>(__popcnt64(Word));
+#else
+		return __builtin_popcountll(Word);
+#endif
+	}
+
+	// 열 비트 마스크 이동, 결과 비트 i = Row 비트 (i + Shift)
+	inline uint64_t ShiftColumns(uint64_t Row, int32_t Shift)
+	{
+		if (Shift >= 64 || Shift <= -64)
+		{
+			return 0;
+		}
+		return Shift >= 0 ? Row >> Shift : Row << -Shift;
+	}
+
+	// Open 안에서 Seed 비트와 가로로 이어진 구간 전체 (Seed는 Open의 부분집합), 양방향 6단계 시프트
+	inline uint64_t FillRowSpans(uint64_t Seed, uint64_t Open)
+	{
+		uint64_t Up = Seed;
+		uint64_t Down = Seed;
+		uint64_t UpOpen = Open;
+		uint64_t DownOpen = Open;
+		for (int32_t Shift = 1; Shift < 64; Shift <<= 1)
+		{
+			Up |= UpOpen & (Up << Shift);
+			UpOpen &= UpOpen << Shift;
+			Down |= DownOpen & (Down >> Shift);
+			DownOpen &= DownOpen >> Shift;
+		}
+		return Up | Down;
+	}
+
+	// 내부 룬 인덱스 집합 (MaxRuneCount비트), 집합 연산은 워드 단위
+	struct FRuneIdSet
+	{
+		static constexpr int32_t NumWords = MaxRuneCount / 64;
+
+		uint64_t Words[NumWords] = {};
+
+		void Add(RuneId Id) { Words[Id >> 6] |= 1ull << (Id & 63); }
+		void Remove(RuneId Id) { Words[Id >> 6] &= ~(1ull << (Id & 63)); }
+		bool Contains(RuneId Id) const { return (Words[Id >> 6] >> (Id & 63)) & 1; }
+
+		void Clear()
+		{
+			for (uint64_t& Word : Words)
+			{
+				Word = 0;
+			}
+		}
+
+		int32_t Num() const
+		{
+			int32_t Count = 0;
+			for (uint64_t Word : Words)
+			{
+				Count += CountBits(Word);
+			}
+			return Count;
+		}
+
+		// this |= Other
+		void Union(const FRuneIdSet& Other)
+		{
+			for (int32_t i = 0; i < NumWords; ++i)
+			{
+				Words[i] |= Other.Words[i];
+			}
+		}
+
+		// Out = this - Other
+		void Difference(const FRuneIdSet& Other, FRuneIdSet& Out) const
+		{
+			for (int32_t i = 0; i < NumWords; ++i)
+			{
+				Out.Words[i] = Words[i] & ~Other.Words[i];
+			}
+		}
+
+		// 오름차순으로 Func(RuneId) 호출, 할당 없음
+		template <typename FuncType>
+		void ForEach(FuncType&& Func) const
+		{
+			for (int32_t i = 0; i < NumWords; ++i)
+			{
+				for (uint64_t Word = Words[i]; Word != 0; Word &= Word - 1)
+				{
+					Func(static_cast<RuneId>((i << 6) + LowestBitIndex(Word)));
+				}
+			}
+		}
+	};
+
+	// 그리드 좌표 (X = 행, Y = 열)
+	struct FCellPos
+	{
+		int32_t X = 0;
+		int32_t Y = 0;
+
+		FCellPos() = default;
+		constexpr FCellPos(int32_t InX, int32_t InY) : X(InX), Y(InY) {}
+
+		constexpr FCellPos operator+(const FCellPos& Other) const { return FCellPos(X + Other.X, Y + Other.Y); }
+		constexpr FCellPos operator-(const FCellPos& Other) const { return FCellPos(X - Other.X, Y - Other.Y); }
+		constexpr bool operator==(const FCellPos& Other) const { return X == Other.X && Y == Other.Y; }
+		constexpr bool operator!=(const FCellPos& Other) const { return !(*this == Other); }
+	};
+
+	// 상하좌우 이웃
+	constexpr FCellPos NeighborDirections[4] = { {0, 1}, {0, -1}, {1, 0}, {-1, 0} };
+
+	// 스탯 인덱스 (FGS_StatRow 필드 순서)
+	namespace StatIndex
+	{
+		constexpr int32_t None = -1;
+		constexpr int32_t HP = 0;
+		constexpr int32_t ATK = 1;
+		constexpr int32_t DEF = 2;
+		constexpr int32_t AGL = 3;
+		constexpr int32_t ATS = 4;
+		constexpr int32_t Count = 5;
+	}
+
+	// 스탯 묶음, 벡터 누적을 위해 8레인으로 패딩
+	struct alignas(32) FStatBlock
+	{
+		static constexpr int32_t NumLanes = 8;
+		float Values[NumLanes] = {};
+
+		float& operator[](int32_t Index) { return Values[Index]; }
+		float operator[](int32_t Index) const { return Values[Index]; }
+
+		FStatBlock& operator+=(const FStatBlock& Other)
+		{
+			for (int32_t i = 0; i < NumLanes; ++i)
+			{
+				Values[i] += Other.Values[i];
+			}
+			return *this;
+		}
+
+		void AddScaled(const FStatBlock& Other, float Scale)
+		{
+			for (int32_t i = 0; i < NumLanes; ++i)
+			{
+				Values[i] += Other.Values[i] * Scale;
+			}
+		}
+	};
+
+	struct FBoardStats
+	{
+		FStatBlock RuneStats;
+		FStatBlock BonusStats;
+	};
+
+	enum class EPlacementResult : uint8_t
+	{
+		Valid,
+		ReplaceExisting,
+		OutOfBounds
+	};
+
+	struct FPlacement
+	{
+		RuneId Id = 0;
+		FCellPos Pos;
+		uint8_t Orientation = 0;
+	};
+
+	/**
+	 * 룬 방향(회전/반전)
+	 * - 하위 2비트: 시계방향 90도 회전 횟수, 비트 2: 좌우 반전
+	 * - 반전을 먼저 적용한 뒤 회전 (UI 렌더 트랜스폼 순서와 동일)
+	 */
+	namespace Orientation
+	{
+		constexpr uint8_t RotationMask = 0x3;
+		constexpr uint8_t MirrorFlag = 0x4;
+		constexpr uint8_t Count = 8;
+
+		inline uint8_t Make(uint8_t Rotation, bool bMirrored)
+		{
+			return static_cast<uint8_t>((Rotation & RotationMask) | (bMirrored ? MirrorFlag : 0));
+		}
+
+		inline uint8_t GetRotation(uint8_t InOrientation)
+		{
+			return InOrientation & RotationMask;
+		}
+
+		inline bool IsMirrored(uint8_t InOrientation)
+		{
+			return (InOrientation & MirrorFlag) != 0;
+		}
+
+		// 화면 기준으로 Steps만큼 시계방향 회전 (음수면 반시계)
+		inline uint8_t Rotate(uint8_t InOrientation, int32_t Steps)
+		{
+			return Make(static_cast<uint8_t>(GetRotation(InOrientation) + Steps), IsMirrored(InOrientation));
+		}
+
+		// 화면 기준 좌우 반전 (M * R^n = R^-n * M)
+		inline uint8_t Mirror(uint8_t InOrientation)
+		{
+			return Make(static_cast<uint8_t>(4 - GetRotation(InOrientation)), !IsMirrored(InOrientation));
+		}
+
+		// 기준점 (0,0)을 중심으로 변환
+		inline FCellPos Transform(const FCellPos& Offset, uint8_t InOrientation)
+		{
+			FCellPos Result(Offset.X, IsMirrored(InOrientation) ? -Offset.Y : Offset.Y);
+			for (uint8_t i = 0; i < GetRotation(InOrientation); ++i)
+			{
+				Result = FCellPos(Result.Y, -Result.X);
+			}
+			return Result;
+		}
+	}
+}
@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ArcaneBoardCoreTypes.h"
+#include <algorithm>
+#include <vector>
+
+namespace ArcaneCore
+{
+	// 편집 기록 종류
+	enum class EBoardEditOp : uint8_t
+	{
+		// 재생 시작점, Arg = 클래스, X = 묶음 안 순서 (0이 첫 블록), Count개의 Rune 레코드가 뒤따름
+		Snapshot,
+		// Arg = 클래스
+		SetClass,
+		// RuneId/X/Y, Arg = 방향
+		Place,
+		// RuneId
+		Remove,
+		ResetAll,
+		// Arg = 클래스, Count개의 Rune 레코드가 뒤따름
+		Load,
+		// Snapshot/Load에 딸린 배치, RuneId/X/Y, Arg = 방향
+		Rune,
+		Count
+	};
+
+	// 고정 크기 레코드, 룬 ID는 외부 ID (테이블이 바뀌어도 재생 가능)
+	struct FBoardEditRecord
+	{
+		// 기록 시작부터 경과 시간 (ms)
+		uint32_t TimeMs = 0;
+		int32_t RuneId = 0;
+		int16_t X = 0;
+		int16_t Y = 0;
+		EBoardEditOp Op = EBoardEditOp::ResetAll;
+		uint8_t Arg = 0;
+		uint16_t Count = 0;
+	};
+	static_assert(sizeof(FBoardEditRecord) == 16, "FBoardEditRecord는 파일 포맷과 같은 16바이트");
+
+	/**
+	 * 보드 편집 기록 링 버퍼
+	 * - 가득 차면 가장 오래된 레코드부터 덮어씀, 기록 중 할당 없음
+	 * - 잘린 앞부분은 재생할 수 없으므로 NeedsSnapshot()이 true일 때 호출하는 쪽이 현재 보드를 Snapshot으로 남김
+	 * - 꺼내거나 저장할 때는 남아 있는 가장 오래된 Snapshot 묶음부터
+	 */
+	class ARCANEBOARDCORE_API FBoardEditLog
+	{
+	public:
+		static constexpr uint32_t FileMagic = 0x4C454241; // "ABEL"
+		static constexpr uint16_t FileVersion = 1;
+		static constexpr int32_t MinCapacity = 256;
+
+		// 0 이하면 끔
+		void Init(int32_t Capacity);
+		void Clear();
+
+		bool IsEnabled() const { return !Records.empty(); }
+		int32_t Num() const { return NumRecords; }
+		int32_t GetCapacity() const { return static_cast<int32_t>(Records.size()); }
+
+		void Add(const FBoardEditRecord& Record);
+
+		/**
+		 * 다음 편집 전에 Snapshot을 남겨야 하면 true (레코드 수 기준, 룬 블록과 묶음 자체 포함)
+		 * - 마지막 Snapshot 묶음 시작부터 용량의 1/4이 쌓이면, 묶음이 크면 묶음 크기만큼 편집이 쌓이면
+		 * - 묶음이 용량의 1/3 이하면 새 묶음을 다 쓸 때까지 이전 묶음이 남음
+		 */
+		bool NeedsSnapshot() const
+		{
+			return IsEnabled() && RecordsSinceSnapshot >= std::max(GetCapacity() / 4 - SnapshotRecords, SnapshotRecords);
+		}
+
+		// 재생 가능한 레코드를 오래된 순서로, Snapshot이 없으면 비어 있음
+		void GetReplayRecords(std::vector<FBoardEditRecord>& OutRecords) const;
+
+		// 파일 포맷: 헤더 16바이트 + 레코드 (리틀 엔디언)
+		void Serialize(std::vector<uint8_t>& OutBytes) const;
+		static bool Deserialize(const uint8_t* Data, size_t Size, std::vector<FBoardEditRecord>& OutRecords);
+
+	private:
+		std::vector<FBoardEditRecord> Records;
+		int32_t Head = 0;
+		int32_t NumRecords = 0;
+		// 마지막 Snapshot 묶음의 레코드 수 (블록 머리 + 룬), 묶음 이후 레코드 수
+		int32_t SnapshotRecords = 0;
+		int32_t RecordsSinceSnapshot = 0;
+		bool bInSnapshotGroup = false;
+	};
+}
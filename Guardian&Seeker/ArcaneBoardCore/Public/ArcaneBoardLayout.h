@@ -0,0 +1,153 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ArcaneBoardCoreTypes.h"
+#include <vector>
+
+namespace ArcaneCore
+{
+	// 레이아웃 셀 정의 (UGS_GridLayoutDataAsset::GridCells 대응)
+	struct FLayoutCellDef
+	{
+		FCellPos Pos;
+		bool bSpecial = false;
+		bool bOccupied = false;
+
+		// 특수 셀 연결 보너스 배율
+		float SourceWeight = 1.0f;
+		RuneId Rune = 0;
+	};
+
+	struct FRuneVariant;
+	class FRuneCatalog;
+
+	/**
+	 * 클래스별 보드 레이아웃 (불변)
+	 * - 바운드 기준 행 우선 인덱스
+	 * - 이웃 테이블, 행 마스크(64열 이하)는 Build에서 한 번 계산하고 쿠킹 데이터로 그대로 저장/복원
+	 * - 특수 셀은 여러 개 가능, 각각 연결 탐색의 소스 (최대 MaxSourceCells개)
+	 */
+	class ARCANEBOARDCORE_API FBoardLayout
+	{
+	public:
+		enum ECellFlags : uint8_t
+		{
+			LF_Valid	= 1 << 0,
+			LF_Special	= 1 << 1
+		};
+
+		// 소스별 대표 소스가 int8_t라 인덱스 127 미만 (셀 라벨은 소스 + 1로 uint8_t 안)
+		static constexpr int32_t MaxSourceCells = 127;
+
+		// 연결 탐색 소스 (특수 셀)
+		struct FSourceCell
+		{
+			int32_t Index = 0;
+			float Weight = 1.0f;
+		};
+
+		// 레이아웃에서 미리 점유된 셀
+		struct FInitialCell
+		{
+			int32_t Index = 0;
+			RuneId Rune = 0;
+		};
+
+		// 쿠킹 데이터, 배열은 Build 결과와 같은 배치
+		struct FCookedData
+		{
+			FCellPos Origin;
+			int32_t Width = 0;
+			int32_t Height = 0;
+			int32_t NumValidCells = 0;
+
+			const uint8_t* CellFlags = nullptr;			// Width * Height
+			const int32_t* Neighbors = nullptr;			// Width * Height * 4
+			const uint64_t* ValidRowMasks = nullptr;	// Height, 64열 이하일 때만
+			const FInitialCell* InitialCells = nullptr;
+			int32_t NumInitialCells = 0;
+			const FSourceCell* SourceCells = nullptr;
+			int32_t NumSourceCells = 0;
+
+			// 선택, [(Id * Orientation::Count + 방향) * Height + 행] 빈 보드 기준 앵커 마스크
+			const uint64_t* RuneAnchorRows = nullptr;
+			int32_t NumRuneAnchorRows = 0;
+		};
+
+		// 제한을 넘어 버린 특수 셀 수 반환 (0이면 전부 소스)
+		int32_t Build(const std::vector<FLayoutCellDef>& Cells);
+
+		// 셀별 계산 없이 복사, 크기가 맞지 않으면 false (빈 레이아웃이 됨)
+		bool InitFromCooked(const FCookedData& Data);
+
+		// 빈 보드에서 룬 하나(방향 고정)가 범위 안에 들어가는 앵커 행 마스크, 64열을 넘으면 false
+		bool ComputeRuneAnchorRows(const FRuneCatalog& Catalog, const FRuneVariant& Variant, uint64_t* OutRows) const;
+
+		// 카탈로그 전체의 앵커 마스크를 쿠킹 배치로 계산해 보관
+		void BakeRuneAnchorRows(const FRuneCatalog& Catalog);
+
+		// 보드 밖이거나 레이아웃에 없는 셀이면 -1
+		int32_t ToIndex(const FCellPos& Pos) const
+		{
+			const int32_t LocalX = Pos.X - Origin.X;
+			const int32_t LocalY = Pos.Y - Origin.Y;
+			if (LocalX < 0 || LocalY < 0 || LocalX >= Height || LocalY >= Width)
+			{
+				return -1;
+			}
+
+			const int32_t Index = LocalX * Width + LocalY;
+			return (CellFlags[Index] & LF_Valid) ? Index : -1;
+		}
+
+		FCellPos ToPos(int32_t Index) const
+		{
+			return FCellPos(Origin.X + Index / Width, Origin.Y + Index % Width);
+		}
+
+		bool IsValidCell(int32_t Index) const { return (CellFlags[Index] & LF_Valid) != 0; }
+
+		// 상하좌우 이웃 셀 인덱스 4개 (NeighborDirections 순서, 없으면 -1)
+		const int32_t* GetNeighbors(int32_t Index) const { return Neighbors.data() + Index * 4; }
+
+		// 행별 유효 셀 마스크 (비트 = 열), 64열을 넘으면 비어 있음
+		const std::vector<uint64_t>& GetValidRowMasks() const { return ValidRowMasks; }
+
+		// 구워 둔 빈 보드 앵커 마스크 (Height개), 없으면 nullptr
+		const uint64_t* FindRuneAnchorRows(RuneId Id, uint8_t InOrientation) const
+		{
+			const size_t Offset = (static_cast<size_t>(Id) * Orientation::Count + (InOrientation % Orientation::Count)) * Height;
+			return Offset + Height <= RuneAnchorRows.size() ? RuneAnchorRows.data() + Offset : nullptr;
+		}
+
+		const std::vector<uint8_t>& GetCellFlags() const { return CellFlags; }
+		const std::vector<int32_t>& GetNeighborTable() const { return Neighbors; }
+		const std::vector<uint64_t>& GetRuneAnchorRows() const { return RuneAnchorRows; }
+		bool IsSpecial(int32_t Index) const { return (CellFlags[Index] & LF_Special) != 0; }
+
+		const FCellPos& GetOrigin() const { return Origin; }
+		int32_t GetWidth() const { return Width; }
+		int32_t GetHeight() const { return Height; }
+		int32_t GetNumCells() const { return Width * Height; }
+		int32_t GetNumValidCells() const { return NumValidCells; }
+		const std::vector<FSourceCell>& GetSourceCells() const { return SourceCells; }
+		int32_t GetNumSourceCells() const { return static_cast<int32_t>(SourceCells.size()); }
+		const std::vector<FInitialCell>& GetInitialCells() const { return InitialCells; }
+
+	private:
+		FCellPos Origin;
+		int32_t Width = 0;
+		int32_t Height = 0;
+		int32_t NumValidCells = 0;
+		std::vector<uint8_t> CellFlags;
+		std::vector<FInitialCell> InitialCells;
+		std::vector<FSourceCell> SourceCells;
+		std::vector<int32_t> Neighbors;
+		std::vector<uint64_t> ValidRowMasks;
+		std::vector<uint64_t> RuneAnchorRows;
+
+		void Reset();
+		void BuildDerivedTables();
+	};
+}
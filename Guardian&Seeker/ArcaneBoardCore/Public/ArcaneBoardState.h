@@ -0,0 +1,221 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ArcaneBoardCoreTypes.h"
+#include "ArcaneSynergy.h"
+#include <vector>
+
+namespace ArcaneCore
+{
+	class FRuneCatalog;
+	struct FRuneVariant;
+	class FBoardLayout;
+
+	/**
+	 * 룬 하나(방향 고정)를 보드의 모든 앵커에 놓았을 때의 결과
+	 * - 레이아웃 바운드 안의 앵커만 다룸, 행마다 열 비트 마스크 두 개 (겹침 없음 / 범위 안)
+	 * - 룬을 들 때 한 번 만들고 커서가 움직이는 동안에는 조회만
+	 */
+	class ARCANEBOARDCORE_API FPlacementAnchorMap
+	{
+	public:
+		void Reset();
+
+		// 바운드 밖 앵커는 OutOfBounds
+		EPlacementResult Get(const FCellPos& Anchor) const;
+
+		bool IsBuiltFor(RuneId InId, uint8_t InOrientation) const { return Id != 0 && Id == InId && Orientation == InOrientation; }
+		RuneId GetRuneId() const { return Id; }
+		uint8_t GetOrientation() const { return Orientation; }
+
+		int32_t CountResult(EPlacementResult Result) const;
+
+		// 결과가 OutOfBounds가 아닌 앵커마다 Func(const FCellPos&, EPlacementResult) 호출
+		template <typename FuncType>
+		void ForEachPlaceable(FuncType&& Func) const
+		{
+			for (int32_t Row = 0; Row < Height; ++Row)
+			{
+				for (int32_t Word = 0; Word < WordsPerRow; ++Word)
+				{
+					const int32_t WordIndex = Row * WordsPerRow + Word;
+					const uint64_t FreeBits = FreeRows[WordIndex];
+					for (uint64_t Bits = InBoundsRows[WordIndex]; Bits != 0; Bits &= Bits - 1)
+					{
+						const int32_t Bit = LowestBitIndex(Bits);
+						const EPlacementResult Result = (FreeBits >> Bit) & 1 ? EPlacementResult::Valid : EPlacementResult::ReplaceExisting;
+						Func(FCellPos(Origin.X + Row, Origin.Y + (Word << 6) + Bit), Result);
+					}
+				}
+			}
+		}
+
+	private:
+		friend class FBoardState;
+
+		RuneId Id = 0;
+		uint8_t Orientation = 0;
+		FCellPos Origin;
+		int32_t Width = 0;
+		int32_t Height = 0;
+		int32_t WordsPerRow = 0;
+
+		// [행 * WordsPerRow + 워드], 비트 = 열
+		std::vector<uint64_t> InBoundsRows;
+		std::vector<uint64_t> FreeRows;
+
+		// 룬이 없는 유효 셀 행 마스크
+		std::vector<uint64_t> BoardFreeRows;
+	};
+
+	/**
+	 * 보드 하나의 런타임 상태
+	 * - 레이아웃/카탈로그/시너지 규칙은 참조만 하고 소유하지 않음
+	 * - 셀 상태는 평면 배열 (셀당 4바이트), 배치/연결된 룬은 비트셋
+	 * - 64열 이하 보드는 행 비트보드(행당 64비트)도 유지해 겹침 검사/연결 탐색을 행 단위 비트 연산으로 처리
+	 *   (비용이 전체 셀 수가 아니라 건드린 행 수에 비례, 더 넓은 보드는 셀 단위 경로)
+	 * - 특수 셀이 여러 개면 한 번의 탐색으로 모든 소스에서 연결, 서로 이어진 소스는 그룹 하나를 공유
+	 * - 배치/제거 시 시너지 진행 상태를 델타로 갱신
+	 */
+	class ARCANEBOARDCORE_API FBoardState
+	{
+	public:
+		enum ECellFlags : uint8_t
+		{
+			CF_Occupied		= 1 << 0,
+			CF_Connected	= 1 << 1
+		};
+
+		FBoardState() = default;
+
+		// 레이아웃의 초기 점유 셀을 배치 목록에 추가 (시너지에는 반영하지 않음)
+		void Reset(const FBoardLayout* InLayout, const FRuneCatalog* InCatalog, const FSynergyRuleSet* InRules);
+
+		// 레이아웃을 유지한 채 초기 상태로
+		void Clear();
+
+		EPlacementResult CheckPlacement(RuneId Id, const FCellPos& Pos, uint8_t InOrientation, std::vector<RuneId>* OutAffected = nullptr) const;
+
+		// 바운드 안 모든 앵커의 CheckPlacement 결과를 행 마스크 연산으로 한 번에 계산
+		bool BuildAnchorMap(RuneId Id, uint8_t InOrientation, FPlacementAnchorMap& Out) const;
+
+		// 겹치는 룬은 제거 후 배치, 범위를 벗어나면 false
+		bool Place(const FPlacement& Placement, std::vector<RuneId>* OutRemoved = nullptr);
+		bool Remove(RuneId Id);
+
+		// 저장 데이터 복원용, 겹침/범위 검사 없이 배치
+		void AddPlacementUnchecked(const FPlacement& Placement);
+
+		// 모든 특수 셀을 시작점으로 점유 셀을 따라 한 번에 연결 탐색
+		void UpdateConnections();
+
+		// 연결 상태가 최신이라는 가정하에 스탯 계산
+		FBoardStats ComputeStats() const;
+
+		// UpdateConnections + ComputeStats
+		FBoardStats Evaluate();
+
+		const std::vector<FPlacement>& GetPlacements() const { return Placements; }
+		const FPlacement* FindPlacement(RuneId Id) const;
+
+		const FBoardLayout* GetLayout() const { return Layout; }
+		const FRuneCatalog* GetCatalog() const { return Catalog; }
+		const FSynergyState& GetSynergyState() const { return Synergy; }
+
+		uint8_t GetCellFlags(int32_t Index) const { return CellFlags[Index]; }
+		RuneId GetRuneAt(int32_t Index) const { return CellRunes[Index]; }
+		bool IsConnectedCell(int32_t Index) const { return (CellFlags[Index] & CF_Connected) != 0; }
+
+		// 셀이 연결된 소스 그룹 (그룹에서 가장 앞선 소스 번호), 연결되지 않았으면 -1
+		int32_t GetCellSource(int32_t Index) const { return CellSources[Index] ? SourceRoots[CellSources[Index] - 1] : -1; }
+
+		// 소스(레이아웃 특수 셀 순서)별 연결된 룬, 같은 그룹의 소스는 같은 집합을 반환
+		const FRuneIdSet& GetSourceConnectedRunes(int32_t SourceIndex) const;
+		int32_t GetSourceConnectedRuneCount(int32_t SourceIndex) const;
+
+		bool IsRuneConnected(RuneId Id) const { return ConnectedRunes.Contains(Id); }
+		const FRuneIdSet& GetConnectedRunes() const { return ConnectedRunes; }
+
+		// 레이아웃 고정 셀 포함, 인벤토리와 워드 단위로 비교할 때 사용
+		const FRuneIdSet& GetPlacedRunes() const { return PlacedRunes; }
+		int32_t GetConnectedRuneCount() const { return ConnectedRuneCount; }
+
+		size_t GetAllocatedSize() const;
+
+	private:
+		const FBoardLayout* Layout = nullptr;
+		const FRuneCatalog* Catalog = nullptr;
+		const FSynergyRuleSet* Rules = nullptr;
+
+		std::vector<uint8_t> CellFlags;
+		std::vector<RuneId> CellRunes;
+		std::vector<FPlacement> Placements;
+		FRuneIdSet PlacedRunes;
+
+		FSynergyState Synergy;
+
+		FRuneIdSet ConnectedRunes;
+		int32_t ConnectedRuneCount = 0;
+
+		// 소스별 연결 결과, 대표 소스 슬롯에만 값이 있음
+		struct FSourceGroup
+		{
+			FRuneIdSet Runes;
+			int32_t RuneCount = 0;
+			uint32_t StatBits = 0;
+			float Weight = 0.0f;
+		};
+
+		// 셀 라벨 (처음 도달한 소스 + 1, 0 = 미연결), 소스별 대표 소스 (-1 = 소스 셀이 비어 있음)
+		std::vector<uint8_t> CellSources;
+		std::vector<int8_t> SourceRoots;
+		std::vector<FSourceGroup> SourceGroups;
+
+		// 행 비트보드 (비트 = 열), 64열을 넘는 보드면 비어 있음
+		std::vector<uint64_t> OccupiedRows;
+		std::vector<uint64_t> RuneRows;
+		std::vector<uint64_t> ConnectedRows;
+		std::vector<uint64_t> ScratchRows;
+
+		// 탐색용 스택, 겹친 룬 목록 재사용
+		std::vector<int32_t> ScratchStack;
+		std::vector<RuneId> ScratchRunes;
+
+		void ApplyToCells(const FPlacement& Placement, bool bOccupy);
+		void SetCellRune(int32_t CellIndex, RuneId Rune, bool bOccupy);
+		EPlacementResult CheckPlacementByRows(const FRuneVariant& Variant, const FCellPos& Pos, std::vector<RuneId>* OutAffected) const;
+		int32_t GatherNeighbors(const FPlacement& Placement, RuneId* OutNeighbors, int32_t MaxNeighbors) const;
+		void NotifySynergy(const FPlacement& Placement, bool bPlaced);
+		int32_t FindSourceRoot(int32_t Source);
+		void UpdateConnectionsByCells();
+		void UpdateConnectionsByRows();
+		void FloodRows(int32_t SeedRow, uint64_t SeedBits, int32_t& OutMinRow, int32_t& OutMaxRow);
+		void AddConnectedRune(FSourceGroup& Group, RuneId Rune) const;
+	};
+
+	// 배치 미리보기 결과
+	struct FPlacementPreview
+	{
+		bool bValid = false;
+
+		// 배치 후 스탯, 배치 후 - 현재
+		FBoardStats Stats;
+		FBoardStats StatDelta;
+
+		// 겹쳐서 빠지는 룬
+		std::vector<RuneId> Displaced;
+
+		// 연결 상태가 바뀌는 룬 (배치한 룬 포함)
+		std::vector<RuneId> NewlyConnected;
+		std::vector<RuneId> Disconnected;
+	};
+
+	/**
+	 * Base를 바꾸지 않고 배치 결과 계산
+	 * - Base를 Scratch에 복사해 배치/평가, Scratch와 Out을 재사용하면 두 번째 호출부터 할당 없음
+	 * - 이미 놓인 룬이면 기존 위치에서 뺀 뒤 배치 (재배치 미리보기)
+	 * - Base의 연결 상태가 최신이라고 가정
+	 */
+	ARCANEBOARDCORE_API bool PreviewPlacement(const FBoardState& Base, const FPlacement& Placement, FBoardState& Scratch, FPlacementPreview& Out);
+}
@@ -0,0 +1,111 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ArcaneBoardCoreTypes.h"
+#include <vector>
+
+namespace ArcaneCore
+{
+	class FBoardLayout;
+	class FRuneIdRemap;
+
+	// 적용한 보드 요약 (배치 좌표 없이 해시/룬 비트셋/스탯 합계만)
+	struct FBoardFingerprint
+	{
+		uint64_t LayoutHash = 0;
+		uint8_t LayoutIndex = 0;
+		FRuneIdSet Runes;
+		FStatBlock StatTotals;
+	};
+
+	// 셀 배치/특수 셀/고정 룬 기준 64비트 해시 (FNV-1a), 같은 레이아웃 데이터면 항상 같은 값
+	ARCANEBOARDCORE_API uint64_t HashLayout(const FBoardLayout& Layout);
+	ARCANEBOARDCORE_API uint64_t HashRuneSet(const FRuneIdSet& Runes);
+
+	/**
+	 * 카운트-민 스케치 (Depth x Width 카운터, Width는 2의 거듭제곱)
+	 * - 추정치는 실제 빈도 이상, 초과량은 전체 합의 약 e / Width 이하
+	 */
+	class ARCANEBOARDCORE_API FCountMinSketch
+	{
+	public:
+		void Init(int32_t InDepth, int32_t InWidth);
+		void Clear();
+
+		void Add(uint64_t Key, uint32_t Count = 1);
+		uint32_t Estimate(uint64_t Key) const;
+
+		int32_t GetDepth() const { return Depth; }
+		int32_t GetWidth() const { return WidthMask + 1; }
+		const std::vector<uint32_t>& GetCounters() const { return Counters; }
+
+	private:
+		friend class FBoardTelemetryAggregator;
+
+		std::vector<uint32_t> Counters;
+		int32_t Depth = 0;
+		int32_t WidthMask = 0;
+	};
+
+	/**
+	 * 보드 구성 텔레메트리 집계 (세션 길이와 무관한 고정 크기, 생성 이후 할당 없음)
+	 * - 룬별 사용 수, 룬 개수/레이아웃별 분포, 스탯 합계 log2 히스토그램
+	 * - 구성(레이아웃 + 룬 집합)과 룬 쌍 동시 사용은 카운트-민 스케치, 구성 상위 NumTopConfigs개는 후보 표로 유지
+	 * - 파일로 내보낸 뒤 Clear하면 구간 단위 집계 (스케치/히스토그램은 더해서 합칠 수 있음)
+	 */
+	class ARCANEBOARDCORE_API FBoardTelemetryAggregator
+	{
+	public:
+		static constexpr uint32_t FileMagic = 0x4D544241; // "ABTM"
+		static constexpr uint16_t FileVersion = 1;
+
+		static constexpr int32_t MaxLayouts = 16;
+		static constexpr int32_t MaxRunesPerBoard = 64;
+		static constexpr int32_t NumStatBins = 32;
+		static constexpr int32_t NumTopConfigs = 16;
+		static constexpr int32_t SketchDepth = 4;
+		static constexpr int32_t SketchWidth = 1024;
+
+		struct FTopConfig
+		{
+			uint64_t Key = 0;
+			uint32_t Estimate = 0;
+			uint8_t LayoutIndex = 0;
+			FRuneIdSet Runes;
+		};
+
+		FBoardTelemetryAggregator();
+
+		void Add(const FBoardFingerprint& Fingerprint);
+		void Clear();
+
+		uint32_t GetNumBoards() const { return NumBoards; }
+		uint32_t GetRuneUseCount(RuneId Id) const { return Id < MaxRuneCount ? RuneUseCounts[Id] : 0; }
+		uint32_t GetLayoutCount(int32_t LayoutIndex) const { return LayoutIndex >= 0 && LayoutIndex < MaxLayouts ? LayoutCounts[LayoutIndex] : 0; }
+		uint32_t GetStatBinCount(int32_t Stat, int32_t Bin) const { return StatHistograms[Stat * NumStatBins + Bin]; }
+		uint32_t EstimateConfigCount(uint64_t LayoutHash, const FRuneIdSet& Runes) const;
+		uint32_t EstimatePairCount(RuneId A, RuneId B) const;
+		const std::vector<FTopConfig>& GetTopConfigs() const { return TopConfigs; }
+
+		// 0: 1 미만, k: [2^(k-1), 2^k), 마지막 칸은 그 이상 전부
+		static int32_t GetStatBin(float Value);
+
+		// 파일 포맷: 헤더 + 외부 룬 ID 표 + 고정 크기 블록 (리틀 엔디언), Remap이 있으면 룬 ID 표 기록
+		void Serialize(const FRuneIdRemap* Remap, std::vector<uint8_t>& OutBytes) const;
+		bool Deserialize(const uint8_t* Data, size_t Size, std::vector<int32_t>* OutExternalIds = nullptr);
+
+	private:
+		static uint64_t MakeConfigKey(uint64_t LayoutHash, const FRuneIdSet& Runes);
+		void UpdateTopConfigs(uint64_t Key, uint32_t Estimate, const FBoardFingerprint& Fingerprint);
+
+		uint32_t NumBoards = 0;
+		std::vector<uint32_t> RuneUseCounts;		// MaxRuneCount
+		std::vector<uint32_t> RuneCountHistogram;	// MaxRunesPerBoard + 1, 마지막 칸은 그 이상
+		std::vector<uint32_t> LayoutCounts;			// MaxLayouts
+		std::vector<uint32_t> StatHistograms;		// StatIndex::Count * NumStatBins
+		FCountMinSketch ConfigSketch;
+		FCountMinSketch PairSketch;
+		std::vector<FTopConfig> TopConfigs;
+	};
+}
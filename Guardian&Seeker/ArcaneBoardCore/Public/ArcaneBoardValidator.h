@@ -0,0 +1,35 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ArcaneBoardCoreTypes.h"
+
+namespace ArcaneCore
+{
+	class FBoardState;
+
+	enum class EValidationResult : uint8_t
+	{
+		Accepted,
+		UnknownRune,
+		DuplicateRune,
+		NotOwned,
+		OutOfBounds,
+		Overlapping
+	};
+
+	struct FValidationDiff
+	{
+		int32_t NumKept = 0;
+		int32_t NumRemoved = 0;
+		int32_t NumAdded = 0;
+	};
+
+	/**
+	 * 제출된 전체 배치를 이전에 검증된 보드 상태와 비교해 바뀐 룬만 검증/적용
+	 * - 그대로인 룬은 다시 검사하지 않음, 새로 놓인 룬만 소유/범위/겹침 검사
+	 * - 실패하면 State는 호출 전 상태로 되돌림 (연결 상태는 호출자가 다시 평가)
+	 */
+	ARCANEBOARDCORE_API EValidationResult ApplySubmittedBoard(FBoardState& State, const FPlacement* Placements, int32_t NumPlacements,
+		const FRuneIdSet& OwnedRunes, FValidationDiff* OutDiff = nullptr);
+}
@@ -0,0 +1,119 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ArcaneBoardCoreTypes.h"
+#include <vector>
+
+namespace ArcaneCore
+{
+	// 카탈로그에 등록할 룬 정의 (Shape 순서 = 조각 텍스처 순서)
+	struct FRuneDef
+	{
+		RuneId Id = 0;
+		int32_t StatIndex = StatIndex::None;
+		float StatValue = 0.0f;
+		std::vector<FCellPos> Shape;
+	};
+
+	// 방향별로 미리 계산된 모양, 오프셋은 카탈로그 풀에 연속 저장
+	struct FRuneVariant
+	{
+		uint32_t FirstOffset = 0;
+		uint16_t NumOffsets = 0;
+		FCellPos MinOffset;
+		FCellPos MaxOffset;
+
+		// MinOffset 기준 8x8 배치 마스크 (비트 = 행 * 8 + 열), 8칸을 넘는 모양이면 0
+		uint64_t PlacementMask = 0;
+	};
+
+	struct FRuneEntry
+	{
+		RuneId Id = 0;
+		bool bValid = false;
+		int8_t StatIndex = StatIndex::None;
+		float StatValue = 0.0f;
+
+		// StatValue를 해당 스탯 레인에만 넣은 행 (스탯 합산을 레인 단위 덧셈으로)
+		FStatBlock StatRow;
+
+		FRuneVariant Variants[Orientation::Count];
+	};
+
+	/**
+	 * 외부 룬 ID (데이터 테이블/세이브) <-> 내부 인덱스
+	 * - 외부 ID를 정렬해 1부터 조밀하게 부여, 같은 데이터면 어디서 만들어도 같은 인덱스
+	 * - 코어 구조(셀 평면, 비트셋, 카탈로그)는 내부 인덱스로만 동작
+	 */
+	class ARCANEBOARDCORE_API FRuneIdRemap
+	{
+	public:
+		FRuneIdRemap();
+
+		// 0 이하/중복 ID는 무시, MaxRuneCount - 1개를 넘는 ID는 버림, 등록된 수 반환
+		int32_t Build(std::vector<int32_t> InExternalIds);
+		void Clear();
+
+		// 없는 ID면 0
+		RuneId ToInternal(int32_t ExternalId) const;
+
+		int32_t ToExternal(RuneId Id) const
+		{
+			return Id < ExternalIds.size() ? ExternalIds[Id] : 0;
+		}
+
+		int32_t Num() const { return static_cast<int32_t>(ExternalIds.size()) - 1; }
+
+		// 마지막 Build에서 MaxRuneCount - 1개 제한으로 버린 ID 수 (0이 아니면 테이블 오류)
+		int32_t GetNumDropped() const { return NumDropped; }
+		size_t GetAllocatedSize() const { return ExternalIds.capacity() * sizeof(int32_t); }
+
+	private:
+		// [0]은 빈 칸, 이후 오름차순
+		std::vector<int32_t> ExternalIds;
+		int32_t NumDropped = 0;
+	};
+
+	/**
+	 * 룬 카탈로그
+	 * - 내부 인덱스로 바로 인덱싱, 등록 시 8방향 모양과 배치 마스크를 한 번만 계산
+	 */
+	class ARCANEBOARDCORE_API FRuneCatalog
+	{
+	public:
+		FRuneCatalog();
+
+		void Clear();
+
+		// 이미 있는 룬이면 덮어씀, 칸 수가 같으면 오프셋 풀 자리를 재사용 (에디터 핫 리로드)
+		bool AddRune(const FRuneDef& Def);
+
+		// 등록된 룬과 스탯/모양이 같은지 (모양은 칸 순서까지 비교, 조각 텍스처 순서와 같아야 하므로)
+		bool Matches(const FRuneDef& Def) const;
+
+		const FRuneEntry* Find(RuneId Id) const
+		{
+			return Id < Entries.size() && Entries[Id].bValid ? &Entries[Id] : nullptr;
+		}
+
+		const FRuneVariant* FindVariant(RuneId Id, uint8_t InOrientation) const
+		{
+			const FRuneEntry* Entry = Find(Id);
+			return Entry ? &Entry->Variants[InOrientation % Orientation::Count] : nullptr;
+		}
+
+		const FCellPos* GetOffsets(const FRuneVariant& Variant) const
+		{
+			return OffsetPool.data() + Variant.FirstOffset;
+		}
+
+		int32_t Num() const { return NumRunes; }
+		size_t GetAllocatedSize() const;
+
+	private:
+		std::vector<FRuneEntry> Entries;
+		std::vector<FCellPos> OffsetPool;
+		int32_t NumRunes = 0;
+	};
+}
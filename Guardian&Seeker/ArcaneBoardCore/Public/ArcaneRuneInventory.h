@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ArcaneBoardCoreTypes.h"
+#include <vector>
+
+namespace ArcaneCore
+{
+	class FRuneCatalog;
+	class FRuneIdRemap;
+
+	// 인벤토리 정렬 보기
+	enum class EInventoryView : uint8_t
+	{
+		ById,
+		// 스탯 종류 -> 수치 내림차순
+		ByStat,
+		// 모양 칸 수 오름차순
+		ByShapeSize,
+		Count
+	};
+
+	/**
+	 * 룬 인벤토리 (내부 인덱스 기준)
+	 * - 보유 여부는 비트셋, 수량은 내부 인덱스로 바로 인덱싱하는 배열
+	 * - 정렬/필터 보기는 필요할 때 한 번 만들고 인벤토리가 바뀔 때만 무효화
+	 * - 반환한 보기 참조는 다음 변경 전까지 유효
+	 */
+	class ARCANEBOARDCORE_API FRuneInventory
+	{
+	public:
+		FRuneInventory();
+
+		// 정렬 보기에 쓸 카탈로그, 없으면 ById 외 보기는 비어 있음
+		void SetCatalog(const FRuneCatalog* InCatalog);
+
+		void Clear();
+
+		// 추가 후 수량 반환
+		uint16_t Add(RuneId Id, uint16_t Count = 1);
+
+		// 수량이 모자라면 false, 0이 되면 보유 해제
+		bool Remove(RuneId Id, uint16_t Count = 1);
+
+		// 룬 테이블 재매핑 후 외부 ID 기준으로 다시 채움, 새 테이블에 없어 뺀 룬 종류 수 반환
+		int32_t Remap(const FRuneIdRemap& OldRemap, const FRuneIdRemap& NewRemap);
+
+		uint16_t GetCount(RuneId Id) const { return Id < Counts.size() ? Counts[Id] : 0; }
+		bool Contains(RuneId Id) const { return Owned.Contains(Id); }
+
+		// 보유한 룬 종류 수
+		int32_t Num() const { return NumOwned; }
+
+		const FRuneIdSet& GetOwned() const { return Owned; }
+
+		// 보유했지만 Placed에 없는 룬, 워드 단위 연산
+		void GetUnplaced(const FRuneIdSet& Placed, FRuneIdSet& OutUnplaced) const
+		{
+			Owned.Difference(Placed, OutUnplaced);
+		}
+
+		// 오름차순 순회, 할당 없음
+		template <typename FuncType>
+		void ForEach(FuncType&& Func) const
+		{
+			Owned.ForEach(Func);
+		}
+
+		// 알 수 없는 보기면 빈 목록
+		const std::vector<RuneId>& GetView(EInventoryView View) const;
+
+		// 해당 스탯을 주는 룬만, 수치 내림차순
+		const std::vector<RuneId>& GetStatView(int32_t InStatIndex) const;
+
+		// 변경될 때마다 증가, UI 쪽 캐시 비교용
+		uint32_t GetRevision() const { return Revision; }
+
+		size_t GetAllocatedSize() const;
+
+	private:
+		const FRuneCatalog* Catalog = nullptr;
+
+		FRuneIdSet Owned;
+		std::vector<uint16_t> Counts;
+		int32_t NumOwned = 0;
+		uint32_t Revision = 0;
+
+		// 보기 캐시, DirtyViews 비트 = EInventoryView, StatIndex::Count 비트 = 스탯별 보기
+		mutable std::vector<RuneId> Views[static_cast<int32_t>(EInventoryView::Count)];
+		mutable std::vector<RuneId> StatViews[StatIndex::Count];
+		mutable uint32_t DirtyViews = ~0u;
+
+		void MarkChanged();
+		void BuildStatViews() const;
+	};
+}
@@ -0,0 +1,96 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ArcaneBoardCoreTypes.h"
+#include <vector>
+
+namespace ArcaneCore
+{
+	class FRuneCatalog;
+
+	enum class ESynergyType : uint8_t
+	{
+		Adjacency,
+		Set
+	};
+
+	/**
+	 * 시너지 규칙 정의
+	 * - Adjacency: FirstStat 룬과 SecondStat 룬이 맞닿은 쌍이 RequiredCount개 이상이면 보너스
+	 * - Set: RequiredRunes가 모두 보드에 배치되면 보너스
+	 */
+	struct FSynergyRuleDef
+	{
+		ESynergyType Type = ESynergyType::Adjacency;
+		int32_t FirstStat = StatIndex::None;
+		int32_t SecondStat = StatIndex::None;
+		int32_t RequiredCount = 1;
+		std::vector<RuneId> RequiredRunes;
+		FStatBlock Bonus;
+	};
+
+	/**
+	 * 로드 시점에 인덱싱된 시너지 규칙 (불변)
+	 * - Set 규칙: 룬 ID -> 규칙 목록
+	 * - Adjacency 규칙: (스탯, 스탯) 쌍 -> 규칙 목록
+	 */
+	class ARCANEBOARDCORE_API FSynergyRuleSet
+	{
+	public:
+		struct FCompiledRule
+		{
+			ESynergyType Type = ESynergyType::Adjacency;
+			int32_t Threshold = 1;
+			FStatBlock Bonus;
+		};
+
+		FSynergyRuleSet();
+
+		// 규칙 정의가 잘못된 경우(알 수 없는 스탯, 빈 세트) 해당 규칙은 건너뛰고 개수 반환
+		int32_t Compile(const std::vector<FSynergyRuleDef>& Defs, const FRuneCatalog& Catalog);
+		void Clear();
+
+		int32_t GetNumRules() const { return static_cast<int32_t>(Rules.size()); }
+		const FCompiledRule& GetRule(int32_t RuleIndex) const { return Rules[RuleIndex]; }
+
+		int32_t GetRuneStatIndex(RuneId Id) const { return RuneStatIndices[Id]; }
+		const std::vector<int32_t>& GetSetRules(RuneId Id) const { return SetRulesByRune[Id]; }
+		const std::vector<int32_t>& GetAdjacencyRules(int32_t StatA, int32_t StatB) const;
+
+		size_t GetAllocatedSize() const;
+
+	private:
+		std::vector<FCompiledRule> Rules;
+		std::vector<int8_t> RuneStatIndices;
+		std::vector<std::vector<int32_t>> SetRulesByRune;
+		std::vector<std::vector<int32_t>> AdjacencyRulesByPair;
+
+		static int32_t GetPairKey(int32_t StatA, int32_t StatB);
+	};
+
+	/**
+	 * 보드 하나의 시너지 진행 상태
+	 * - 배치/제거 델타만 받아 임계값을 넘은 규칙의 보너스만 가감
+	 */
+	class ARCANEBOARDCORE_API FSynergyState
+	{
+	public:
+		void Reset(const FSynergyRuleSet& RuleSet);
+
+		// Neighbors: 해당 룬과 맞닿은 (자신 제외) 배치된 룬 목록, 중복 없음
+		void OnRunePlaced(const FSynergyRuleSet& RuleSet, RuneId Id, const RuneId* Neighbors, int32_t NumNeighbors);
+		void OnRuneRemoved(const FSynergyRuleSet& RuleSet, RuneId Id, const RuneId* Neighbors, int32_t NumNeighbors);
+
+		const FStatBlock& GetBonusStats() const { return BonusStats; }
+		int32_t GetNumActiveRules() const { return NumActiveRules; }
+
+	private:
+		std::vector<int32_t> RuleProgress;
+		FStatBlock BonusStats;
+		int32_t NumActiveRules = 0;
+
+		void ApplyDelta(const FSynergyRuleSet& RuleSet, RuneId Id, const RuneId* Neighbors, int32_t NumNeighbors, int32_t Delta);
+		void AdvanceRule(const FSynergyRuleSet& RuleSet, int32_t RuleIndex, int32_t Delta);
+	};
+}
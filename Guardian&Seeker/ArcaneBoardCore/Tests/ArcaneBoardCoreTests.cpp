@@ -0,0 +1,1074 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ArcaneBatchEvaluator.h"
+#include "ArcaneBoardCoreTypes.h"
+#include "ArcaneBoardEditLog.h"
+#include "ArcaneBoardLayout.h"
+#include "ArcaneBoardState.h"
+#include "ArcaneBoardTelemetry.h"
+#include "ArcaneBoardValidator.h"
+#include "ArcaneRuneCatalog.h"
+#include "ArcaneRuneInventory.h"
+#include "ArcaneSynergy.h"
+
+#include <cmath>
+#include <cstdio>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace ArcaneCore;
+
+namespace
+{
+	struct FTestCase
+	{
+		const char* Name;
+		std::function<void()> Body;
+	};
+
+	std::vector<FTestCase>& GetTestCases()
+	{
+		static std::vector<FTestCase> TestCases;
+		return TestCases;
+	}
+
+	int32_t NumFailures = 0;
+
+	struct FTestRegistrar
+	{
+		FTestRegistrar(const char* Name, std::function<void()> Body)
+		{
+			GetTestCases().push_back({ Name, std::move(Body) });
+		}
+	};
+}
+
+#define ARCANE_TEST(Name) \
+	static void Name(); \
+	static FTestRegistrar Name##_Registrar(#Name, &Name); \
+	static void Name()
+
+#define ARCANE_EXPECT(Expr) \
+	do \
+	{ \
+		if (!(Expr)) \
+		{ \
+			std::printf("  %s:%d: expected %s\n", __FILE__, __LINE__, #Expr); \
+			++NumFailures; \
+		} \
+	} while (0)
+
+#define ARCANE_EXPECT_NEAR(A, B) ARCANE_EXPECT(std::fabs((A) - (B)) < 1e-4f)
+
+namespace
+{
+	// 3x3 보드, (1,1)이 특수 셀
+	std::vector<FLayoutCellDef> MakeSquareLayout(int32_t Size, const FCellPos& SpecialPos)
+	{
+		std::vector<FLayoutCellDef> Cells;
+		for (int32_t X = 0; X < Size; ++X)
+		{
+			for (int32_t Y = 0; Y < Size; ++Y)
+			{
+				FLayoutCellDef Cell;
+				Cell.Pos = FCellPos(X, Y);
+				Cell.bSpecial = (Cell.Pos == SpecialPos);
+				Cells.push_back(Cell);
+			}
+		}
+		return Cells;
+	}
+
+	FRuneDef MakeRune(RuneId Id, int32_t Stat, float Value, std::vector<FCellPos> Shape)
+	{
+		FRuneDef Def;
+		Def.Id = Id;
+		Def.StatIndex = Stat;
+		Def.StatValue = Value;
+		Def.Shape = std::move(Shape);
+		return Def;
+	}
+
+	struct FTestBoard
+	{
+		FRuneCatalog Catalog;
+		FBoardLayout Layout;
+		FSynergyRuleSet Rules;
+		FBoardState Board;
+
+		explicit FTestBoard(const std::vector<FSynergyRuleDef>& RuleDefs = {})
+		{
+			Catalog.AddRune(MakeRune(1, StatIndex::HP, 10.0f, { {0, 0} }));
+			Catalog.AddRune(MakeRune(2, StatIndex::ATK, 5.0f, { {0, 0}, {0, 1} }));
+			Catalog.AddRune(MakeRune(3, StatIndex::DEF, 3.0f, { {0, 0}, {1, 0}, {1, 1} }));
+			Catalog.AddRune(MakeRune(4, StatIndex::HP, 2.0f, { {0, 0} }));
+
+			Layout.Build(MakeSquareLayout(3, FCellPos(1, 1)));
+			Rules.Compile(RuleDefs, Catalog);
+			Board.Reset(&Layout, &Catalog, &Rules);
+		}
+	};
+}
+
+ARCANE_TEST(OrientationRoundTrip)
+{
+	for (uint8_t Orient = 0; Orient < Orientation::Count; ++Orient)
+	{
+		ARCANE_EXPECT(Orientation::Rotate(Orient, 4) == Orient);
+		ARCANE_EXPECT(Orientation::Mirror(Orientation::Mirror(Orient)) == Orient);
+
+		// 회전 후 역회전하면 원래 좌표
+		const FCellPos Offset(2, 1);
+		const FCellPos Rotated = Orientation::Transform(Offset, Orient);
+		const uint8_t Back = Orientation::Rotate(Orient, -1);
+		ARCANE_EXPECT(Orientation::Transform(Offset, Orientation::Rotate(Back, 1)) == Rotated);
+	}
+
+	ARCANE_EXPECT(Orientation::Transform(FCellPos(0, 1), Orientation::Make(1, false)) == FCellPos(1, 0));
+	ARCANE_EXPECT(Orientation::Transform(FCellPos(0, 1), Orientation::Make(0, true)) == FCellPos(0, -1));
+}
+
+ARCANE_TEST(CatalogPrecomputesVariants)
+{
+	FRuneCatalog Catalog;
+	ARCANE_EXPECT(!Catalog.AddRune(MakeRune(0, StatIndex::HP, 1.0f, { {0, 0} })));
+	ARCANE_EXPECT(Catalog.AddRune(MakeRune(7, StatIndex::ATK, 1.0f, { {0, 0}, {0, 1}, {1, 0} })));
+	ARCANE_EXPECT(Catalog.Num() == 1);
+	ARCANE_EXPECT(Catalog.Find(8) == nullptr);
+
+	const FRuneVariant* Identity = Catalog.FindVariant(7, 0);
+	ARCANE_EXPECT(Identity != nullptr);
+	ARCANE_EXPECT(Identity->NumOffsets == 3);
+	ARCANE_EXPECT(Identity->PlacementMask == ((1ull << 0) | (1ull << 1) | (1ull << 8)));
+
+	const FRuneVariant* Rotated = Catalog.FindVariant(7, Orientation::Make(1, false));
+	const FCellPos* Offsets = Catalog.GetOffsets(*Rotated);
+	ARCANE_EXPECT(Offsets[1] == FCellPos(1, 0));
+	ARCANE_EXPECT(Offsets[2] == FCellPos(0, -1));
+	ARCANE_EXPECT(Rotated->MinOffset == FCellPos(0, -1));
+}
+
+ARCANE_TEST(CatalogUpdatesRuneInPlace)
+{
+	FRuneCatalog Catalog;
+	Catalog.AddRune(MakeRune(1, StatIndex::HP, 10.0f, { {0, 0}, {0, 1} }));
+	Catalog.AddRune(MakeRune(2, StatIndex::ATK, 5.0f, { {0, 0} }));
+	const size_t AllocatedSize = Catalog.GetAllocatedSize();
+
+	ARCANE_EXPECT(Catalog.Matches(MakeRune(1, StatIndex::HP, 10.0f, { {0, 0}, {0, 1} })));
+	ARCANE_EXPECT(!Catalog.Matches(MakeRune(1, StatIndex::HP, 12.0f, { {0, 0}, {0, 1} })));
+	ARCANE_EXPECT(!Catalog.Matches(MakeRune(1, StatIndex::HP, 10.0f, { {0, 0}, {1, 0} })));
+	ARCANE_EXPECT(!Catalog.Matches(MakeRune(3, StatIndex::HP, 10.0f, { {0, 0} })));
+
+	// 칸 수가 같으면 오프셋 풀을 늘리지 않고 덮어씀
+	ARCANE_EXPECT(Catalog.AddRune(MakeRune(1, StatIndex::DEF, 4.0f, { {0, 0}, {1, 0} })));
+	ARCANE_EXPECT(Catalog.Num() == 2 && Catalog.GetAllocatedSize() == AllocatedSize);
+	ARCANE_EXPECT(Catalog.Matches(MakeRune(1, StatIndex::DEF, 4.0f, { {0, 0}, {1, 0} })));
+	ARCANE_EXPECT(Catalog.Find(1)->StatRow[StatIndex::DEF] == 4.0f && Catalog.Find(1)->StatRow[StatIndex::HP] == 0.0f);
+	ARCANE_EXPECT(Catalog.FindVariant(1, Orientation::Make(1, false))->MaxOffset == FCellPos(0, 0));
+
+	// 다른 룬의 오프셋은 그대로
+	ARCANE_EXPECT(Catalog.GetOffsets(*Catalog.FindVariant(2, 0))[0] == FCellPos(0, 0));
+
+	ARCANE_EXPECT(Catalog.AddRune(MakeRune(1, StatIndex::DEF, 4.0f, { {0, 0}, {1, 0}, {2, 0} })));
+	ARCANE_EXPECT(Catalog.FindVariant(1, 0)->NumOffsets == 3 && Catalog.Num() == 2);
+}
+
+ARCANE_TEST(RuneIdRemapIsDense)
+{
+	FRuneIdRemap Remap;
+	ARCANE_EXPECT(Remap.Build({ 70001, 12, 0, 500, 12, -3 }) == 3);
+	ARCANE_EXPECT(Remap.ToInternal(12) == 1);
+	ARCANE_EXPECT(Remap.ToInternal(500) == 2);
+	ARCANE_EXPECT(Remap.ToInternal(70001) == 3);
+	ARCANE_EXPECT(Remap.ToInternal(13) == 0);
+	ARCANE_EXPECT(Remap.ToInternal(0) == 0);
+	ARCANE_EXPECT(Remap.ToExternal(3) == 70001);
+	ARCANE_EXPECT(Remap.ToExternal(4) == 0);
+	ARCANE_EXPECT(Remap.GetNumDropped() == 0);
+
+	// 내부 인덱스 상한을 넘는 ID는 버림
+	std::vector<int32_t> ManyIds;
+	for (int32_t i = 1; i <= MaxRuneCount + 10; ++i)
+	{
+		ManyIds.push_back(i * 1000);
+	}
+	ARCANE_EXPECT(Remap.Build(ManyIds) == MaxRuneCount - 1);
+	ARCANE_EXPECT(Remap.GetNumDropped() == 11);
+	ARCANE_EXPECT(Remap.ToInternal((MaxRuneCount - 1) * 1000) == MaxRuneCount - 1);
+	ARCANE_EXPECT(Remap.ToInternal(MaxRuneCount * 1000) == 0);
+
+	FRuneCatalog Catalog;
+	ARCANE_EXPECT(Catalog.AddRune(MakeRune(MaxRuneCount - 1, StatIndex::HP, 1.0f, { {0, 0} })));
+	ARCANE_EXPECT(Catalog.Find(MaxRuneCount - 1) != nullptr);
+	ARCANE_EXPECT(Catalog.Find(5) == nullptr);
+}
+
+ARCANE_TEST(LayoutIndexing)
+{
+	std::vector<FLayoutCellDef> Cells = MakeSquareLayout(3, FCellPos(2, 0));
+	Cells.erase(Cells.begin() + 4);
+
+	FBoardLayout Layout;
+	Layout.Build(Cells);
+	ARCANE_EXPECT(Layout.GetNumValidCells() == 8);
+	ARCANE_EXPECT(Layout.ToIndex(FCellPos(1, 1)) == -1);
+	ARCANE_EXPECT(Layout.ToIndex(FCellPos(-1, 0)) == -1);
+	ARCANE_EXPECT(Layout.ToIndex(FCellPos(0, 3)) == -1);
+	ARCANE_EXPECT(Layout.ToPos(Layout.ToIndex(FCellPos(2, 1))) == FCellPos(2, 1));
+	ARCANE_EXPECT(Layout.GetNumSourceCells() == 1);
+	ARCANE_EXPECT(Layout.GetSourceCells()[0].Index == Layout.ToIndex(FCellPos(2, 0)));
+}
+
+ARCANE_TEST(CookedLayoutRoundTrip)
+{
+	FTestBoard Test;
+
+	// (2,2) 구멍, (0,0) 고정 룬
+	std::vector<FLayoutCellDef> Cells = MakeSquareLayout(3, FCellPos(1, 1));
+	Cells.erase(Cells.begin() + 8);
+	Cells[0].bOccupied = true;
+	Cells[0].Rune = 4;
+
+	FBoardLayout Source;
+	Source.Build(Cells);
+	Source.BakeRuneAnchorRows(Test.Catalog);
+
+	FBoardLayout::FCookedData Data;
+	Data.Origin = Source.GetOrigin();
+	Data.Width = Source.GetWidth();
+	Data.Height = Source.GetHeight();
+	Data.NumValidCells = Source.GetNumValidCells();
+	Data.CellFlags = Source.GetCellFlags().data();
+	Data.Neighbors = Source.GetNeighborTable().data();
+	Data.ValidRowMasks = Source.GetValidRowMasks().data();
+	Data.InitialCells = Source.GetInitialCells().data();
+	Data.NumInitialCells = static_cast<int32_t>(Source.GetInitialCells().size());
+	Data.SourceCells = Source.GetSourceCells().data();
+	Data.NumSourceCells = Source.GetNumSourceCells();
+	Data.RuneAnchorRows = Source.GetRuneAnchorRows().data();
+	Data.NumRuneAnchorRows = static_cast<int32_t>(Source.GetRuneAnchorRows().size());
+
+	FBoardLayout Cooked;
+	ARCANE_EXPECT(Cooked.InitFromCooked(Data));
+	ARCANE_EXPECT(Cooked.GetNumValidCells() == 8);
+	ARCANE_EXPECT(Cooked.ToIndex(FCellPos(2, 2)) < 0);
+	ARCANE_EXPECT(Cooked.GetNumSourceCells() == 1);
+	ARCANE_EXPECT(Cooked.GetSourceCells()[0].Index == Source.GetSourceCells()[0].Index);
+	ARCANE_EXPECT(Cooked.GetInitialCells().size() == 1);
+	ARCANE_EXPECT(Cooked.GetNeighbors(Cooked.ToIndex(FCellPos(2, 1)))[0] == -1);
+
+	// 구운 앵커 마스크와 상태 기반 검사가 일치
+	FBoardState Board;
+	Board.Reset(&Cooked, &Test.Catalog, &Test.Rules);
+	FPlacementAnchorMap Anchors;
+	for (uint8_t Orient = 0; Orient < Orientation::Count; ++Orient)
+	{
+		ARCANE_EXPECT(Cooked.FindRuneAnchorRows(3, Orient) != nullptr);
+		ARCANE_EXPECT(Board.BuildAnchorMap(3, Orient, Anchors));
+		for (int32_t i = 0; i < Cooked.GetNumCells(); ++i)
+		{
+			ARCANE_EXPECT(Anchors.Get(Cooked.ToPos(i)) == Board.CheckPlacement(3, Cooked.ToPos(i), Orient));
+		}
+	}
+
+	Data.Neighbors = nullptr;
+	ARCANE_EXPECT(!Cooked.InitFromCooked(Data));
+	ARCANE_EXPECT(Cooked.GetNumCells() == 0);
+}
+
+ARCANE_TEST(PlacementResults)
+{
+	FTestBoard Test;
+	FBoardState& Board = Test.Board;
+
+	ARCANE_EXPECT(Board.CheckPlacement(2, FCellPos(0, 0), 0) == EPlacementResult::Valid);
+	ARCANE_EXPECT(Board.CheckPlacement(2, FCellPos(0, 2), 0) == EPlacementResult::OutOfBounds);
+	ARCANE_EXPECT(Board.CheckPlacement(9, FCellPos(0, 0), 0) == EPlacementResult::OutOfBounds);
+
+	ARCANE_EXPECT(Board.Place({ 2, FCellPos(0, 0), 0 }));
+	ARCANE_EXPECT(!Board.Place({ 3, FCellPos(2, 2), 0 }));
+
+	std::vector<RuneId> Affected;
+	ARCANE_EXPECT(Board.CheckPlacement(3, FCellPos(0, 1), 0, &Affected) == EPlacementResult::ReplaceExisting);
+	ARCANE_EXPECT(Affected.size() == 1 && Affected[0] == 2);
+
+	std::vector<RuneId> Removed;
+	ARCANE_EXPECT(Board.Place({ 3, FCellPos(0, 1), 0 }, &Removed));
+	ARCANE_EXPECT(Removed.size() == 1 && Removed[0] == 2);
+	ARCANE_EXPECT(Board.GetPlacements().size() == 1);
+	ARCANE_EXPECT(Board.GetRuneAt(Test.Layout.ToIndex(FCellPos(0, 0))) == 0);
+	ARCANE_EXPECT(Board.GetRuneAt(Test.Layout.ToIndex(FCellPos(1, 2))) == 3);
+
+	ARCANE_EXPECT(Board.Remove(3));
+	ARCANE_EXPECT(!Board.Remove(3));
+	ARCANE_EXPECT(Board.GetPlacements().empty());
+}
+
+ARCANE_TEST(RotatedPlacement)
+{
+	FTestBoard Test;
+
+	// 가로 2칸 룬을 90도 회전하면 세로 2칸
+	ARCANE_EXPECT(Test.Board.CheckPlacement(2, FCellPos(2, 0), 0) == EPlacementResult::Valid);
+	ARCANE_EXPECT(Test.Board.CheckPlacement(2, FCellPos(2, 0), Orientation::Make(1, false)) == EPlacementResult::OutOfBounds);
+	ARCANE_EXPECT(Test.Board.Place({ 2, FCellPos(1, 0), Orientation::Make(1, false) }));
+	ARCANE_EXPECT(Test.Board.GetRuneAt(Test.Layout.ToIndex(FCellPos(2, 0))) == 2);
+}
+
+ARCANE_TEST(ConnectivityAndStats)
+{
+	FTestBoard Test;
+	FBoardState& Board = Test.Board;
+
+	// 특수 셀이 비어 있으면 연결 없음
+	Board.Place({ 1, FCellPos(0, 0), 0 });
+	FBoardStats Stats = Board.Evaluate();
+	ARCANE_EXPECT(Board.GetConnectedRuneCount() == 0);
+	ARCANE_EXPECT_NEAR(Stats.RuneStats[StatIndex::HP], 10.0f);
+	ARCANE_EXPECT_NEAR(Stats.BonusStats[StatIndex::HP], 0.0f);
+
+	// (1,1)-(1,2) 배치로 특수 셀 점유, (0,0)은 떨어져 있음
+	Board.Place({ 2, FCellPos(1, 1), 0 });
+	Board.Place({ 4, FCellPos(0, 2), 0 });
+	Stats = Board.Evaluate();
+	ARCANE_EXPECT(Board.GetConnectedRuneCount() == 2);
+	ARCANE_EXPECT(Board.IsRuneConnected(2));
+	ARCANE_EXPECT(Board.IsRuneConnected(4));
+	ARCANE_EXPECT(!Board.IsRuneConnected(1));
+	ARCANE_EXPECT_NEAR(Stats.RuneStats[StatIndex::HP], 12.0f);
+	ARCANE_EXPECT_NEAR(Stats.RuneStats[StatIndex::ATK], 5.0f);
+	ARCANE_EXPECT_NEAR(Stats.BonusStats[StatIndex::HP], 2.0f);
+	ARCANE_EXPECT_NEAR(Stats.BonusStats[StatIndex::ATK], 2.0f);
+
+	// (0,1)을 채우면 (0,0)까지 연결
+	Board.Place({ 3, FCellPos(0, 1), Orientation::Make(0, true) });
+	Board.Evaluate();
+	ARCANE_EXPECT(Board.IsRuneConnected(1));
+	ARCANE_EXPECT(Board.IsConnectedCell(Test.Layout.ToIndex(FCellPos(0, 0))));
+
+	Board.Clear();
+	Stats = Board.Evaluate();
+	ARCANE_EXPECT(Board.GetPlacements().empty());
+	ARCANE_EXPECT_NEAR(Stats.RuneStats[StatIndex::HP], 0.0f);
+}
+
+ARCANE_TEST(MultiSourceConnectivity)
+{
+	FTestBoard Test;
+
+	// 특수 셀은 정의 순서대로 소스 0 (0,0) x1, 소스 1 (0,2) x1, 소스 2 (2,2) x2
+	std::vector<FLayoutCellDef> Cells = MakeSquareLayout(3, FCellPos(0, 0));
+	Cells[8].bSpecial = true;
+	Cells[8].SourceWeight = 2.0f;
+	Cells[2].bSpecial = true;
+
+	FBoardLayout Layout;
+	Layout.Build(Cells);
+	ARCANE_EXPECT(Layout.GetNumSourceCells() == 3);
+
+	FBoardState Board;
+	Board.Reset(&Layout, &Test.Catalog, &Test.Rules);
+
+	// 떨어진 두 영역은 소스별로 따로 연결
+	Board.Place({ 1, FCellPos(0, 0), 0 });
+	Board.Place({ 3, FCellPos(1, 1), 0 });
+	FBoardStats Stats = Board.Evaluate();
+	ARCANE_EXPECT(Board.GetConnectedRuneCount() == 2);
+	ARCANE_EXPECT(Board.GetSourceConnectedRuneCount(0) == 1);
+	ARCANE_EXPECT(Board.GetSourceConnectedRuneCount(1) == 0);
+	ARCANE_EXPECT(Board.GetSourceConnectedRuneCount(2) == 1);
+	ARCANE_EXPECT(Board.GetSourceConnectedRunes(2).Contains(3));
+	ARCANE_EXPECT(Board.GetCellSource(Layout.ToIndex(FCellPos(2, 1))) == 2);
+	ARCANE_EXPECT(Board.GetCellSource(Layout.ToIndex(FCellPos(0, 1))) == -1);
+	ARCANE_EXPECT_NEAR(Stats.BonusStats[StatIndex::HP], 1.0f);
+	ARCANE_EXPECT_NEAR(Stats.BonusStats[StatIndex::DEF], 2.0f);
+
+	// (0,1)로 두 영역이 이어지면 그룹 하나, 배율은 합산
+	Board.Place({ 4, FCellPos(0, 1), 0 });
+	Stats = Board.Evaluate();
+	ARCANE_EXPECT(Board.GetConnectedRuneCount() == 3);
+	ARCANE_EXPECT(Board.GetSourceConnectedRuneCount(2) == 3);
+	ARCANE_EXPECT(Board.GetCellSource(Layout.ToIndex(FCellPos(2, 2))) == 0);
+	ARCANE_EXPECT(Board.GetSourceConnectedRunes(0).Contains(3));
+	ARCANE_EXPECT_NEAR(Stats.BonusStats[StatIndex::HP], 9.0f);
+	ARCANE_EXPECT_NEAR(Stats.BonusStats[StatIndex::DEF], 9.0f);
+	ARCANE_EXPECT_NEAR(Stats.BonusStats[StatIndex::ATK], 0.0f);
+}
+
+ARCANE_TEST(SourceCellLimit)
+{
+	FTestBoard Test;
+
+	// 12x12 전부 특수 셀, 정의 순서로 MaxSourceCells개까지만 소스
+	std::vector<FLayoutCellDef> Cells = MakeSquareLayout(12, FCellPos(0, 0));
+	for (FLayoutCellDef& Cell : Cells)
+	{
+		Cell.bSpecial = true;
+	}
+
+	FBoardLayout Layout;
+	ARCANE_EXPECT(Layout.Build(Cells) == 144 - FBoardLayout::MaxSourceCells);
+	ARCANE_EXPECT(Layout.GetNumSourceCells() == FBoardLayout::MaxSourceCells);
+	ARCANE_EXPECT(Layout.IsSpecial(Layout.ToIndex(FCellPos(10, 6))));
+	ARCANE_EXPECT(!Layout.IsSpecial(Layout.ToIndex(FCellPos(11, 11))));
+
+	// 마지막 소스도 라벨/대표 소스가 넘치지 않음
+	FBoardState Board;
+	Board.Reset(&Layout, &Test.Catalog, &Test.Rules);
+	Board.Place({ 1, FCellPos(10, 6), 0 });
+	Board.Place({ 4, FCellPos(11, 11), 0 });
+	Board.Evaluate();
+	ARCANE_EXPECT(Board.GetConnectedRuneCount() == 1);
+	ARCANE_EXPECT(Board.GetSourceConnectedRuneCount(FBoardLayout::MaxSourceCells - 1) == 1);
+	ARCANE_EXPECT(Board.GetCellSource(Layout.ToIndex(FCellPos(10, 6))) == FBoardLayout::MaxSourceCells - 1);
+}
+
+ARCANE_TEST(RowBitboardsMatchCellPath)
+{
+	// 같은 12x12 레이아웃에 (0,70) 셀 하나를 더하면 64열을 넘어 셀 단위 경로 사용
+	std::vector<FLayoutCellDef> Cells;
+	for (int32_t X = 0; X < 12; ++X)
+	{
+		for (int32_t Y = 0; Y < 12; ++Y)
+		{
+			FLayoutCellDef Cell;
+			Cell.Pos = FCellPos(X, Y);
+			Cell.bSpecial = (X == 0 && Y == 0) || (X == 11 && Y == 11) || (X == 6 && Y == 5);
+			Cell.SourceWeight = 1.0f + X * 0.25f;
+			if (Cell.bSpecial || (X * 7 + Y * 3) % 11 != 0)
+			{
+				Cells.push_back(Cell);
+			}
+		}
+	}
+
+	FBoardLayout RowLayout;
+	RowLayout.Build(Cells);
+	Cells.push_back({ FCellPos(0, 70) });
+	FBoardLayout CellLayout;
+	CellLayout.Build(Cells);
+	ARCANE_EXPECT(!RowLayout.GetValidRowMasks().empty());
+	ARCANE_EXPECT(CellLayout.GetValidRowMasks().empty());
+
+	const std::vector<std::vector<FCellPos>> Shapes = {
+		{ {0, 0} }, { {0, 0}, {0, 1} }, { {0, 0}, {1, 0}, {1, 1} }, { {0, 0}, {0, 1}, {0, 2}, {1, 1} }
+	};
+	FRuneCatalog Catalog;
+	for (RuneId Id = 1; Id <= 120; ++Id)
+	{
+		Catalog.AddRune(MakeRune(Id, Id % StatIndex::Count, 1.0f + Id, Shapes[Id % Shapes.size()]));
+	}
+	FSynergyRuleSet Rules;
+
+	FBoardState RowBoard;
+	FBoardState CellBoard;
+	RowBoard.Reset(&RowLayout, &Catalog, &Rules);
+	CellBoard.Reset(&CellLayout, &Catalog, &Rules);
+
+	std::mt19937 Random(42);
+	std::vector<RuneId> RowAffected;
+	std::vector<RuneId> CellAffected;
+	int32_t MaxConnected = 0;
+	for (int32_t Step = 0; Step < 400; ++Step)
+	{
+		const FPlacement Placement = { static_cast<RuneId>(1 + Random() % 120),
+			FCellPos(static_cast<int32_t>(Random() % 14) - 1, static_cast<int32_t>(Random() % 14) - 1), static_cast<uint8_t>(Random() % Orientation::Count) };
+
+		if (RowBoard.FindPlacement(Placement.Id))
+		{
+			ARCANE_EXPECT(RowBoard.Remove(Placement.Id) == CellBoard.Remove(Placement.Id));
+		}
+		else
+		{
+			const EPlacementResult Result = RowBoard.CheckPlacement(Placement.Id, Placement.Pos, Placement.Orientation, &RowAffected);
+			ARCANE_EXPECT(Result == CellBoard.CheckPlacement(Placement.Id, Placement.Pos, Placement.Orientation, &CellAffected));
+			std::sort(RowAffected.begin(), RowAffected.end());
+			std::sort(CellAffected.begin(), CellAffected.end());
+			ARCANE_EXPECT(RowAffected == CellAffected);
+			ARCANE_EXPECT(RowBoard.Place(Placement) == CellBoard.Place(Placement));
+		}
+
+		const FBoardStats RowStats = RowBoard.Evaluate();
+		const FBoardStats CellStats = CellBoard.Evaluate();
+		ARCANE_EXPECT(RowBoard.GetConnectedRuneCount() == CellBoard.GetConnectedRuneCount());
+		MaxConnected = std::max(MaxConnected, RowBoard.GetConnectedRuneCount());
+		for (int32_t Stat = 0; Stat < StatIndex::Count; ++Stat)
+		{
+			ARCANE_EXPECT_NEAR(RowStats.BonusStats[Stat], CellStats.BonusStats[Stat]);
+		}
+		for (int32_t Source = 0; Source < RowLayout.GetNumSourceCells(); ++Source)
+		{
+			ARCANE_EXPECT(RowBoard.GetSourceConnectedRuneCount(Source) == CellBoard.GetSourceConnectedRuneCount(Source));
+		}
+		for (int32_t Index = 0; Index < RowLayout.GetNumCells(); ++Index)
+		{
+			const int32_t CellIndex = CellLayout.ToIndex(RowLayout.ToPos(Index));
+			if (CellIndex >= 0)
+			{
+				ARCANE_EXPECT(RowBoard.IsConnectedCell(Index) == CellBoard.IsConnectedCell(CellIndex));
+				ARCANE_EXPECT(RowBoard.GetCellSource(Index) == CellBoard.GetCellSource(CellIndex));
+			}
+		}
+	}
+	ARCANE_EXPECT(MaxConnected > 3);
+}
+
+ARCANE_TEST(PreviewLeavesBoardUntouched)
+{
+	FTestBoard Test;
+	FBoardState& Board = Test.Board;
+	Board.Place({ 1, FCellPos(0, 0), 0 });
+	Board.Place({ 2, FCellPos(1, 1), 0 });
+	const FBoardStats Before = Board.Evaluate();
+
+	FBoardState Scratch;
+	FPlacementPreview Preview;
+
+	// (0,1)을 채우면 1번까지 연결, 보드는 그대로
+	ARCANE_EXPECT(PreviewPlacement(Board, { 4, FCellPos(0, 1), 0 }, Scratch, Preview));
+	ARCANE_EXPECT(Preview.bValid);
+	ARCANE_EXPECT(Preview.Displaced.empty());
+	ARCANE_EXPECT(Preview.NewlyConnected.size() == 2);
+	ARCANE_EXPECT(Preview.Disconnected.empty());
+	ARCANE_EXPECT_NEAR(Preview.StatDelta.RuneStats[StatIndex::HP], 2.0f);
+	ARCANE_EXPECT(Board.FindPlacement(4) == nullptr);
+	ARCANE_EXPECT(!Board.IsRuneConnected(1));
+	ARCANE_EXPECT_NEAR(Board.ComputeStats().RuneStats[StatIndex::HP], Before.RuneStats[StatIndex::HP]);
+
+	// 특수 셀의 2번을 밀어내면 연결이 끊김
+	ARCANE_EXPECT(PreviewPlacement(Board, { 4, FCellPos(1, 1), 0 }, Scratch, Preview));
+	ARCANE_EXPECT(Preview.Displaced.size() == 1 && Preview.Displaced[0] == 2);
+	ARCANE_EXPECT(Preview.Disconnected.size() == 1 && Preview.Disconnected[0] == 2);
+	ARCANE_EXPECT_NEAR(Preview.StatDelta.RuneStats[StatIndex::ATK], -5.0f);
+	ARCANE_EXPECT(Board.FindPlacement(2) != nullptr);
+
+	// 이미 놓인 룬은 기존 위치를 비우고 옮긴 결과
+	ARCANE_EXPECT(PreviewPlacement(Board, { 1, FCellPos(2, 2), 0 }, Scratch, Preview));
+	ARCANE_EXPECT(Preview.Displaced.empty());
+	ARCANE_EXPECT_NEAR(Preview.StatDelta.RuneStats[StatIndex::HP], 0.0f);
+
+	ARCANE_EXPECT(!PreviewPlacement(Board, { 3, FCellPos(2, 2), 0 }, Scratch, Preview));
+	ARCANE_EXPECT(!Preview.bValid);
+}
+
+ARCANE_TEST(AnchorMapMatchesCheckPlacement)
+{
+	FTestBoard Test;
+	FBoardState& Board = Test.Board;
+	Board.Place({ 2, FCellPos(1, 1), 0 });
+
+	FPlacementAnchorMap Anchors;
+	for (RuneId Id = 1; Id <= 4; ++Id)
+	{
+		for (uint8_t Orient = 0; Orient < Orientation::Count; ++Orient)
+		{
+			ARCANE_EXPECT(Board.BuildAnchorMap(Id, Orient, Anchors));
+			ARCANE_EXPECT(Anchors.IsBuiltFor(Id, Orient));
+
+			int32_t NumPlaceable = 0;
+			for (int32_t X = 0; X < 3; ++X)
+			{
+				for (int32_t Y = 0; Y < 3; ++Y)
+				{
+					const EPlacementResult Expected = Board.CheckPlacement(Id, FCellPos(X, Y), Orient);
+					ARCANE_EXPECT(Anchors.Get(FCellPos(X, Y)) == Expected);
+					NumPlaceable += Expected != EPlacementResult::OutOfBounds ? 1 : 0;
+				}
+			}
+
+			int32_t NumVisited = 0;
+			Anchors.ForEachPlaceable([&](const FCellPos& Anchor, EPlacementResult Result)
+			{
+				ARCANE_EXPECT(Board.CheckPlacement(Id, Anchor, Orient) == Result);
+				++NumVisited;
+			});
+			ARCANE_EXPECT(NumVisited == NumPlaceable);
+			ARCANE_EXPECT(Anchors.CountResult(EPlacementResult::OutOfBounds) == 9 - NumPlaceable);
+		}
+	}
+
+	ARCANE_EXPECT(Anchors.Get(FCellPos(-1, 0)) == EPlacementResult::OutOfBounds);
+	ARCANE_EXPECT(!Board.BuildAnchorMap(99, 0, Anchors));
+}
+
+ARCANE_TEST(InitialCellsFromLayout)
+{
+	FRuneCatalog Catalog;
+	Catalog.AddRune(MakeRune(5, StatIndex::AGL, 1.5f, { {0, 0} }));
+
+	std::vector<FLayoutCellDef> Cells = MakeSquareLayout(2, FCellPos(0, 0));
+	Cells[0].bOccupied = true;
+	Cells[0].Rune = 5;
+
+	FBoardLayout Layout;
+	Layout.Build(Cells);
+	FSynergyRuleSet Rules;
+	FBoardState Board;
+	Board.Reset(&Layout, &Catalog, &Rules);
+
+	const FBoardStats Stats = Board.Evaluate();
+	ARCANE_EXPECT(Board.GetPlacements().size() == 1);
+	ARCANE_EXPECT(Board.IsRuneConnected(5));
+	ARCANE_EXPECT_NEAR(Stats.RuneStats[StatIndex::AGL], 1.5f);
+	ARCANE_EXPECT_NEAR(Stats.BonusStats[StatIndex::AGL], 1.0f);
+}
+
+ARCANE_TEST(InitialCellsJoinSynergy)
+{
+	std::vector<FSynergyRuleDef> RuleDefs(1);
+	RuleDefs[0].Type = ESynergyType::Set;
+	RuleDefs[0].RequiredRunes = { 1, 4 };
+	RuleDefs[0].Bonus[StatIndex::ATS] = 4.0f;
+
+	FTestBoard Test(RuleDefs);
+
+	// (0,0) 고정 룬 1
+	std::vector<FLayoutCellDef> Cells = MakeSquareLayout(3, FCellPos(1, 1));
+	Cells[0].bOccupied = true;
+	Cells[0].Rune = 1;
+	FBoardLayout Layout;
+	Layout.Build(Cells);
+
+	FBoardState Board;
+	Board.Reset(&Layout, &Test.Catalog, &Test.Rules);
+	Board.Place({ 4, FCellPos(2, 2), 0 });
+	ARCANE_EXPECT(Board.GetSynergyState().GetNumActiveRules() == 1);
+
+	// 고정 룬을 뺐다 다시 놓아도 진행도가 음수로 밀리지 않음
+	ARCANE_EXPECT(Board.Remove(1));
+	ARCANE_EXPECT(Board.GetSynergyState().GetNumActiveRules() == 0);
+	Board.Place({ 1, FCellPos(0, 0), 0 });
+	ARCANE_EXPECT(Board.GetSynergyState().GetNumActiveRules() == 1);
+	ARCANE_EXPECT_NEAR(Board.Evaluate().BonusStats[StatIndex::ATS], 4.0f);
+}
+
+ARCANE_TEST(SynergyThresholds)
+{
+	std::vector<FSynergyRuleDef> RuleDefs(2);
+	RuleDefs[0].Type = ESynergyType::Adjacency;
+	RuleDefs[0].FirstStat = StatIndex::HP;
+	RuleDefs[0].SecondStat = StatIndex::ATK;
+	RuleDefs[0].Bonus[StatIndex::DEF] = 7.0f;
+
+	RuleDefs[1].Type = ESynergyType::Set;
+	RuleDefs[1].RequiredRunes = { 1, 3, 3 };
+	RuleDefs[1].Bonus[StatIndex::ATS] = 4.0f;
+
+	FTestBoard Test(RuleDefs);
+	FBoardState& Board = Test.Board;
+	ARCANE_EXPECT(Test.Rules.GetNumRules() == 2);
+
+	Board.Place({ 1, FCellPos(2, 2), 0 });
+	ARCANE_EXPECT_NEAR(Board.Evaluate().BonusStats[StatIndex::DEF], 0.0f);
+
+	// HP 룬과 ATK 룬이 맞닿음
+	Board.Place({ 2, FCellPos(2, 0), 0 });
+	FBoardStats Stats = Board.Evaluate();
+	ARCANE_EXPECT(Board.GetSynergyState().GetNumActiveRules() == 1);
+	ARCANE_EXPECT_NEAR(Stats.BonusStats[StatIndex::DEF], 7.0f);
+
+	Board.Place({ 3, FCellPos(0, 0), 0 });
+	Stats = Board.Evaluate();
+	ARCANE_EXPECT(Board.GetSynergyState().GetNumActiveRules() == 2);
+	ARCANE_EXPECT_NEAR(Stats.BonusStats[StatIndex::ATS], 4.0f);
+
+	// 제거하면 보너스도 되돌림
+	Board.Remove(2);
+	Board.Remove(3);
+	Stats = Board.Evaluate();
+	ARCANE_EXPECT(Board.GetSynergyState().GetNumActiveRules() == 0);
+	ARCANE_EXPECT_NEAR(Stats.BonusStats[StatIndex::DEF], 0.0f);
+	ARCANE_EXPECT_NEAR(Stats.BonusStats[StatIndex::ATS], 0.0f);
+}
+
+ARCANE_TEST(SynergySkipsInvalidRules)
+{
+	std::vector<FSynergyRuleDef> RuleDefs(2);
+	RuleDefs[0].Type = ESynergyType::Adjacency;
+	RuleDefs[1].Type = ESynergyType::Set;
+	RuleDefs[1].RequiredRunes = { 0 };
+
+	FRuneCatalog Catalog;
+	FSynergyRuleSet Rules;
+	ARCANE_EXPECT(Rules.Compile(RuleDefs, Catalog) == 0);
+}
+
+ARCANE_TEST(BatchMatchesSequential)
+{
+	FTestBoard Test;
+
+	FBoardLayout SmallLayout;
+	SmallLayout.Build(MakeSquareLayout(2, FCellPos(0, 0)));
+
+	const std::vector<const FBoardLayout*> Layouts = { &Test.Layout, &SmallLayout };
+	FBatchEvaluator Evaluator(Test.Catalog, Test.Rules, Layouts);
+
+	const std::vector<std::vector<FPlacement>> Candidates = {
+		{ { 2, FCellPos(1, 1), 0 }, { 4, FCellPos(0, 2), 0 } },
+		{ { 1, FCellPos(0, 0), 0 } },
+		{ { 3, FCellPos(0, 0), 0 }, { 2, FCellPos(1, 0), 0 } },
+		{}
+	};
+
+	FBoardBatch Batch;
+	for (int32_t i = 0; i < 2000; ++i)
+	{
+		const std::vector<FPlacement>& Candidate = Candidates[i % Candidates.size()];
+		Batch.AddBoard(static_cast<uint8_t>(i % 3), Candidate.data(), static_cast<int32_t>(Candidate.size()));
+	}
+
+	std::vector<FBoardBatchResult> Results;
+	Evaluator.EvaluateParallel(Batch, Results, 4);
+	ARCANE_EXPECT(Results.size() == Batch.Boards.size());
+
+	for (int32_t i = 0; i < Batch.Num(); ++i)
+	{
+		const uint8_t LayoutIndex = Batch.Boards[i].LayoutIndex;
+		if (LayoutIndex >= Layouts.size())
+		{
+			ARCANE_EXPECT(!Results[i].bValid);
+			continue;
+		}
+
+		FBoardState Board;
+		Board.Reset(Layouts[LayoutIndex], &Test.Catalog, &Test.Rules);
+		for (const FPlacement& Placement : Candidates[i % Candidates.size()])
+		{
+			Board.AddPlacementUnchecked(Placement);
+		}
+
+		const FBoardStats Expected = Board.Evaluate();
+		ARCANE_EXPECT(Results[i].ConnectedRuneCount == Board.GetConnectedRuneCount());
+		for (int32_t Stat = 0; Stat < StatIndex::Count; ++Stat)
+		{
+			ARCANE_EXPECT_NEAR(Results[i].Stats.RuneStats[Stat], Expected.RuneStats[Stat]);
+			ARCANE_EXPECT_NEAR(Results[i].Stats.BonusStats[Stat], Expected.BonusStats[Stat]);
+		}
+	}
+
+	// 없는 레이아웃, 범위 초과 (2x2), 겹침은 무효
+	ARCANE_EXPECT(Results[0].bValid);
+	ARCANE_EXPECT(Results[1].bValid);
+	ARCANE_EXPECT(!Results[2].bValid);
+	ARCANE_EXPECT(!Results[4].bValid);
+	ARCANE_EXPECT(!Results[6].bValid);
+}
+
+ARCANE_TEST(SubmittedBoardValidation)
+{
+	FTestBoard Test;
+	FBoardState& Board = Test.Board;
+
+	FRuneIdSet Owned;
+	Owned.Add(1);
+	Owned.Add(2);
+	Owned.Add(3);
+
+	std::vector<FPlacement> Submitted = { { 2, FCellPos(1, 1), 0 }, { 1, FCellPos(0, 0), 0 } };
+	FValidationDiff Diff;
+	ARCANE_EXPECT(ApplySubmittedBoard(Board, Submitted.data(), 2, Owned, &Diff) == EValidationResult::Accepted);
+	ARCANE_EXPECT(Diff.NumAdded == 2 && Diff.NumRemoved == 0);
+
+	// 1은 그대로, 2는 이동, 3 추가
+	Submitted = { { 1, FCellPos(0, 0), 0 }, { 2, FCellPos(2, 0), 0 }, { 3, FCellPos(0, 1), 0 } };
+	ARCANE_EXPECT(ApplySubmittedBoard(Board, Submitted.data(), 3, Owned, &Diff) == EValidationResult::Accepted);
+	ARCANE_EXPECT(Diff.NumKept == 1 && Diff.NumRemoved == 1 && Diff.NumAdded == 2);
+	ARCANE_EXPECT(Board.GetRuneAt(Test.Layout.ToIndex(FCellPos(2, 1))) == 2);
+
+	// 실패하면 이전 상태 유지
+	const std::vector<FPlacement> Before = Board.GetPlacements();
+	std::vector<FPlacement> Overlapping = { { 1, FCellPos(1, 1), 0 }, { 2, FCellPos(2, 0), 0 }, { 3, FCellPos(0, 1), 0 } };
+	ARCANE_EXPECT(ApplySubmittedBoard(Board, Overlapping.data(), 3, Owned) == EValidationResult::Overlapping);
+	ARCANE_EXPECT(Board.GetPlacements().size() == Before.size());
+	ARCANE_EXPECT(Board.GetRuneAt(Test.Layout.ToIndex(FCellPos(0, 0))) == 1);
+
+	std::vector<FPlacement> NotOwned = { { 4, FCellPos(2, 2), 0 } };
+	ARCANE_EXPECT(ApplySubmittedBoard(Board, NotOwned.data(), 1, Owned) == EValidationResult::NotOwned);
+
+	std::vector<FPlacement> OutOfBounds = { { 2, FCellPos(2, 2), 0 } };
+	ARCANE_EXPECT(ApplySubmittedBoard(Board, OutOfBounds.data(), 1, Owned) == EValidationResult::OutOfBounds);
+
+	std::vector<FPlacement> Duplicate = { { 1, FCellPos(0, 0), 0 }, { 1, FCellPos(2, 2), 0 } };
+	ARCANE_EXPECT(ApplySubmittedBoard(Board, Duplicate.data(), 2, Owned) == EValidationResult::DuplicateRune);
+
+	std::vector<FPlacement> Unknown = { { 9, FCellPos(0, 0), 0 } };
+	ARCANE_EXPECT(ApplySubmittedBoard(Board, Unknown.data(), 1, Owned) == EValidationResult::UnknownRune);
+
+	const FBoardStats Stats = Board.Evaluate();
+	ARCANE_EXPECT_NEAR(Stats.RuneStats[StatIndex::HP], 10.0f);
+	ARCANE_EXPECT_NEAR(Stats.RuneStats[StatIndex::ATK], 5.0f);
+	ARCANE_EXPECT_NEAR(Stats.RuneStats[StatIndex::DEF], 3.0f);
+}
+
+ARCANE_TEST(StarterRunesAcceptSubmittedBoard)
+{
+	FTestBoard Test;
+	FRuneIdRemap Remap;
+	Remap.Build({ 1, 2, 3, 4 });
+
+	// 서버 세이브가 없는 플레이어: 기본 룬(외부 ID 1 ~ 8)을 서버 테이블 기준으로 지급, 테이블에 없는 ID는 무시
+	FRuneIdSet Owned;
+	for (int32_t ExternalID = 1; ExternalID <= 8; ++ExternalID)
+	{
+		if (const RuneId InternalID = Remap.ToInternal(ExternalID))
+		{
+			Owned.Add(InternalID);
+		}
+	}
+
+	std::vector<FPlacement> Submitted = { { Remap.ToInternal(1), FCellPos(0, 0), 0 }, { Remap.ToInternal(2), FCellPos(1, 1), 0 } };
+
+	// 소유 정보가 비어 있으면 모든 제출이 거부됨
+	ARCANE_EXPECT(ApplySubmittedBoard(Test.Board, Submitted.data(), 2, FRuneIdSet()) == EValidationResult::NotOwned);
+	ARCANE_EXPECT(ApplySubmittedBoard(Test.Board, Submitted.data(), 2, Owned) == EValidationResult::Accepted);
+	ARCANE_EXPECT_NEAR(Test.Board.Evaluate().RuneStats[StatIndex::ATK], 5.0f);
+}
+
+ARCANE_TEST(InventoryViewsAndUnplaced)
+{
+	FTestBoard Test;
+
+	FRuneInventory Inventory;
+	Inventory.SetCatalog(&Test.Catalog);
+	for (RuneId Id : { 4, 3, 2, 1 })
+	{
+		Inventory.Add(Id);
+	}
+	ARCANE_EXPECT(Inventory.Add(2) == 2);
+	ARCANE_EXPECT(Inventory.Num() == 4);
+
+	ARCANE_EXPECT((Inventory.GetView(EInventoryView::ById) == std::vector<RuneId>{ 1, 2, 3, 4 }));
+	ARCANE_EXPECT((Inventory.GetView(EInventoryView::ByStat) == std::vector<RuneId>{ 1, 4, 2, 3 }));
+	ARCANE_EXPECT((Inventory.GetView(EInventoryView::ByShapeSize) == std::vector<RuneId>{ 1, 4, 2, 3 }));
+	ARCANE_EXPECT((Inventory.GetStatView(StatIndex::HP) == std::vector<RuneId>{ 1, 4 }));
+
+	// 범위 밖 보기는 비어 있고 정렬된 보기 캐시를 건드리지 않음
+	ARCANE_EXPECT(Inventory.GetView(EInventoryView::Count).empty());
+	ARCANE_EXPECT((Inventory.GetView(EInventoryView::ByShapeSize) == std::vector<RuneId>{ 1, 4, 2, 3 }));
+
+	// 바뀌지 않으면 같은 보기 재사용
+	const RuneId* CachedData = Inventory.GetView(EInventoryView::ById).data();
+	ARCANE_EXPECT(Inventory.GetView(EInventoryView::ById).data() == CachedData);
+
+	Test.Board.Place({ 2, FCellPos(0, 0), 0 });
+	FRuneIdSet Unplaced;
+	Inventory.GetUnplaced(Test.Board.GetPlacedRunes(), Unplaced);
+	ARCANE_EXPECT(Unplaced.Num() == 3 && !Unplaced.Contains(2) && Unplaced.Contains(4));
+
+	// 수량이 남아 있으면 보유 유지
+	const uint32_t Revision = Inventory.GetRevision();
+	ARCANE_EXPECT(Inventory.Remove(2));
+	ARCANE_EXPECT(Inventory.Contains(2) && Inventory.GetRevision() != Revision);
+	ARCANE_EXPECT(Inventory.Remove(2) && !Inventory.Contains(2));
+	ARCANE_EXPECT(!Inventory.Remove(2));
+	ARCANE_EXPECT((Inventory.GetView(EInventoryView::ById) == std::vector<RuneId>{ 1, 3, 4 }));
+}
+
+ARCANE_TEST(InventoryRemapKeepsExternalIds)
+{
+	FRuneIdRemap OldRemap;
+	OldRemap.Build({ 10, 20, 30, 40 });
+
+	FRuneInventory Inventory;
+	Inventory.Add(OldRemap.ToInternal(20), 2);
+	Inventory.Add(OldRemap.ToInternal(30));
+	Inventory.Add(OldRemap.ToInternal(40));
+
+	// 5 추가, 30 삭제로 20의 내부 인덱스가 2 -> 3
+	FRuneIdRemap NewRemap;
+	NewRemap.Build({ 5, 10, 20, 40 });
+	ARCANE_EXPECT(NewRemap.ToExternal(OldRemap.ToInternal(20)) == 10);
+
+	const uint32_t Revision = Inventory.GetRevision();
+	ARCANE_EXPECT(Inventory.Remap(OldRemap, NewRemap) == 1);
+	ARCANE_EXPECT(Inventory.Num() == 2 && Inventory.GetRevision() != Revision);
+
+	// 저장 경로와 같이 새 재매핑으로 외부 ID/수량 기록
+	std::vector<std::pair<int32_t, uint16_t>> Saved;
+	Inventory.ForEach([&Inventory, &NewRemap, &Saved](RuneId Id)
+	{
+		Saved.emplace_back(NewRemap.ToExternal(Id), Inventory.GetCount(Id));
+	});
+	ARCANE_EXPECT((Saved == std::vector<std::pair<int32_t, uint16_t>>{ { 20, 2 }, { 40, 1 } }));
+	ARCANE_EXPECT((Inventory.GetView(EInventoryView::ById) == std::vector<RuneId>{ NewRemap.ToInternal(20), NewRemap.ToInternal(40) }));
+}
+
+ARCANE_TEST(EditLogRingKeepsReplayableWindow)
+{
+	FBoardEditLog Log;
+	Log.Init(1);
+	ARCANE_EXPECT(Log.GetCapacity() == FBoardEditLog::MinCapacity);
+
+	auto AddSnapshot = [&Log](uint32_t TimeMs, int32_t NumRunes)
+	{
+		FBoardEditRecord Header;
+		Header.TimeMs = TimeMs;
+		Header.Op = EBoardEditOp::Snapshot;
+		Header.Count = static_cast<uint16_t>(NumRunes);
+		Log.Add(Header);
+		for (int32_t i = 0; i < NumRunes; ++i)
+		{
+			FBoardEditRecord Rune;
+			Rune.Op = EBoardEditOp::Rune;
+			Rune.RuneId = 100 + i;
+			Log.Add(Rune);
+		}
+	};
+
+	// Snapshot 전 편집은 재생할 수 없음
+	FBoardEditRecord Place;
+	Place.Op = EBoardEditOp::Place;
+	Log.Add(Place);
+	std::vector<FBoardEditRecord> Replay;
+	Log.GetReplayRecords(Replay);
+	ARCANE_EXPECT(Replay.empty());
+
+	AddSnapshot(0, 3);
+	ARCANE_EXPECT(!Log.NeedsSnapshot());
+
+	// 링이 여러 번 돌아도 마지막으로 남은 Snapshot부터 꺼냄
+	uint32_t TimeMs = 1;
+	for (int32_t i = 0; i < 1000; ++i)
+	{
+		if (Log.NeedsSnapshot())
+		{
+			AddSnapshot(TimeMs, 3);
+		}
+		Place.TimeMs = TimeMs++;
+		Place.RuneId = i;
+		Log.Add(Place);
+	}
+	ARCANE_EXPECT(Log.Num() == Log.GetCapacity());
+
+	Log.GetReplayRecords(Replay);
+	ARCANE_EXPECT(!Replay.empty() && Replay.front().Op == EBoardEditOp::Snapshot);
+	ARCANE_EXPECT(Replay.size() > static_cast<size_t>(Log.GetCapacity() / 2));
+	ARCANE_EXPECT(Replay.back().Op == EBoardEditOp::Place && Replay.back().RuneId == 999);
+	for (size_t i = 1; i < Replay.size(); ++i)
+	{
+		ARCANE_EXPECT(Replay[i].TimeMs >= Replay[i - 1].TimeMs || Replay[i].Op == EBoardEditOp::Rune);
+	}
+
+	std::vector<uint8_t> Bytes;
+	Log.Serialize(Bytes);
+	std::vector<FBoardEditRecord> Loaded;
+	ARCANE_EXPECT(FBoardEditLog::Deserialize(Bytes.data(), Bytes.size(), Loaded));
+	ARCANE_EXPECT(Loaded.size() == Replay.size());
+	ARCANE_EXPECT(Loaded.size() == Replay.size() && std::equal(Loaded.begin(), Loaded.end(), Replay.begin(),
+		[](const FBoardEditRecord& A, const FBoardEditRecord& B) { return A.Op == B.Op && A.RuneId == B.RuneId && A.TimeMs == B.TimeMs; }));
+
+	// 잘린 파일과 블록 길이가 맞지 않는 파일은 거부
+	ARCANE_EXPECT(!FBoardEditLog::Deserialize(Bytes.data(), Bytes.size() - 1, Loaded));
+	Bytes[16 + 12] = 200;
+	ARCANE_EXPECT(!FBoardEditLog::Deserialize(Bytes.data(), Bytes.size(), Loaded) && Loaded.empty());
+
+	// 룬 블록이 큰 편집(프리셋 로드)과 여러 블록짜리 Snapshot 묶음도 레코드 수로 계산
+	auto AddBlock = [&Log](EBoardEditOp Op, uint32_t TimeMs, int16_t BlockIndex, int32_t NumRunes)
+	{
+		FBoardEditRecord Header;
+		Header.TimeMs = TimeMs;
+		Header.Op = Op;
+		Header.X = BlockIndex;
+		Header.Count = static_cast<uint16_t>(NumRunes);
+		Log.Add(Header);
+		for (int32_t i = 0; i < NumRunes; ++i)
+		{
+			FBoardEditRecord Rune;
+			Rune.Op = EBoardEditOp::Rune;
+			Rune.RuneId = static_cast<int32_t>(TimeMs);
+			Log.Add(Rune);
+		}
+	};
+
+	Log.Init(FBoardEditLog::MinCapacity);
+	int32_t NumSnapshots = 0;
+	for (uint32_t Load = 0; Load < 500; ++Load)
+	{
+		if (Load == 0 || Log.NeedsSnapshot())
+		{
+			AddBlock(EBoardEditOp::Snapshot, Load, 0, 20);
+			AddBlock(EBoardEditOp::Snapshot, Load, 1, 20);
+			++NumSnapshots;
+		}
+		AddBlock(EBoardEditOp::Load, Load, 0, 4);
+
+		Log.GetReplayRecords(Replay);
+		ARCANE_EXPECT(!Replay.empty() && Replay.front().Op == EBoardEditOp::Snapshot && Replay.front().X == 0);
+		ARCANE_EXPECT(Replay.back().Op == EBoardEditOp::Rune && Replay.back().RuneId == static_cast<int32_t>(Load));
+	}
+	ARCANE_EXPECT(NumSnapshots > 1 && NumSnapshots < 100);
+}
+
+ARCANE_TEST(TelemetryAggregatesFingerprints)
+{
+	FBoardTelemetryAggregator Aggregator;
+
+	// 인기 구성 하나 + 서로 다른 구성 여러 개
+	FBoardFingerprint Popular;
+	Popular.LayoutHash = 0x1234;
+	Popular.LayoutIndex = 1;
+	Popular.Runes.Add(3);
+	Popular.Runes.Add(7);
+	Popular.Runes.Add(70);
+	Popular.StatTotals[StatIndex::HP] = 100.0f;
+	for (int32_t i = 0; i < 50; ++i)
+	{
+		Aggregator.Add(Popular);
+	}
+
+	for (int32_t i = 0; i < 500; ++i)
+	{
+		FBoardFingerprint Other;
+		Other.LayoutHash = 0x5678;
+		Other.Runes.Add(static_cast<RuneId>(1 + i % 900));
+		Other.Runes.Add(static_cast<RuneId>(901 + i % 100));
+		Aggregator.Add(Other);
+	}
+
+	ARCANE_EXPECT(Aggregator.GetNumBoards() == 550);
+	ARCANE_EXPECT(Aggregator.GetRuneUseCount(70) >= 50);
+	ARCANE_EXPECT(Aggregator.GetLayoutCount(1) == 50 && Aggregator.GetLayoutCount(0) == 500);
+	ARCANE_EXPECT(Aggregator.GetStatBinCount(StatIndex::HP, FBoardTelemetryAggregator::GetStatBin(100.0f)) == 50);
+	ARCANE_EXPECT(FBoardTelemetryAggregator::GetStatBin(0.5f) == 0 && FBoardTelemetryAggregator::GetStatBin(1.0f) == 1);
+	ARCANE_EXPECT(FBoardTelemetryAggregator::GetStatBin(3.0f) == 2 && FBoardTelemetryAggregator::GetStatBin(1e30f) == FBoardTelemetryAggregator::NumStatBins - 1);
+
+	// 스케치는 과소 추정하지 않음, 인기 구성은 상위 표 맨 앞
+	ARCANE_EXPECT(Aggregator.EstimateConfigCount(Popular.LayoutHash, Popular.Runes) >= 50);
+	ARCANE_EXPECT(Aggregator.EstimatePairCount(7, 3) >= 50);
+	const std::vector<FBoardTelemetryAggregator::FTopConfig>& TopConfigs = Aggregator.GetTopConfigs();
+	ARCANE_EXPECT(static_cast<int32_t>(TopConfigs.size()) == FBoardTelemetryAggregator::NumTopConfigs);
+	const auto Top = std::max_element(TopConfigs.begin(), TopConfigs.end(),
+		[](const FBoardTelemetryAggregator::FTopConfig& A, const FBoardTelemetryAggregator::FTopConfig& B) { return A.Estimate < B.Estimate; });
+	ARCANE_EXPECT(Top->LayoutIndex == 1 && Top->Runes.Contains(70) && Top->Runes.Num() == 3);
+
+	FRuneIdRemap Remap;
+	Remap.Build({ 10, 20, 30 });
+	std::vector<uint8_t> Bytes;
+	Aggregator.Serialize(&Remap, Bytes);
+
+	FBoardTelemetryAggregator Loaded;
+	std::vector<int32_t> ExternalIds;
+	ARCANE_EXPECT(Loaded.Deserialize(Bytes.data(), Bytes.size(), &ExternalIds));
+	ARCANE_EXPECT(ExternalIds.size() == 4 && ExternalIds[3] == 30);
+	ARCANE_EXPECT(Loaded.GetNumBoards() == 550 && Loaded.GetRuneUseCount(70) == Aggregator.GetRuneUseCount(70));
+	ARCANE_EXPECT(Loaded.EstimateConfigCount(Popular.LayoutHash, Popular.Runes) == Aggregator.EstimateConfigCount(Popular.LayoutHash, Popular.Runes));
+	ARCANE_EXPECT(Loaded.GetTopConfigs().size() == TopConfigs.size());
+	ARCANE_EXPECT(!Loaded.Deserialize(Bytes.data(), Bytes.size() - 1) && Loaded.GetNumBoards() == 0);
+}
+
+int main()
+{
+	for (const FTestCase& TestCase : GetTestCases())
+	{
+		const int32_t FailuresBefore = NumFailures;
+		TestCase.Body();
+		std::printf("[%s] %s\n", NumFailures == FailuresBefore ? " OK " : "FAIL", TestCase.Name);
+	}
+
+	std::printf("%zu tests, %d failed checks\n", GetTestCases().size(), NumFailures);
+	return NumFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,205 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RuneSystem/GS_ArcaneBoardBatchCommandlet.h"
+#include "RuneSystem/GS_ArcaneBoardManager.h"
+#include "RuneSystem/GS_ArcaneBoardCoreAdapter.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Math/RandomStream.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogArcaneBoardBatch, Log, All);
+
+namespace
+{
+	bool ParseClass(const FString& ClassName, uint8& OutClass)
+	{
+		const int64 EnumValue = StaticEnum<ECharacterClass>()->GetValueByNameString(ClassName.TrimStartAndEnd());
+		if (EnumValue == INDEX_NONE)
+		{
+			return false;
+		}
+
+		OutClass = static_cast<uint8>(EnumValue);
+		return true;
+	}
+
+	bool LoadBatchFromCSV(const FString& FilePath, const ArcaneCore::FRuneIdRemap& Remap, ArcaneCore::FBoardBatch& OutBatch)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *FilePath))
+		{
+			return false;
+		}
+
+		OutBatch.Reserve(Lines.Num(), Lines.Num() * 8);
+		std::vector<ArcaneCore::FPlacement> Placements;
+		TArray<FString> PlacementTokens;
+		TArray<FString> Fields;
+
+		for (int32 LineIndex = 0; LineIndex < Lines.Num(); ++LineIndex)
+		{
+			FString ClassName, PlacementList;
+			if (Lines[LineIndex].IsEmpty() || !Lines[LineIndex].Split(TEXT(","), &ClassName, &PlacementList))
+			{
+				continue;
+			}
+
+			uint8 LayoutIndex = 0;
+			if (!ParseClass(ClassName, LayoutIndex))
+			{
+				UE_LOG(LogArcaneBoardBatch, Warning, TEXT("%d행: 알 수 없는 클래스 %s"), LineIndex + 1, *ClassName);
+				continue;
+			}
+
+			Placements.clear();
+			PlacementList.ParseIntoArray(PlacementTokens, TEXT("|"));
+			for (const FString& Token : PlacementTokens)
+			{
+				Token.ParseIntoArray(Fields, TEXT(":"));
+				if (Fields.Num() < 3)
+				{
+					continue;
+				}
+
+				ArcaneCore::FPlacement Placement;
+				// CSV에는 외부 룬 ID, 테이블에 없는 ID는 0이 되어 배치 실패로 집계
+				Placement.Id = Remap.ToInternal(FCString::Atoi(*Fields[0]));
+				Placement.Pos = ArcaneCore::FCellPos(FCString::Atoi(*Fields[1]), FCString::Atoi(*Fields[2]));
+				Placement.Orientation = Fields.Num() > 3 ? static_cast<uint8>(FCString::Atoi(*Fields[3])) : 0;
+				Placements.push_back(Placement);
+			}
+
+			OutBatch.AddBoard(LayoutIndex, Placements.data(), static_cast<int32>(Placements.size()));
+		}
+
+		return true;
+	}
+
+	void GenerateRandomBatch(const ArcaneCore::FRuneCatalog& Catalog, uint8 LayoutIndex, int32 NumBoards, int32 MaxRunes,
+		int32 BoardExtent, int32 Seed, ArcaneCore::FBoardBatch& OutBatch)
+	{
+		TArray<ArcaneCore::RuneId> RuneIDs;
+		for (int32 RuneID = 1; RuneID < ArcaneCore::MaxRuneCount; ++RuneID)
+		{
+			if (Catalog.Find(static_cast<ArcaneCore::RuneId>(RuneID)))
+			{
+				RuneIDs.Add(static_cast<ArcaneCore::RuneId>(RuneID));
+			}
+		}
+
+		if (RuneIDs.Num() == 0)
+		{
+			return;
+		}
+
+		FRandomStream Random(Seed);
+		OutBatch.Reserve(NumBoards, static_cast<size_t>(NumBoards) * MaxRunes);
+		std::vector<ArcaneCore::FPlacement> Placements;
+
+		for (int32 BoardIndex = 0; BoardIndex < NumBoards; ++BoardIndex)
+		{
+			Placements.resize(Random.RandRange(1, FMath::Max(1, MaxRunes)));
+			for (ArcaneCore::FPlacement& Placement : Placements)
+			{
+				Placement.Id = RuneIDs[Random.RandHelper(RuneIDs.Num())];
+				Placement.Pos = ArcaneCore::FCellPos(Random.RandHelper(BoardExtent), Random.RandHelper(BoardExtent));
+				Placement.Orientation = static_cast<uint8>(Random.RandHelper(ArcaneCore::Orientation::Count));
+			}
+			OutBatch.AddBoard(LayoutIndex, Placements.data(), static_cast<int32>(Placements.size()));
+		}
+	}
+}
+
+UGS_ArcaneBoardBatchCommandlet::UGS_ArcaneBoardBatchCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UGS_ArcaneBoardBatchCommandlet::Main(const FString& Params)
+{
+	FString InputPath, OutputPath, ClassName = TEXT("Ares");
+	int32 NumRandomBoards = 0, Seed = 0, MaxRunes = 10, BoardExtent = 9;
+
+	FParse::Value(*Params, TEXT("Input="), InputPath);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+	FParse::Value(*Params, TEXT("Class="), ClassName);
+	FParse::Value(*Params, TEXT("Random="), NumRandomBoards);
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	FParse::Value(*Params, TEXT("MaxRunes="), MaxRunes);
+	FParse::Value(*Params, TEXT("Extent="), BoardExtent);
+
+	if (OutputPath.IsEmpty())
+	{
+		OutputPath = FPaths::ProjectSavedDir() / TEXT("ArcaneBoard/BatchResults.csv");
+	}
+
+	UGS_ArcaneBoardManager* BoardManager = NewObject<UGS_ArcaneBoardManager>();
+
+	ArcaneCore::FBoardBatch Batch;
+	if (!InputPath.IsEmpty())
+	{
+		if (!LoadBatchFromCSV(InputPath, BoardManager->GetRuneIdRemap(), Batch))
+		{
+			UE_LOG(LogArcaneBoardBatch, Error, TEXT("입력 파일을 읽을 수 없음: %s"), *InputPath);
+			return 1;
+		}
+	}
+	else
+	{
+		uint8 LayoutIndex = 0;
+		if (!ParseClass(ClassName, LayoutIndex))
+		{
+			UE_LOG(LogArcaneBoardBatch, Error, TEXT("알 수 없는 클래스: %s"), *ClassName);
+			return 1;
+		}
+		GenerateRandomBatch(BoardManager->GetRuneCatalog(), LayoutIndex, NumRandomBoards, MaxRunes, BoardExtent, Seed, Batch);
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<FArcaneBoardBatchResult> Results;
+	BoardManager->EvaluateBoardBatch(Batch, Results);
+	const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*OutputPath));
+	if (!Writer)
+	{
+		UE_LOG(LogArcaneBoardBatch, Error, TEXT("출력 파일을 만들 수 없음: %s"), *OutputPath);
+		return 1;
+	}
+
+	// 행을 모아서 64KB 단위로 기록
+	FString Chunk = TEXT("Index,Class,Valid,Connected,HP,ATK,DEF,AGL,ATS,BonusHP,BonusATK,BonusDEF,BonusAGL,BonusATS\n");
+	const UEnum* ClassEnum = StaticEnum<ECharacterClass>();
+	auto FlushChunk = [&Writer, &Chunk]()
+	{
+		FTCHARToUTF8 Utf8Chunk(*Chunk);
+		Writer->Serialize(const_cast<ANSICHAR*>(Utf8Chunk.Get()), Utf8Chunk.Length());
+		Chunk.Reset();
+	};
+
+	for (int32 i = 0; i < Results.Num(); ++i)
+	{
+		const FArcaneBoardBatchResult& Result = Results[i];
+		const FGS_StatRow& Rune = Result.Stats.RuneStats;
+		const FGS_StatRow& Bonus = Result.Stats.BonusStats;
+
+		Chunk += FString::Printf(TEXT("%d,%s,%d,%d,%g,%g,%g,%g,%g,%g,%g,%g,%g,%g\n"),
+			i, *ClassEnum->GetNameStringByValue(Batch.Boards[i].LayoutIndex), Result.bIsValid ? 1 : 0, Result.ConnectedRuneCnt,
+			Rune.HP, Rune.ATK, Rune.DEF, Rune.AGL, Rune.ATS, Bonus.HP, Bonus.ATK, Bonus.DEF, Bonus.AGL, Bonus.ATS);
+
+		if (Chunk.Len() > 64 * 1024)
+		{
+			FlushChunk();
+		}
+	}
+	FlushChunk();
+	Writer->Close();
+
+	UE_LOG(LogArcaneBoardBatch, Display, TEXT("%d개 보드 평가 %.3f초 (%.0f boards/s) -> %s"),
+		Results.Num(), ElapsedTime, Results.Num() / FMath::Max(ElapsedTime, KINDA_SMALL_NUMBER), *OutputPath);
+	return 0;
+}
@@ -0,0 +1,24 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GS_ArcaneBoardBatchCommandlet.generated.h"
+
+/**
+ * 룬 배치 일괄 평가 커맨드렛 (밸런스 검증용)
+ * - 입력 CSV 각 줄: Class,RuneID:X:Y:Orientation|RuneID:X:Y:Orientation|...
+ * - 입력이 없으면 -Random=N 개의 임의 보드 생성 (-Seed, -Class, -MaxRunes)
+ * - 사용법: -run=GS_ArcaneBoardBatch -Input=Boards.csv -Output=Results.csv
+ */
+UCLASS()
+class GAS_API UGS_ArcaneBoardBatchCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGS_ArcaneBoardBatchCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
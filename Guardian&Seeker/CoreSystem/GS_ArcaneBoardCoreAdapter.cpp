@@ -0,0 +1,221 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RuneSystem/GS_ArcaneBoardCoreAdapter.h"
+#include "RuneSystem/GS_GridLayoutDataAsset.h"
+#include "Engine/DataTable.h"
+
+int32 ArcaneBoardAdapter::StatIndexFromName(const FName& StatName)
+{
+	if (StatName == FName("HP"))
+	{
+		return ArcaneCore::StatIndex::HP;
+	}
+	else if (StatName == FName("ATK"))
+	{
+		return ArcaneCore::StatIndex::ATK;
+	}
+	else if (StatName == FName("DEF"))
+	{
+		return ArcaneCore::StatIndex::DEF;
+	}
+	else if (StatName == FName("AGL"))
+	{
+		return ArcaneCore::StatIndex::AGL;
+	}
+	else if (StatName == FName("ATS"))
+	{
+		return ArcaneCore::StatIndex::ATS;
+	}
+	return ArcaneCore::StatIndex::None;
+}
+
+FGS_StatRow ArcaneBoardAdapter::ToStatRow(const ArcaneCore::FStatBlock& StatBlock)
+{
+	FGS_StatRow StatRow;
+	StatRow.HP = StatBlock[ArcaneCore::StatIndex::HP];
+	StatRow.ATK = StatBlock[ArcaneCore::StatIndex::ATK];
+	StatRow.DEF = StatBlock[ArcaneCore::StatIndex::DEF];
+	StatRow.AGL = StatBlock[ArcaneCore::StatIndex::AGL];
+	StatRow.ATS = StatBlock[ArcaneCore::StatIndex::ATS];
+	return StatRow;
+}
+
+FArcaneBoardStats ArcaneBoardAdapter::ToBoardStats(const ArcaneCore::FBoardStats& BoardStats)
+{
+	FArcaneBoardStats Result;
+	Result.RuneStats = ToStatRow(BoardStats.RuneStats);
+	Result.BonusStats = ToStatRow(BoardStats.BonusStats);
+	return Result;
+}
+
+ArcaneCore::FStatBlock ArcaneBoardAdapter::ToTotalStatBlock(const FArcaneBoardStats& BoardStats)
+{
+	ArcaneCore::FStatBlock StatBlock;
+	StatBlock[ArcaneCore::StatIndex::HP] = BoardStats.RuneStats.HP + BoardStats.BonusStats.HP;
+	StatBlock[ArcaneCore::StatIndex::ATK] = BoardStats.RuneStats.ATK + BoardStats.BonusStats.ATK;
+	StatBlock[ArcaneCore::StatIndex::DEF] = BoardStats.RuneStats.DEF + BoardStats.BonusStats.DEF;
+	StatBlock[ArcaneCore::StatIndex::AGL] = BoardStats.RuneStats.AGL + BoardStats.BonusStats.AGL;
+	StatBlock[ArcaneCore::StatIndex::ATS] = BoardStats.RuneStats.ATS + BoardStats.BonusStats.ATS;
+	return StatBlock;
+}
+
+ArcaneCore::FRuneDef ArcaneBoardAdapter::BuildRuneDef(const FRuneTableRow& RuneData, ArcaneCore::RuneId InternalID, FRuneFragmentTextures& OutTextures)
+{
+	ArcaneCore::FRuneDef RuneDef;
+	RuneDef.Id = InternalID;
+	RuneDef.StatIndex = StatIndexFromName(RuneData.StatEffect.StatName);
+	RuneDef.StatValue = RuneData.StatEffect.Value;
+	RuneDef.Shape.reserve(RuneData.RuneShape.Num());
+
+	OutTextures.RuneTextureFrags.Reset(RuneData.RuneShape.Num());
+	OutTextures.ConnectedRuneTextureFrags.Reset(RuneData.RuneShape.Num());
+
+	for (const auto& ShapePair : RuneData.RuneShape)
+	{
+		UTexture2D* const* ConnectedFrag = RuneData.ConnectedRuneShape.Find(ShapePair.Key);
+
+		RuneDef.Shape.push_back(ToCellPos(ShapePair.Key));
+		OutTextures.RuneTextureFrags.Add(ShapePair.Value);
+		OutTextures.ConnectedRuneTextureFrags.Add(ConnectedFrag ? *ConnectedFrag : nullptr);
+	}
+
+	return RuneDef;
+}
+
+void ArcaneBoardAdapter::BuildRuneCatalog(const UDataTable* RuneTable, ArcaneCore::FRuneIdRemap& OutRemap, ArcaneCore::FRuneCatalog& OutCatalog)
+{
+	OutRemap.Clear();
+	OutCatalog.Clear();
+
+	if (!IsValid(RuneTable))
+	{
+		return;
+	}
+
+	TArray<FRuneTableRow*> RuneRows;
+	RuneTable->GetAllRows<FRuneTableRow>(TEXT("BuildRuneCatalog"), RuneRows);
+
+	std::vector<int32> ExternalIDs;
+	ExternalIDs.reserve(RuneRows.Num());
+	for (const FRuneTableRow* Row : RuneRows)
+	{
+		if (Row)
+		{
+			ExternalIDs.push_back(Row->RuneID);
+		}
+	}
+	OutRemap.Build(MoveTemp(ExternalIDs));
+	if (OutRemap.GetNumDropped() > 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BuildRuneCatalog: 룬 테이블이 최대 %d종을 넘어 %d종을 버림"),
+			ArcaneCore::MaxRuneCount - 1, OutRemap.GetNumDropped());
+	}
+
+	FRuneFragmentTextures UnusedTextures;
+	for (const FRuneTableRow* Row : RuneRows)
+	{
+		const ArcaneCore::RuneId InternalID = Row ? OutRemap.ToInternal(Row->RuneID) : 0;
+		if (InternalID != 0)
+		{
+			OutCatalog.AddRune(BuildRuneDef(*Row, InternalID, UnusedTextures));
+		}
+	}
+}
+
+void ArcaneBoardAdapter::BuildLayout(const UGS_GridLayoutDataAsset& LayoutAsset, const ArcaneCore::FRuneIdRemap& Remap, ArcaneCore::FBoardLayout& OutLayout)
+{
+	if (LayoutAsset.ShouldUseCookedLayout() && LayoutAsset.InitFromCookedLayout(Remap, OutLayout))
+	{
+		return;
+	}
+
+	BuildLayout(LayoutAsset.GridCells, Remap, OutLayout);
+}
+
+void ArcaneBoardAdapter::BuildLayout(const TArray<FGridCellData>& GridCells, const ArcaneCore::FRuneIdRemap& Remap, ArcaneCore::FBoardLayout& OutLayout)
+{
+	std::vector<ArcaneCore::FLayoutCellDef> CellDefs;
+	CellDefs.reserve(GridCells.Num());
+
+	for (const FGridCellData& Cell : GridCells)
+	{
+		ArcaneCore::FLayoutCellDef CellDef;
+		CellDef.Pos = ToCellPos(Cell.Pos);
+		CellDef.bSpecial = Cell.bIsSpecialCell;
+		CellDef.SourceWeight = Cell.SourceWeight;
+		CellDef.bOccupied = (Cell.State == EGridCellState::Occupied);
+		CellDef.Rune = Remap.ToInternal(Cell.PlacedRuneID);
+		CellDefs.push_back(CellDef);
+	}
+
+	const int32 NumDroppedSources = OutLayout.Build(CellDefs);
+	if (NumDroppedSources > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("BuildLayout: 특수 셀이 %d개를 넘어 %d개는 일반 셀로 처리"),
+			ArcaneCore::FBoardLayout::MaxSourceCells, NumDroppedSources);
+	}
+}
+
+void ArcaneBoardAdapter::BuildSynergyRules(const UDataTable* SynergyTable, const ArcaneCore::FRuneCatalog& Catalog,
+	const ArcaneCore::FRuneIdRemap& Remap, ArcaneCore::FSynergyRuleSet& OutRuleSet)
+{
+	std::vector<ArcaneCore::FSynergyRuleDef> RuleDefs;
+
+	if (IsValid(SynergyTable))
+	{
+		TArray<FRuneSynergyTableRow*> SynergyRows;
+		SynergyTable->GetAllRows<FRuneSynergyTableRow>(TEXT("CompileSynergyRules"), SynergyRows);
+		RuleDefs.reserve(SynergyRows.Num());
+
+		for (const FRuneSynergyTableRow* Row : SynergyRows)
+		{
+			if (!Row)
+			{
+				continue;
+			}
+
+			ArcaneCore::FSynergyRuleDef RuleDef;
+			RuleDef.Type = (Row->SynergyType == ERuneSynergyType::Set) ? ArcaneCore::ESynergyType::Set : ArcaneCore::ESynergyType::Adjacency;
+			RuleDef.FirstStat = StatIndexFromName(Row->FirstStatName);
+			RuleDef.SecondStat = StatIndexFromName(Row->SecondStatName);
+			RuleDef.RequiredCount = Row->RequiredCount;
+			RuleDef.RequiredRunes.reserve(Row->RequiredRuneIDs.Num());
+			bool bHasUnknownRune = false;
+			for (int32 RequiredRuneID : Row->RequiredRuneIDs)
+			{
+				const ArcaneCore::RuneId InternalID = Remap.ToInternal(RequiredRuneID);
+				bHasUnknownRune |= (InternalID == 0);
+				RuleDef.RequiredRunes.push_back(InternalID);
+			}
+
+			// 없는 룬이 필요한 세트는 완성될 수 없으므로 제외
+			if (RuleDef.Type == ArcaneCore::ESynergyType::Set && bHasUnknownRune)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("CompileSynergyRules: 룬 테이블에 없는 세트 룬 ID 포함 (%s)"),
+					*FString::JoinBy(Row->RequiredRuneIDs, TEXT(", "), [](int32 RuneID) { return FString::FromInt(RuneID); }));
+				continue;
+			}
+
+			for (const FStatEffect& Effect : Row->BonusEffects)
+			{
+				const int32 StatIndex = StatIndexFromName(Effect.StatName);
+				if (StatIndex != ArcaneCore::StatIndex::None)
+				{
+					RuleDef.Bonus[StatIndex] += Effect.Value;
+				}
+			}
+
+			if (RuleDef.Type == ArcaneCore::ESynergyType::Adjacency &&
+				(RuleDef.FirstStat == ArcaneCore::StatIndex::None || RuleDef.SecondStat == ArcaneCore::StatIndex::None))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("CompileSynergyRules: 알 수 없는 스탯 이름 (%s, %s)"),
+					*Row->FirstStatName.ToString(), *Row->SecondStatName.ToString());
+				continue;
+			}
+
+			RuleDefs.push_back(MoveTemp(RuleDef));
+		}
+	}
+
+	OutRuleSet.Compile(RuleDefs, Catalog);
+}
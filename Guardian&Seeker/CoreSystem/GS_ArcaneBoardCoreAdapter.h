@@ -0,0 +1,94 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RuneSystem/GS_ArcaneBoardTableRows.h"
+#include "RuneSystem/GS_ArcaneBoardNetTypes.h"
+#include "ArcaneBoardCoreTypes.h"
+#include "ArcaneRuneCatalog.h"
+#include "ArcaneBoardLayout.h"
+#include "ArcaneSynergy.h"
+#include "ArcaneBoardValidator.h"
+
+class UDataTable;
+class UGS_GridLayoutDataAsset;
+
+/**
+ * UE 데이터 <-> 아케인 보드 코어 변환
+ * - 데이터 테이블/에셋을 읽어 코어 정의로 변환하는 일은 여기서만 수행
+ * - UE 쪽 룬 ID는 외부 ID(int32), 코어는 내부 인덱스, 경계에서 FRuneIdRemap으로 변환
+ */
+namespace ArcaneBoardAdapter
+{
+	FORCEINLINE ArcaneCore::FCellPos ToCellPos(const FIntPoint& Pos)
+	{
+		return ArcaneCore::FCellPos(Pos.X, Pos.Y);
+	}
+
+	FORCEINLINE FIntPoint ToIntPoint(const ArcaneCore::FCellPos& Pos)
+	{
+		return FIntPoint(Pos.X, Pos.Y);
+	}
+
+	FORCEINLINE EPlacementResult ToPlacementResult(ArcaneCore::EPlacementResult Result)
+	{
+		switch (Result)
+		{
+		case ArcaneCore::EPlacementResult::Valid: return EPlacementResult::Valid;
+		case ArcaneCore::EPlacementResult::ReplaceExisting: return EPlacementResult::ReplaceExisting;
+		default: return EPlacementResult::OutOfBounds;
+		}
+	}
+
+	FORCEINLINE ArcaneCore::FPlacement ToPlacement(const FPlacedRuneInfo& RuneInfo, const ArcaneCore::FRuneIdRemap& Remap)
+	{
+		ArcaneCore::FPlacement Placement;
+		Placement.Id = Remap.ToInternal(RuneInfo.RuneID);
+		Placement.Pos = ToCellPos(RuneInfo.Pos);
+		Placement.Orientation = RuneInfo.Orientation;
+		return Placement;
+	}
+
+	FORCEINLINE FPlacedRuneInfo ToPlacedRuneInfo(const ArcaneCore::FPlacement& Placement, const ArcaneCore::FRuneIdRemap& Remap)
+	{
+		return FPlacedRuneInfo(Remap.ToExternal(Placement.Id), ToIntPoint(Placement.Pos), Placement.Orientation);
+	}
+
+	FORCEINLINE ArcaneCore::FPlacement ToPlacement(const FGS_CompactRunePlacement& Compact, const ArcaneCore::FRuneIdRemap& Remap)
+	{
+		ArcaneCore::FPlacement Placement;
+		Placement.Id = Remap.ToInternal(Compact.RuneID);
+		Placement.Pos = ArcaneCore::FCellPos(Compact.PosX, Compact.PosY);
+		Placement.Orientation = Compact.Orientation;
+		return Placement;
+	}
+
+	FORCEINLINE EArcaneBoardValidationResult ToValidationResult(ArcaneCore::EValidationResult Result)
+	{
+		return static_cast<EArcaneBoardValidationResult>(Result);
+	}
+
+	// 스탯 이름 -> ArcaneCore::StatIndex, 알 수 없으면 StatIndex::None
+	GAS_API int32 StatIndexFromName(const FName& StatName);
+
+	GAS_API FGS_StatRow ToStatRow(const ArcaneCore::FStatBlock& StatBlock);
+	GAS_API FArcaneBoardStats ToBoardStats(const ArcaneCore::FBoardStats& BoardStats);
+
+	// 캐릭터에 반영할 합계 (룬 스탯 + 보너스 스탯)
+	GAS_API ArcaneCore::FStatBlock ToTotalStatBlock(const FArcaneBoardStats& BoardStats);
+
+	// 룬 모양 순회 순서대로 조각 텍스처도 함께 채움
+	GAS_API ArcaneCore::FRuneDef BuildRuneDef(const FRuneTableRow& RuneData, ArcaneCore::RuneId InternalID, FRuneFragmentTextures& OutTextures);
+
+	// 룬 테이블 -> 외부 ID 재매핑 + 카탈로그 (텍스처 캐시 없이, 쿠킹/도구용)
+	GAS_API void BuildRuneCatalog(const UDataTable* RuneTable, ArcaneCore::FRuneIdRemap& OutRemap, ArcaneCore::FRuneCatalog& OutCatalog);
+
+	GAS_API void BuildLayout(const TArray<FGridCellData>& GridCells, const ArcaneCore::FRuneIdRemap& Remap, ArcaneCore::FBoardLayout& OutLayout);
+
+	// 쿠킹된 빌드에서는 에셋에 구워 둔 테이블을 복사, 그 외에는 GridCells로 계산
+	GAS_API void BuildLayout(const UGS_GridLayoutDataAsset& LayoutAsset, const ArcaneCore::FRuneIdRemap& Remap, ArcaneCore::FBoardLayout& OutLayout);
+
+	GAS_API void BuildSynergyRules(const UDataTable* SynergyTable, const ArcaneCore::FRuneCatalog& Catalog,
+		const ArcaneCore::FRuneIdRemap& Remap, ArcaneCore::FSynergyRuleSet& OutRuleSet);
+}
@@ -0,0 +1,228 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RuneSystem/GS_ArcaneBoardDataCheckCommandlet.h"
+#include "RuneSystem/GS_ArcaneBoardManager.h"
+#include "RuneSystem/GS_ArcaneBoardCoreAdapter.h"
+#include "RuneSystem/GS_RuneDataCatalog.h"
+#include "Engine/DataTable.h"
+#include "Async/ParallelFor.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogArcaneBoardDataCheck, Log, All);
+
+namespace
+{
+	// 클래스 x 룬 하나의 빈 보드 배치 통계
+	struct FRunePlacementStats
+	{
+		int32 NumOrientations = 0;
+		int32 NumPlacements = 0;
+	};
+
+	// 회전/뒤집기 결과가 같은 모양이면 한 번만 셈 (MinOffset 기준으로 정렬한 오프셋 비교)
+	void GetDistinctOrientations(const ArcaneCore::FRuneCatalog& Catalog, ArcaneCore::RuneId Id, TArray<uint8, TInlineAllocator<8>>& OutOrientations)
+	{
+		OutOrientations.Reset();
+		TArray<TArray<FIntPoint>, TInlineAllocator<8>> Shapes;
+
+		for (uint8 Orient = 0; Orient < ArcaneCore::Orientation::Count; ++Orient)
+		{
+			const ArcaneCore::FRuneVariant* Variant = Catalog.FindVariant(Id, Orient);
+			if (!Variant || Variant->NumOffsets == 0)
+			{
+				continue;
+			}
+
+			TArray<FIntPoint> Shape;
+			Shape.Reserve(Variant->NumOffsets);
+			const ArcaneCore::FCellPos* Offsets = Catalog.GetOffsets(*Variant);
+			for (int32 i = 0; i < Variant->NumOffsets; ++i)
+			{
+				Shape.Emplace(Offsets[i].X - Variant->MinOffset.X, Offsets[i].Y - Variant->MinOffset.Y);
+			}
+			Shape.Sort([](const FIntPoint& A, const FIntPoint& B) { return A.X != B.X ? A.X < B.X : A.Y < B.Y; });
+
+			if (!Shapes.Contains(Shape))
+			{
+				Shapes.Add(MoveTemp(Shape));
+				OutOrientations.Add(Orient);
+			}
+		}
+	}
+}
+
+UGS_ArcaneBoardDataCheckCommandlet::UGS_ArcaneBoardDataCheckCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UGS_ArcaneBoardDataCheckCommandlet::Main(const FString& Params)
+{
+	FString OutputPath;
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+	if (OutputPath.IsEmpty())
+	{
+		OutputPath = FPaths::ProjectSavedDir() / TEXT("ArcaneBoard/DataReport.csv");
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	int32 NumErrors = 0;
+	int32 NumWarnings = 0;
+
+	// 룬 테이블 행 검사 (카탈로그는 잘못된 행을 걸러내므로 테이블을 직접 읽음)
+	const UDataTable* RuneTable = LoadObject<UDataTable>(nullptr, UGS_ArcaneBoardManager::RuneDataTablePath);
+	if (!RuneTable)
+	{
+		UE_LOG(LogArcaneBoardDataCheck, Error, TEXT("룬 테이블을 읽을 수 없음: %s"), UGS_ArcaneBoardManager::RuneDataTablePath);
+		return 1;
+	}
+
+	TMap<int32, FName> RowNameByRuneID;
+	RuneTable->ForeachRow<FRuneTableRow>(TEXT("UGS_ArcaneBoardDataCheckCommandlet"), [&](const FName& RowName, const FRuneTableRow& Row)
+	{
+		if (Row.RuneID <= 0)
+		{
+			++NumErrors;
+			UE_LOG(LogArcaneBoardDataCheck, Error, TEXT("%s: 룬 ID는 1 이상이어야 함 (%d)"), *RowName.ToString(), Row.RuneID);
+		}
+		else if (const FName* OtherRow = RowNameByRuneID.Find(Row.RuneID))
+		{
+			++NumErrors;
+			UE_LOG(LogArcaneBoardDataCheck, Error, TEXT("%s: 룬 ID %d가 %s와 중복"), *RowName.ToString(), Row.RuneID, *OtherRow->ToString());
+		}
+		else
+		{
+			RowNameByRuneID.Add(Row.RuneID, RowName);
+		}
+
+		if (Row.RuneShape.Num() == 0)
+		{
+			++NumErrors;
+			UE_LOG(LogArcaneBoardDataCheck, Error, TEXT("%s: RuneShape가 비어 있음"), *RowName.ToString());
+		}
+
+		// 연결 텍스처는 모양 칸과 1:1이어야 함 (남는 키는 그려지지 않고, 빠진 칸은 연결 표시가 안 됨)
+		for (const auto& ConnectedPair : Row.ConnectedRuneShape)
+		{
+			if (!Row.RuneShape.Contains(ConnectedPair.Key))
+			{
+				++NumErrors;
+				UE_LOG(LogArcaneBoardDataCheck, Error, TEXT("%s: ConnectedRuneShape (%d,%d)가 RuneShape에 없음"),
+					*RowName.ToString(), ConnectedPair.Key.X, ConnectedPair.Key.Y);
+			}
+		}
+		for (const auto& ShapePair : Row.RuneShape)
+		{
+			if (!Row.ConnectedRuneShape.Contains(ShapePair.Key))
+			{
+				++NumWarnings;
+				UE_LOG(LogArcaneBoardDataCheck, Warning, TEXT("%s: RuneShape (%d,%d)의 ConnectedRuneShape가 없음"),
+					*RowName.ToString(), ShapePair.Key.X, ShapePair.Key.Y);
+			}
+		}
+
+		if (ArcaneBoardAdapter::StatIndexFromName(Row.StatEffect.StatName) == ArcaneCore::StatIndex::None)
+		{
+			++NumWarnings;
+			UE_LOG(LogArcaneBoardDataCheck, Warning, TEXT("%s: 알 수 없는 스탯 %s"), *RowName.ToString(), *Row.StatEffect.StatName.ToString());
+		}
+	});
+
+	// 내부 인덱스 상한을 넘는 룬은 런타임에서 버려짐
+	if (RowNameByRuneID.Num() > ArcaneCore::MaxRuneCount - 1)
+	{
+		++NumErrors;
+		UE_LOG(LogArcaneBoardDataCheck, Error, TEXT("룬이 %d종으로 최대 %d종을 넘음"), RowNameByRuneID.Num(), ArcaneCore::MaxRuneCount - 1);
+	}
+
+	// 클래스별 레이아웃과 고정 룬만 놓인 빈 보드
+	UGS_ArcaneBoardManager* BoardManager = NewObject<UGS_ArcaneBoardManager>();
+	const FGS_RuneDataCatalog& RuneData = *BoardManager->GetRuneDataCatalog();
+	const ArcaneCore::FRuneCatalog& Catalog = RuneData.GetCatalog();
+	const ArcaneCore::FRuneIdRemap& Remap = RuneData.GetRemap();
+	const UEnum* ClassEnum = StaticEnum<ECharacterClass>();
+
+	TArray<ECharacterClass> Classes;
+	TArray<ArcaneCore::FBoardState> Boards;
+	Boards.Reserve(ClassEnum->NumEnums());
+	for (int32 EnumIndex = 0; EnumIndex < ClassEnum->NumEnums() - 1; ++EnumIndex)
+	{
+		const ECharacterClass Class = static_cast<ECharacterClass>(ClassEnum->GetValueByIndex(EnumIndex));
+		const ArcaneCore::FBoardLayout* Layout = BoardManager->GetClassLayout(Class);
+		if (!Layout || Layout->GetNumValidCells() == 0)
+		{
+			++NumErrors;
+			UE_LOG(LogArcaneBoardDataCheck, Error, TEXT("%s: 레이아웃이 없거나 유효한 칸이 없음"), *ClassEnum->GetNameStringByIndex(EnumIndex));
+			continue;
+		}
+
+		Classes.Add(Class);
+		Boards.AddDefaulted_GetRef().Reset(Layout, &Catalog, &RuneData.GetSynergyRules());
+	}
+
+	// 클래스 x 룬마다 독립 작업, 보드는 읽기만 하므로 공유
+	const int32 NumRunes = Remap.Num();
+	TArray<FRunePlacementStats> PlacementStats;
+	PlacementStats.SetNum(Classes.Num() * NumRunes);
+	ParallelFor(PlacementStats.Num(), [&](int32 TaskIndex)
+	{
+		const ArcaneCore::FBoardState& Board = Boards[TaskIndex / NumRunes];
+		const ArcaneCore::RuneId Id = static_cast<ArcaneCore::RuneId>(TaskIndex % NumRunes + 1);
+		FRunePlacementStats& Stats = PlacementStats[TaskIndex];
+
+		TArray<uint8, TInlineAllocator<8>> Orientations;
+		GetDistinctOrientations(Catalog, Id, Orientations);
+		Stats.NumOrientations = Orientations.Num();
+
+		ArcaneCore::FPlacementAnchorMap AnchorMap;
+		for (const uint8 Orient : Orientations)
+		{
+			if (Board.BuildAnchorMap(Id, Orient, AnchorMap))
+			{
+				Stats.NumPlacements += AnchorMap.CountResult(ArcaneCore::EPlacementResult::Valid);
+			}
+		}
+	});
+
+	// 탐색 공간: 룬마다 (놓지 않음 + 합법 배치 수)의 곱, 룬끼리 겹침은 무시하므로 상한
+	FString Report = TEXT("Class,RuneID,Orientations,Placements\n");
+	for (int32 ClassIndex = 0; ClassIndex < Classes.Num(); ++ClassIndex)
+	{
+		const FString ClassName = ClassEnum->GetNameStringByValue(static_cast<int64>(Classes[ClassIndex]));
+		const ArcaneCore::FBoardLayout& Layout = *Boards[ClassIndex].GetLayout();
+		double SearchSpaceLog10 = 0.0;
+		int64 TotalPlacements = 0;
+
+		for (int32 RuneIndex = 0; RuneIndex < NumRunes; ++RuneIndex)
+		{
+			const FRunePlacementStats& Stats = PlacementStats[ClassIndex * NumRunes + RuneIndex];
+			const int32 ExternalID = Remap.ToExternal(static_cast<ArcaneCore::RuneId>(RuneIndex + 1));
+			if (Stats.NumPlacements == 0)
+			{
+				++NumErrors;
+				UE_LOG(LogArcaneBoardDataCheck, Error, TEXT("%s: 룬 %d를 놓을 수 있는 곳이 없음"), *ClassName, ExternalID);
+			}
+
+			SearchSpaceLog10 += FMath::LogX(10.0, 1.0 + Stats.NumPlacements);
+			TotalPlacements += Stats.NumPlacements;
+			Report += FString::Printf(TEXT("%s,%d,%d,%d\n"), *ClassName, ExternalID, Stats.NumOrientations, Stats.NumPlacements);
+		}
+
+		UE_LOG(LogArcaneBoardDataCheck, Display, TEXT("%s: 유효 칸 %d, 룬 %d종, 합법 배치 %lld, 탐색 공간 약 10^%.1f"),
+			*ClassName, Layout.GetNumValidCells(), NumRunes, TotalPlacements, SearchSpaceLog10);
+	}
+
+	if (!FFileHelper::SaveStringToFile(Report, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogArcaneBoardDataCheck, Error, TEXT("출력 파일을 만들 수 없음: %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogArcaneBoardDataCheck, Display, TEXT("검사 완료 (%.2fs): 오류 %d, 경고 %d, 보고서 %s"),
+		FPlatformTime::Seconds() - StartTime, NumErrors, NumWarnings, *OutputPath);
+	return NumErrors > 0 ? 1 : 0;
+}
@@ -0,0 +1,26 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GS_ArcaneBoardDataCheckCommandlet.generated.h"
+
+/**
+ * 룬/레이아웃 데이터 검사 커맨드렛 (CI용, 헤드리스)
+ * - 룬 테이블: ID 중복/범위, 빈 모양, RuneShape와 ConnectedRuneShape 키 불일치, 알 수 없는 스탯
+ * - 클래스별 레이아웃: 빈 보드에서 룬마다 서로 다른 합법 배치 수를 병렬로 계산, 놓을 곳이 없는 룬은 오류
+ * - 탐색 공간 추정: 룬마다 (안 놓음 + 합법 배치 수)의 곱 (겹침 무시한 상한, log10)
+ * - 오류가 있으면 1 반환
+ * - 사용법: -run=GS_ArcaneBoardDataCheck [-Output=DataReport.csv]
+ */
+UCLASS()
+class GAS_API UGS_ArcaneBoardDataCheckCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGS_ArcaneBoardDataCheckCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
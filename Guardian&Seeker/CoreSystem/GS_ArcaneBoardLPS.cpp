@@ -3,15 +3,54 @@
 #include "RuneSystem/GS_ArcaneBoardLPS.h"
 #include "RuneSystem/GS_ArcaneBoardManager.h"
 #include "RuneSystem/GS_EnumUtils.h"
+#include "RuneSystem/GS_ArcaneBoardProfiling.h"
+#include "RuneSystem/GS_ArcaneBoardNetComponent.h"
+#include "RuneSystem/GS_ArcaneBoardTelemetry.h"
 #include "UI/RuneSystem/GS_ArcaneBoardWidget.h"
 #include "RuneSystem/GS_ArcaneBoardSaveGame.h"
 #include "Character/GS_Character.h"
 #include "Kismet/GameplayStatics.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarArcaneBoardUIPrewarmBudgetMs(
+    TEXT("ArcaneBoard.UIPrewarmBudgetMs"),
+    2.0f,
+    TEXT("프레임당 보드 UI 미리 만들기에 쓸 시간 (ms), 최소 한 단계는 진행"),
+    ECVF_Default);
 
 void UGS_ArcaneBoardLPS::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
     CurrentPresetIndex = 1;
+    PrewarmedBoardWidget = nullptr;
+    PrewarmZOrder = 0;
+    PrewarmStage = EUIPrewarmStage::None;
+    ReportedInventoryRevision = 0;
+}
+
+void UGS_ArcaneBoardLPS::Deinitialize()
+{
+    StopUIPrewarmTicker();
+    RuneIconHandle.Reset();
+    LayoutAssetHandle.Reset();
+
+    if (IsValid(PrewarmedBoardWidget))
+    {
+        PrewarmedBoardWidget->RemoveFromParent();
+    }
+    PrewarmedBoardWidget = nullptr;
+    PrewarmStage = EUIPrewarmStage::None;
+
+    if (IsValid(BoardManager))
+    {
+        BoardManager->OnBoardRevalidated().RemoveAll(this);
+    }
+
+    FGS_ArcaneBoardTelemetry::Get().Flush(true);
+
+    Super::Deinitialize();
 }
 
 ECharacterClass UGS_ArcaneBoardLPS::GetPlayerCharacterClass() const
@@ -41,8 +80,7 @@ void UGS_ArcaneBoardLPS::OnPlayerJobChanged(ESeekerJob SeekerJob)
 
     if (IsValid(BoardManager) && BoardManager->GetCurrClass() != NewCharacterClass)
     {
-        BoardManager->SetCurrClass(NewCharacterClass);
-        LoadBoardConfig();
+        SwitchBoardClass(NewCharacterClass);
     }
 }
 
@@ -66,8 +104,7 @@ void UGS_ArcaneBoardLPS::RefreshBoardForCurrCharacter()
 
     if (IsValid(BoardManager) && BoardManager->GetCurrClass() != CurrentClass)
     {
-        BoardManager->SetCurrClass(CurrentClass);
-        LoadBoardConfig();
+        SwitchBoardClass(CurrentClass);
     }
 }
 
@@ -89,9 +126,34 @@ void UGS_ArcaneBoardLPS::ApplyBoardChanges()
     {
         BoardManager->ApplyChanges();
         SaveBoardConfig();
+        FGS_ArcaneBoardTelemetry::Get().RecordAppliedBoard(*BoardManager);
+
+        // 실제 적용 스탯은 서버 검증 결과를 따름, 캐릭터에는 서버가 이전 적용분과의 차이만 반영
+        if (UGS_ArcaneBoardNetComponent* NetComponent = GetBoardNetComponent())
+        {
+            if (ReportedNetComponent.Get() != NetComponent || ReportedInventoryRevision != RuneInventory.GetRevision())
+            {
+                NetComponent->ReportOwnedRunes(GetOwnedRunes());
+                ReportedNetComponent = NetComponent;
+                ReportedInventoryRevision = RuneInventory.GetRevision();
+            }
+            NetComponent->SubmitBoard(BoardManager->CurrClass, BoardManager->PlacedRunes);
+        }
     }
 }
 
+UGS_ArcaneBoardNetComponent* UGS_ArcaneBoardLPS::GetBoardNetComponent() const
+{
+    if (APlayerController* PC = GetLocalPlayer()->GetPlayerController(GetWorld()))
+    {
+        if (APlayerState* PlayerState = PC->GetPlayerState<APlayerState>())
+        {
+            return PlayerState->FindComponentByClass<UGS_ArcaneBoardNetComponent>();
+        }
+    }
+    return nullptr;
+}
+
 void UGS_ArcaneBoardLPS::OnBoardStatsChanged(const FArcaneBoardStats& NewStats)
 {
     RuneSystemStats = NewStats;
@@ -113,6 +175,8 @@ bool UGS_ArcaneBoardLPS::HasUnsavedChanges() const
 
 void UGS_ArcaneBoardLPS::SaveBoardConfig(int32 PresetIndex)
 {
+    ARCANEBOARD_SCOPE_CYCLE_COUNTER(SaveBoardConfig);
+
     if (!IsValid(BoardManager))
     {
         return;
@@ -147,7 +211,19 @@ void UGS_ArcaneBoardLPS::SaveBoardConfig(int32 PresetIndex)
         CurrentPresetIndex = TargetPresetIndex;
     }
 
-    SaveGameInstance->OwnedRuneIDs = OwnedRuneIDs;
+    SaveGameInstance->OwnedRuneExternalIDs.Reset();
+    SaveGameInstance->RuneStackCounts.Reset();
+    RuneInventory.ForEach([this, SaveGameInstance](ArcaneCore::RuneId InternalID)
+    {
+        const int32 RuneID = BoardManager->ToExternalRuneID(InternalID);
+        SaveGameInstance->OwnedRuneExternalIDs.Add(RuneID);
+
+        const int32 Count = RuneInventory.GetCount(InternalID);
+        if (Count > 1)
+        {
+            SaveGameInstance->RuneStackCounts.Add(RuneID, Count);
+        }
+    });
 
     const FString SaveSlotName = TEXT("ArcaneBoardSave");
     const int32 UserIdx = 0;
@@ -166,6 +242,8 @@ void UGS_ArcaneBoardLPS::SaveBoardConfig(int32 PresetIndex)
 
 void UGS_ArcaneBoardLPS::LoadBoardConfig(int32 PresetIndex)
 {
+    ARCANEBOARD_SCOPE_CYCLE_COUNTER(LoadBoardConfig);
+
     if (!IsValid(BoardManager))
     {
         return;
@@ -273,6 +351,7 @@ UGS_ArcaneBoardManager* UGS_ArcaneBoardLPS::GetOrCreateBoardManager()
     {
         BoardManager = NewObject<UGS_ArcaneBoardManager>(this);
         BoardManager->OnStatsChanged.AddDynamic(this, &UGS_ArcaneBoardLPS::OnBoardStatsChanged);
+        BoardManager->OnBoardRevalidated().AddUObject(this, &UGS_ArcaneBoardLPS::HandleRuneDataChanged);
 
         ECharacterClass CurrPlayerClass = GetPlayerCharacterClass();
         BoardManager->SetCurrClass(CurrPlayerClass);
@@ -281,29 +360,61 @@ UGS_ArcaneBoardManager* UGS_ArcaneBoardLPS::GetOrCreateBoardManager()
     return BoardManager;
 }
 
-TArray<uint8> UGS_ArcaneBoardLPS::GetOwnedRunes() const
+TArray<int32> UGS_ArcaneBoardLPS::GetOwnedRunes() const
 {
-    return OwnedRuneIDs.Array();
+    TArray<int32> RuneIDs;
+    if (IsValid(BoardManager))
+    {
+        RuneIDs.Reserve(RuneInventory.Num());
+        RuneInventory.ForEach([this, &RuneIDs](ArcaneCore::RuneId InternalID)
+        {
+            RuneIDs.Add(BoardManager->ToExternalRuneID(InternalID));
+        });
+    }
+    return RuneIDs;
 }
 
-void UGS_ArcaneBoardLPS::AddRuneToInventory(uint8 RuneID)
+void UGS_ArcaneBoardLPS::AddRuneToInventory(int32 RuneID, int32 Count)
 {
-    if (RuneID > 0)
+    GetOrCreateBoardManager();
+
+    const ArcaneCore::RuneId InternalID = BoardManager->ToInternalRuneID(RuneID);
+    if (InternalID != 0 && Count > 0)
     {
-        OwnedRuneIDs.Add(RuneID);
-        UE_LOG(LogTemp, Log, TEXT("룬 획득: ID=%d, 총 소유 룬 개수: %d"), RuneID, OwnedRuneIDs.Num());
+        RuneInventory.Add(InternalID, static_cast<uint16>(FMath::Min(Count, static_cast<int32>(MAX_uint16))));
+        UE_LOG(LogTemp, Log, TEXT("룬 획득: ID=%d, 수량: %d, 총 소유 룬 개수: %d"), RuneID, RuneInventory.GetCount(InternalID), RuneInventory.Num());
 
         // 변경사항 저장
         SaveBoardConfig();
     }
 }
 
+int32 UGS_ArcaneBoardLPS::GetRuneCount(int32 RuneID) const
+{
+    return IsValid(BoardManager) ? RuneInventory.GetCount(BoardManager->ToInternalRuneID(RuneID)) : 0;
+}
+
+void UGS_ArcaneBoardLPS::GetUnplacedRunes(ArcaneCore::FRuneIdSet& OutRunes) const
+{
+    if (IsValid(BoardManager))
+    {
+        RuneInventory.GetUnplaced(BoardManager->GetBoardState().GetPlacedRunes(), OutRunes);
+    }
+    else
+    {
+        OutRunes = RuneInventory.GetOwned();
+    }
+}
+
 void UGS_ArcaneBoardLPS::InitializeTestRunes()
 {
-    OwnedRuneIDs.Empty();
-    for (uint8 i = 1; i <= 8; ++i)
+    GetOrCreateBoardManager();
+
+    RuneInventory.SetCatalog(&BoardManager->GetRuneCatalog());
+    RuneInventory.Clear();
+    for (int32 i = 1; i <= UGS_ArcaneBoardManager::NumStarterRunes; ++i)
     {
-        OwnedRuneIDs.Add(i);
+        RuneInventory.Add(BoardManager->ToInternalRuneID(i));
     }
 }
 
@@ -322,12 +433,71 @@ void UGS_ArcaneBoardLPS::ClearCurrUIWidget()
     CurrentUIWidget = nullptr;
 }
 
+void UGS_ArcaneBoardLPS::HandleRuneDataChanged(const FGS_RuneDataChange& Change)
+{
+    if (!IsValid(BoardManager))
+    {
+        return;
+    }
+
+    // 매니저가 보드를 다시 배치한 뒤 OnBoardRevalidated로 호출되므로 보드와 재매핑은 이미 갱신됨
+    if (Change.bRemapped)
+    {
+        const int32 NumDropped = RuneInventory.Remap(Change.OldRemap, BoardManager->GetRuneIdRemap());
+        if (NumDropped > 0)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("룬 데이터 변경으로 인벤토리에서 룬 %d종을 뺌"), NumDropped);
+        }
+    }
+
+    // 스탯/모양만 바뀌어도 정렬 보기는 다시 만들어야 함
+    RuneInventory.SetCatalog(&BoardManager->GetRuneCatalog());
+
+    if (CurrentUIWidget.IsValid())
+    {
+        CurrentUIWidget->RefreshForRuneDataChange(Change.bRemapped);
+    }
+    if (IsValid(PrewarmedBoardWidget) && PrewarmedBoardWidget != CurrentUIWidget.Get())
+    {
+        PrewarmedBoardWidget->RefreshForRuneDataChange(Change.bRemapped);
+    }
+}
+
+void UGS_ArcaneBoardLPS::SwitchBoardClass(ECharacterClass NewClass)
+{
+    // 이미 방문한 클래스는 상주 보드로 바로 전환, 세이브는 처음 방문할 때만 읽음
+    ResidentPresetIndices.Add(BoardManager->GetCurrClass(), CurrentPresetIndex);
+
+    const bool bFirstVisit = !BoardManager->IsClassBoardResident(NewClass);
+    if (!BoardManager->SetCurrClass(NewClass))
+    {
+        return;
+    }
+
+    if (bFirstVisit)
+    {
+        LoadBoardConfig();
+    }
+    else if (const int32* PresetIndex = ResidentPresetIndices.Find(NewClass))
+    {
+        CurrentPresetIndex = *PresetIndex;
+    }
+}
+
 void UGS_ArcaneBoardLPS::LoadRuneInventory(UGS_ArcaneBoardSaveGame* SaveGame)
 {
-    if (SaveGame->OwnedRuneIDs.Num() > 0)
+    if (SaveGame->OwnedRuneExternalIDs.Num() > 0)
     {
-        OwnedRuneIDs = SaveGame->OwnedRuneIDs;
-        UE_LOG(LogTemp, Log, TEXT("룬 인벤토리 로드 성공: %d개 룬"), OwnedRuneIDs.Num());
+        RuneInventory.SetCatalog(&BoardManager->GetRuneCatalog());
+        RuneInventory.Clear();
+        for (int32 RuneID : SaveGame->OwnedRuneExternalIDs)
+        {
+            // 테이블에서 빠진 룬은 0이 되어 무시
+            const int32* StackCount = SaveGame->RuneStackCounts.Find(RuneID);
+            RuneInventory.Add(BoardManager->ToInternalRuneID(RuneID),
+                static_cast<uint16>(StackCount ? FMath::Clamp(*StackCount, 1, static_cast<int32>(MAX_uint16)) : 1));
+        }
+        UE_LOG(LogTemp, Log, TEXT("룬 인벤토리 로드 성공: %d개 룬"), RuneInventory.Num());
     }
     else
     {
@@ -385,4 +555,211 @@ TArray<FPlacedRuneInfo>* UGS_ArcaneBoardLPS::GetPresetArray(FArcaneBoardPresets&
     return const_cast<TArray<FPlacedRuneInfo>*>(
         static_cast<const UGS_ArcaneBoardLPS*>(this)->GetPresetArray(
             static_cast<const FArcaneBoardPresets&>(Presets), PresetIndex));
-}
\ No newline at end of file
+}
+void UGS_ArcaneBoardLPS::PrewarmBoardUI(TSubclassOf<UGS_ArcaneBoardWidget> WidgetClass, int32 ZOrder)
+{
+    if (!WidgetClass || PrewarmStage != EUIPrewarmStage::None)
+    {
+        return;
+    }
+
+    PrewarmWidgetClass = WidgetClass;
+    PrewarmZOrder = ZOrder;
+    PrewarmStage = EUIPrewarmStage::LayoutAssets;
+    PrewarmTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UGS_ArcaneBoardLPS::TickUIPrewarm));
+}
+
+UGS_ArcaneBoardWidget* UGS_ArcaneBoardLPS::ShowBoardUI(TSubclassOf<UGS_ArcaneBoardWidget> WidgetClass, int32 ZOrder)
+{
+    if (PrewarmStage == EUIPrewarmStage::None || (WidgetClass && WidgetClass != PrewarmWidgetClass))
+    {
+        // 다른 클래스로 미리 만든 위젯은 버리고 새로 만듦
+        if (IsValid(PrewarmedBoardWidget))
+        {
+            PrewarmedBoardWidget->RemoveFromParent();
+            PrewarmedBoardWidget = nullptr;
+        }
+        StopUIPrewarmTicker();
+
+        PrewarmWidgetClass = WidgetClass;
+        PrewarmZOrder = ZOrder;
+        PrewarmStage = PrewarmWidgetClass ? EUIPrewarmStage::LayoutAssets : EUIPrewarmStage::None;
+    }
+
+    // 아이콘 로드는 비동기이므로 위젯 생성까지만 시간 제한 없이 마저 진행
+    while (PrewarmStage != EUIPrewarmStage::None && PrewarmStage < EUIPrewarmStage::RuneIcons)
+    {
+        const EUIPrewarmStage PrevStage = PrewarmStage;
+        RunUIPrewarmStage(TNumericLimits<double>::Max());
+        if (PrewarmStage == PrevStage)
+        {
+            break;
+        }
+    }
+
+    if (!IsValid(PrewarmedBoardWidget))
+    {
+        return nullptr;
+    }
+
+    // 숨겨 둔 동안 바뀐 직업/배치 반영 (같은 레이아웃이면 셀 위젯은 재사용)
+    PrewarmedBoardWidget->RefreshForCurrCharacter();
+    PrewarmedBoardWidget->SetVisibility(ESlateVisibility::Visible);
+    return PrewarmedBoardWidget;
+}
+
+void UGS_ArcaneBoardLPS::HideBoardUI()
+{
+    if (!IsValid(PrewarmedBoardWidget))
+    {
+        return;
+    }
+
+    if (PrewarmedBoardWidget->GetSelectedRuneID() != 0)
+    {
+        PrewarmedBoardWidget->EndRuneSelection(false);
+    }
+    PrewarmedBoardWidget->HideTooltip();
+    PrewarmedBoardWidget->SetVisibility(ESlateVisibility::Collapsed);
+}
+
+bool UGS_ArcaneBoardLPS::IsBoardUIPrewarmed() const
+{
+    return PrewarmStage >= EUIPrewarmStage::RuneIcons && IsValid(PrewarmedBoardWidget);
+}
+
+bool UGS_ArcaneBoardLPS::TickUIPrewarm(float DeltaTime)
+{
+    const double EndTime = FPlatformTime::Seconds() + CVarArcaneBoardUIPrewarmBudgetMs.GetValueOnGameThread() / 1000.0;
+
+    EUIPrewarmStage PrevStage;
+    do
+    {
+        PrevStage = PrewarmStage;
+        RunUIPrewarmStage(EndTime);
+    }
+    while (PrewarmStage != PrevStage && PrewarmStage != EUIPrewarmStage::Done && PrewarmStage != EUIPrewarmStage::None
+        && FPlatformTime::Seconds() < EndTime);
+
+    if (PrewarmStage == EUIPrewarmStage::Done || PrewarmStage == EUIPrewarmStage::None)
+    {
+        PrewarmTickerHandle.Reset();
+        return false;
+    }
+    return true;
+}
+
+void UGS_ArcaneBoardLPS::RunUIPrewarmStage(double EndTime)
+{
+    switch (PrewarmStage)
+    {
+    case EUIPrewarmStage::LayoutAssets:
+    {
+        // 매니저가 생성 중에 레이아웃을 동기 로드하지 않도록 미리 비동기로 읽음
+        if (!IsValid(BoardManager) && !LayoutAssetHandle.IsValid())
+        {
+            TArray<FSoftObjectPath> LayoutPaths;
+            GetDefault<UGS_ArcaneBoardManager>()->GetGridLayoutAssetPaths(LayoutPaths);
+            if (LayoutPaths.Num() > 0)
+            {
+                LayoutAssetHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(LayoutPaths, FStreamableDelegate());
+            }
+        }
+
+        // 바로 열 때는 기다리지 않음 (매니저의 동기 로드가 진행 중인 로드를 마저 끝냄)
+        const bool bLoading = LayoutAssetHandle.IsValid() && LayoutAssetHandle->IsLoadingInProgress();
+        if (!bLoading || EndTime == TNumericLimits<double>::Max())
+        {
+            PrewarmStage = EUIPrewarmStage::BoardData;
+        }
+        break;
+    }
+
+    case EUIPrewarmStage::BoardData:
+        // 룬/시너지 테이블 캐시와 레이아웃
+        GetOrCreateBoardManager();
+        PrewarmStage = EUIPrewarmStage::CreateWidget;
+        break;
+
+    case EUIPrewarmStage::CreateWidget:
+    {
+        // 플레이어 컨트롤러가 아직 없으면 다음 틱에 다시 시도
+        APlayerController* PC = GetLocalPlayer()->GetPlayerController(GetWorld());
+        if (!PC)
+        {
+            break;
+        }
+
+        PrewarmedBoardWidget = CreateWidget<UGS_ArcaneBoardWidget>(PC, PrewarmWidgetClass);
+        PrewarmStage = IsValid(PrewarmedBoardWidget) ? EUIPrewarmStage::ConstructWidget : EUIPrewarmStage::None;
+        break;
+    }
+
+    case EUIPrewarmStage::ConstructWidget:
+        // 숨긴 채 추가, 세이브 로드/그리드/인벤토리는 다음 단계에서 나눠서 만듦
+        PrewarmedBoardWidget->SetDeferBoardBuild(true);
+        PrewarmedBoardWidget->SetVisibility(ESlateVisibility::Collapsed);
+        PrewarmedBoardWidget->AddToViewport(PrewarmZOrder);
+        PrewarmStage = EUIPrewarmStage::BoardConfig;
+        break;
+
+    case EUIPrewarmStage::BoardConfig:
+        // 현재 직업 보드와 인벤토리를 세이브에서 읽어야 셀/항목을 만들 수 있음
+        LoadBoardConfig();
+        PrewarmStage = EUIPrewarmStage::BoardWidgets;
+        break;
+
+    case EUIPrewarmStage::BoardWidgets:
+        if (PrewarmedBoardWidget->PrewarmBoardChunk(EndTime))
+        {
+            PrewarmStage = EUIPrewarmStage::FinishBoard;
+        }
+        break;
+
+    case EUIPrewarmStage::FinishBoard:
+        // 셀/항목은 이미 있으므로 내용만 채움
+        PrewarmedBoardWidget->SetDeferBoardBuild(false);
+        PrewarmedBoardWidget->RefreshForCurrCharacter();
+        PrewarmStage = EUIPrewarmStage::PopupWidgets;
+        break;
+
+    case EUIPrewarmStage::PopupWidgets:
+        PrewarmedBoardWidget->PrewarmPopupWidgets();
+        PrewarmStage = EUIPrewarmStage::RuneIcons;
+        break;
+
+    case EUIPrewarmStage::RuneIcons:
+    {
+        // 인벤토리 아이콘은 핸들로 붙잡아 두어 처음 스크롤할 때 로드 대기가 없도록
+        TArray<FSoftObjectPath> IconPaths;
+        RuneInventory.ForEach([this, &IconPaths](ArcaneCore::RuneId InternalID)
+        {
+            const TSoftObjectPtr<UTexture2D> Icon = BoardManager->GetRuneTextureAsset(BoardManager->ToExternalRuneID(InternalID));
+            if (!Icon.IsNull())
+            {
+                IconPaths.Add(Icon.ToSoftObjectPath());
+            }
+        });
+
+        if (IconPaths.Num() > 0)
+        {
+            RuneIconHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(IconPaths, FStreamableDelegate(), FStreamableManager::AsyncLoadLowPriority);
+        }
+        PrewarmStage = EUIPrewarmStage::Done;
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+void UGS_ArcaneBoardLPS::StopUIPrewarmTicker()
+{
+    if (PrewarmTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(PrewarmTickerHandle);
+        PrewarmTickerHandle.Reset();
+    }
+}
@@ -4,7 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/LocalPlayerSubsystem.h"
+#include "Containers/Ticker.h"
 #include "GS_ArcaneBoardTypes.h"
+#include "ArcaneRuneInventory.h"
 #include "System/GS_PlayerRole.h"
 #include "System/GS_PlayerState.h"
 #include "GS_ArcaneBoardLPS.generated.h"
@@ -12,6 +14,9 @@
 class UGS_ArcaneBoardManager;
 class UGS_ArcaneBoardWidget;
 class UGS_ArcaneBoardSaveGame;
+class UGS_ArcaneBoardNetComponent;
+struct FStreamableHandle;
+struct FGS_RuneDataChange;
 
 /**
  * 룬 시스템을 관리하는 로컬 플레이어 서브 시스템
@@ -23,6 +28,7 @@ class GAS_API UGS_ArcaneBoardLPS : public ULocalPlayerSubsystem
 
 public:
     void Initialize(FSubsystemCollectionBase& Collection) override;
+    void Deinitialize() override;
 
     UPROPERTY()
     UGS_ArcaneBoardManager* BoardManager;
@@ -66,12 +72,21 @@ public:
     UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
     UGS_ArcaneBoardManager* GetOrCreateBoardManager();
 
-    // 룬 인벤 관련
+    // 룬 인벤 관련 (외부 룬 ID, 호출마다 배열 생성하므로 UI 갱신에는 GetRuneInventory 사용)
     UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
-    TArray<uint8> GetOwnedRunes() const;
+    TArray<int32> GetOwnedRunes() const;
 
     UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
-    void AddRuneToInventory(uint8 RuneID);
+    void AddRuneToInventory(int32 RuneID, int32 Count = 1);
+
+    UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
+    int32 GetRuneCount(int32 RuneID) const;
+
+    // 내부 인덱스 기준 인벤토리 (정렬 보기 캐시 포함)
+    const ArcaneCore::FRuneInventory& GetRuneInventory() const { return RuneInventory; }
+
+    // 보유했지만 현재 보드에 없는 룬 (내부 인덱스)
+    void GetUnplacedRunes(ArcaneCore::FRuneIdSet& OutRunes) const;
 
     // 테스트용
     UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
@@ -84,6 +99,26 @@ public:
     UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
     void ClearCurrUIWidget();
 
+    /**
+     * 보드 UI 미리 만들기 (로딩 화면/유휴 프레임에서 호출)
+     * - 레이아웃 비동기 로드 -> 데이터 캐시 -> 위젯 생성 -> 숨긴 채 뷰포트 추가 -> 세이브 로드
+     *   -> 셀 위젯/인벤토리 항목 (예산 안에서 나눠 생성) -> 툴팁/드래그 비주얼 -> 아이콘 비동기 로드 순서
+     * - 프레임당 ArcaneBoard.UIPrewarmBudgetMs 안에서 단계별로 진행
+     */
+    UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|UI")
+    void PrewarmBoardUI(TSubclassOf<UGS_ArcaneBoardWidget> WidgetClass, int32 ZOrder = 0);
+
+    // 미리 만든 위젯을 보이게 함, 남은 단계가 있으면 바로 마저 진행
+    UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|UI")
+    UGS_ArcaneBoardWidget* ShowBoardUI(TSubclassOf<UGS_ArcaneBoardWidget> WidgetClass, int32 ZOrder = 0);
+
+    // 제거하지 않고 숨김, 다음 열기에서 재사용
+    UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|UI")
+    void HideBoardUI();
+
+    UFUNCTION(BlueprintPure, Category = "ArcaneBoard|UI")
+    bool IsBoardUIPrewarmed() const;
+
     //ENUM 통일 전 임시
     ECharacterClass MapSeekerJobToCharacterClass(ESeekerJob SeekerJob) const;
 
@@ -91,15 +126,59 @@ private:
     UPROPERTY()
     TWeakObjectPtr<UGS_ArcaneBoardWidget> CurrentUIWidget;
 
-    UPROPERTY()
-    TSet<uint8> OwnedRuneIDs;
+    ArcaneCore::FRuneInventory RuneInventory;
+
+    // 서버에 마지막으로 보고한 인벤토리 (바뀌었거나 컴포넌트가 새로 생겼을 때만 다시 보냄)
+    TWeakObjectPtr<UGS_ArcaneBoardNetComponent> ReportedNetComponent;
+    uint32 ReportedInventoryRevision;
 
     UPROPERTY()
     int32 CurrentPresetIndex;
 
+    // 상주 보드로 전환한 클래스의 마지막 프리셋 번호
+    TMap<ECharacterClass, int32> ResidentPresetIndices;
+
+    enum class EUIPrewarmStage : uint8
+    {
+        None,
+        LayoutAssets,
+        BoardData,
+        CreateWidget,
+        ConstructWidget,
+        BoardConfig,
+        BoardWidgets,
+        FinishBoard,
+        PopupWidgets,
+        RuneIcons,
+        Done
+    };
+
+    // 미리 만든 보드 위젯 (숨김 상태로 뷰포트에 유지)
+    UPROPERTY()
+    UGS_ArcaneBoardWidget* PrewarmedBoardWidget;
+
+    UPROPERTY()
+    TSubclassOf<UGS_ArcaneBoardWidget> PrewarmWidgetClass;
+
+    int32 PrewarmZOrder;
+    EUIPrewarmStage PrewarmStage;
+    FTSTicker::FDelegateHandle PrewarmTickerHandle;
+    TSharedPtr<FStreamableHandle> RuneIconHandle;
+    TSharedPtr<FStreamableHandle> LayoutAssetHandle;
+
+    bool TickUIPrewarm(float DeltaTime);
+    // EndTime까지 현재 단계를 진행, 나눠 만드는 단계는 시간이 다 되면 같은 단계로 남음
+    void RunUIPrewarmStage(double EndTime);
+    void StopUIPrewarmTicker();
+
+    // 인벤토리는 내부 인덱스 기준이므로 룬 테이블이 재매핑되면 외부 ID로 되돌려 다시 채움
+    void HandleRuneDataChanged(const FGS_RuneDataChange& Change);
+
+    void SwitchBoardClass(ECharacterClass NewClass);
     void LoadRuneInventory(UGS_ArcaneBoardSaveGame* SaveGame);
     int32 DetermineTargetPresetIndex(int32 RequestedIndex, const FArcaneBoardPresets& ClassPresets) const;
     UGS_ArcaneBoardSaveGame* GetOrCreateSaveGame();
+    UGS_ArcaneBoardNetComponent* GetBoardNetComponent() const;
     const TArray<FPlacedRuneInfo>* GetPresetArray(const FArcaneBoardPresets& Presets, int32 PresetIndex) const;
     TArray<FPlacedRuneInfo>* GetPresetArray(FArcaneBoardPresets& Presets, int32 PresetIndex);
 };
\ No newline at end of file
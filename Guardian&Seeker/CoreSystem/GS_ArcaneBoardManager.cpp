@@ -3,7 +3,40 @@
 #include "RuneSystem/GS_ArcaneBoardManager.h"
 #include "RuneSystem/GS_GridLayoutDataAsset.h"
 #include "RuneSystem/GS_EnumUtils.h"
+#include "RuneSystem/GS_ArcaneBoardProfiling.h"
+#include "RuneSystem/GS_ArcaneBoardCoreAdapter.h"
 #include "Engine/DataTable.h"
+#include "Engine/Texture2D.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectIterator.h"
+
+static TAutoConsoleVariable<int32> CVarArcaneBoardRecordEdits(
+	TEXT("ArcaneBoard.RecordEdits"),
+	0,
+	TEXT("0보다 크면 새로 만든 보드 매니저가 이 레코드 수만큼 편집 기록 (재현/벤치마크용)"),
+	ECVF_Default);
+
+static FAutoConsoleCommand CmdArcaneBoardDumpEditLog(
+	TEXT("ArcaneBoard.DumpEditLog"),
+	TEXT("기록 중인 보드 매니저의 편집 기록을 Saved/ArcaneBoard/EditLogs에 저장"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		const FString Timestamp = FDateTime::Now().ToString();
+		for (TObjectIterator<UGS_ArcaneBoardManager> It; It; ++It)
+		{
+			if (It->IsRecordingEdits())
+			{
+				const FString FilePath = FPaths::ProjectSavedDir() / TEXT("ArcaneBoard/EditLogs") / FString::Printf(TEXT("%s_%s.abel"), *It->GetName(), *Timestamp);
+				UE_LOG(LogTemp, Display, TEXT("편집 기록 저장 %s: %s"), It->DumpEditRecording(FilePath) ? TEXT("성공") : TEXT("실패"), *FilePath);
+			}
+		}
+	}));
+
+const TCHAR* const UGS_ArcaneBoardManager::RuneDataTablePath = TEXT("/Game/DataTable/RuneSystem/DT_RuneDataTable");
 
 UGS_ArcaneBoardManager::UGS_ArcaneBoardManager()
 {
@@ -13,11 +46,16 @@ UGS_ArcaneBoardManager::UGS_ArcaneBoardManager()
 	AppliedBoardStats = FArcaneBoardStats();
 	CurrBoardStats = FArcaneBoardStats();
 	CurrGridLayout = nullptr;
+	ActiveClassBoard = nullptr;
+	Board = &EmptyBoard;
+	CurrLayout = &EmptyLayout;
 	ConnectedRuneCnt = 0;
 	bHasUnsavedChanges = false;
+	ReportedBoardStateMemory = 0;
+	EditLogStartTime = 0.0;
 
 	// 데이터 테이블 로드
-	static ConstructorHelpers::FObjectFinder<UDataTable> RuneTableFinder(TEXT("/Game/DataTable/RuneSystem/DT_RuneDataTable"));
+	static ConstructorHelpers::FObjectFinder<UDataTable> RuneTableFinder(RuneDataTablePath);
 	if (RuneTableFinder.Succeeded())
 	{
 		RuneTable = RuneTableFinder.Object;
@@ -37,13 +75,44 @@ UGS_ArcaneBoardManager::UGS_ArcaneBoardManager()
 		GridLayoutTable = nullptr;
 	}
 
+	static ConstructorHelpers::FObjectFinder<UDataTable> SynergyTableFinder(TEXT("/Game/DataTable/RuneSystem/DT_RuneSynergyTable"));
+	if (SynergyTableFinder.Succeeded())
+	{
+		SynergyTable = SynergyTableFinder.Object;
+	}
+	else
+	{
+		SynergyTable = nullptr;
+	}
+
 	// 데이터 테이블 로드 후 캐시 초기화
 	InitDataCache();
+
+	const int32 RecordCapacity = CVarArcaneBoardRecordEdits.GetValueOnAnyThread();
+	if (RecordCapacity > 0 && !HasAnyFlags(RF_ClassDefaultObject))
+	{
+		StartEditRecording(RecordCapacity);
+	}
+}
+
+void UGS_ArcaneBoardManager::BeginDestroy()
+{
+	DEC_MEMORY_STAT_BY(STAT_ArcaneBoard_BoardStateMemory, ReportedBoardStateMemory);
+	ReportedBoardStateMemory = 0;
+
+	if (RuneData.IsValid())
+	{
+		RuneData->OnRuneDataChanged().RemoveAll(this);
+	}
+
+	Super::BeginDestroy();
 }
 
 bool UGS_ArcaneBoardManager::SetCurrClass(ECharacterClass NewClass)
 {
-	if (CurrClass == NewClass && IsValid(CurrGridLayout))
+	RecordEdit(ArcaneCore::EBoardEditOp::SetClass, static_cast<uint8>(NewClass));
+
+	if (CurrClass == NewClass && IsValid(CurrGridLayout) && ActiveClassBoard)
 	{
 		return true;
 	}
@@ -53,19 +122,149 @@ bool UGS_ArcaneBoardManager::SetCurrClass(ECharacterClass NewClass)
 		return false;
 	}
 
-	bool bNeedGridReset = (CurrClass != NewClass);
+	StashActiveClassBoard();
+
 	CurrClass = NewClass;
 	CurrGridLayout = GridLayoutCache[NewClass];
+	ActivateClassBoard(NewClass);
+	return true;
+}
+
+bool UGS_ArcaneBoardManager::IsClassBoardResident(ECharacterClass Class) const
+{
+	return ClassBoards.Contains(Class);
+}
+
+void UGS_ArcaneBoardManager::StashActiveClassBoard()
+{
+	if (!ActiveClassBoard)
+	{
+		return;
+	}
+
+	ActiveClassBoard->CurrStats = CurrBoardStats;
+	ActiveClassBoard->AppliedStats = AppliedBoardStats;
+	ActiveClassBoard->bHasUnsavedChanges = bHasUnsavedChanges;
+}
+
+void UGS_ArcaneBoardManager::ActivateClassBoard(ECharacterClass Class)
+{
+	TUniquePtr<FClassBoard>& ClassBoard = ClassBoards.FindOrAdd(Class);
+	const bool bFirstVisit = !ClassBoard.IsValid();
+	if (bFirstVisit)
+	{
+		ClassBoard = MakeUnique<FClassBoard>();
+	}
+
+	ActiveClassBoard = ClassBoard.Get();
+	Board = &ActiveClassBoard->State;
 
-	if (bNeedGridReset)
+	const ArcaneCore::FBoardLayout* ClassLayout = GetClassLayout(Class);
+	CurrLayout = ClassLayout ? ClassLayout : &EmptyLayout;
+
+	if (bFirstVisit)
 	{
 		InitGridState();
 		CalculateStatEffects();
 		AppliedBoardStats = CurrBoardStats;
+		bHasUnsavedChanges = false;
+		UpdateBoardStateMemoryStats();
+		return;
 	}
 
-	bHasUnsavedChanges = false;
-	return true;
+	// 다시 방문한 클래스는 저장해 둔 상태를 그대로 사용 (재계산 없음)
+	CurrBoardStats = ActiveClassBoard->CurrStats;
+	AppliedBoardStats = ActiveClassBoard->AppliedStats;
+	bHasUnsavedChanges = ActiveClassBoard->bHasUnsavedChanges;
+	ConnectedRuneCnt = Board->GetConnectedRuneCount();
+	SyncPlacedRunes();
+	OnStatsChanged.Broadcast(CurrBoardStats);
+}
+
+void UGS_ArcaneBoardManager::HandleRuneDataChanged(const FGS_RuneDataChange& Change)
+{
+	// 레이아웃 고정 룬은 내부 인덱스로 만들어져 있으므로 재매핑되면 레이아웃도 다시 생성
+	if (Change.bRemapped)
+	{
+		ClassLayoutCache.Empty();
+	}
+
+	for (const TPair<ECharacterClass, TUniquePtr<FClassBoard>>& ClassBoard : ClassBoards)
+	{
+		bool bAffected = Change.bRebuildAll;
+		if (!bAffected)
+		{
+			ClassBoard.Value->State.GetPlacedRunes().ForEach([&Change, &bAffected](ArcaneCore::RuneId InternalID)
+			{
+				bAffected |= Change.ChangedRunes.Contains(InternalID);
+			});
+		}
+		if (!bAffected)
+		{
+			continue;
+		}
+
+		const int32 NumDropped = RevalidateClassBoard(ClassBoard.Key, *ClassBoard.Value, Change.OldRemap);
+		if (NumDropped > 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("룬 데이터 변경으로 %s 보드에서 룬 %d개를 뺌"), *UGS_EnumUtils::GetEnumAsString(ClassBoard.Key), NumDropped);
+		}
+
+		if (ClassBoard.Value.Get() == ActiveClassBoard)
+		{
+			const ArcaneCore::FBoardLayout* ClassLayout = GetClassLayout(ClassBoard.Key);
+			CurrLayout = ClassLayout ? ClassLayout : &EmptyLayout;
+			bHasUnsavedChanges |= NumDropped > 0;
+			SyncPlacedRunes();
+			CalculateStatEffects();
+			OnStatsChanged.Broadcast(CurrBoardStats);
+		}
+		else
+		{
+			ClassBoard.Value->bHasUnsavedChanges |= NumDropped > 0;
+			ClassBoard.Value->State.UpdateConnections();
+			ClassBoard.Value->CurrStats = ArcaneBoardAdapter::ToBoardStats(ClassBoard.Value->State.ComputeStats());
+		}
+	}
+
+	UpdateBoardStateMemoryStats();
+	BoardRevalidatedDelegate.Broadcast(Change);
+}
+
+int32 UGS_ArcaneBoardManager::RevalidateClassBoard(ECharacterClass Class, FClassBoard& ClassBoard, const ArcaneCore::FRuneIdRemap& OldRemap)
+{
+	TArray<FPlacedRuneInfo> Runes;
+	for (const ArcaneCore::FPlacement& Placement : ClassBoard.State.GetPlacements())
+	{
+		Runes.Add(ArcaneBoardAdapter::ToPlacedRuneInfo(Placement, OldRemap));
+	}
+
+	const ArcaneCore::FBoardLayout* ClassLayout = GetClassLayout(Class);
+	ClassBoard.State.Reset(ClassLayout ? ClassLayout : &EmptyLayout, &GetRuneCatalog(), &GetSynergyRules());
+
+	int32 NumDropped = 0;
+	for (const FPlacedRuneInfo& RuneInfo : Runes)
+	{
+		const ArcaneCore::FPlacement Placement = ArcaneBoardAdapter::ToPlacement(RuneInfo, GetRuneIdRemap());
+
+		// 레이아웃 고정 룬은 Reset에서 이미 놓임
+		if (Placement.Id != 0 && ClassBoard.State.FindPlacement(Placement.Id))
+		{
+			continue;
+		}
+
+		// 모양이 바뀌어 겹치거나 밖으로 나가면 다른 룬을 밀어내지 않고 뺌
+		if (GetRuneCatalog().Find(Placement.Id) &&
+			ClassBoard.State.CheckPlacement(Placement.Id, Placement.Pos, Placement.Orientation) == ArcaneCore::EPlacementResult::Valid)
+		{
+			ClassBoard.State.AddPlacementUnchecked(Placement);
+		}
+		else
+		{
+			++NumDropped;
+		}
+	}
+	return NumDropped;
 }
 
 bool UGS_ArcaneBoardManager::LoadGridLayoutForClass(ECharacterClass TargetClass)
@@ -98,87 +297,50 @@ bool UGS_ArcaneBoardManager::LoadGridLayoutForClass(ECharacterClass TargetClass)
 	return true;
 }
 
-EPlacementResult UGS_ArcaneBoardManager::CheckRunePlacement(uint8 RuneID, const FIntPoint& Pos, TArray<uint8>& OutAffectedRuneIDs)
+EPlacementResult UGS_ArcaneBoardManager::CheckRunePlacement(int32 RuneID, const FIntPoint& Pos, TArray<int32>& OutAffectedRuneIDs, uint8 Orientation)
 {
+	ARCANEBOARD_SCOPE_CYCLE_COUNTER(CheckRunePlacement);
+
 	OutAffectedRuneIDs.Empty();
 
-	TArray<FIntPoint> RuneShape;
-	if (!GetRuneShape(RuneID, RuneShape))
+	const ArcaneCore::RuneId InternalID = GetRuneIdRemap().ToInternal(RuneID);
+	if (!GetRuneCatalog().Find(InternalID))
 	{
 		return EPlacementResult::OutOfBounds;
 	}
 
-	bool bHasOverlapping = false;
-	bool bOutOfBounds = false;
-	TSet<uint8> OverlappingRuneIDSet;
-
-	for (const FIntPoint& Offset : RuneShape)
+	const ArcaneCore::EPlacementResult Result = Board->CheckPlacement(InternalID, ArcaneBoardAdapter::ToCellPos(Pos), Orientation, &ScratchRuneIDs);
+	for (ArcaneCore::RuneId AffectedID : ScratchRuneIDs)
 	{
-		FIntPoint CellPos = Pos + Offset;
-
-		if (!CurrGridState.Contains(CellPos))
-		{
-			bOutOfBounds = true;
-			continue;
-		}
-
-		const FGridCellData& CellData = CurrGridState[CellPos];
-		if (CellData.State == EGridCellState::Occupied && CellData.PlacedRuneID > 0)
-		{
-			bHasOverlapping = true;
-			OverlappingRuneIDSet.Add(CellData.PlacedRuneID);
-		}
+		OutAffectedRuneIDs.Add(GetRuneIdRemap().ToExternal(AffectedID));
 	}
 
-	OutAffectedRuneIDs = OverlappingRuneIDSet.Array();
-
-	if (bOutOfBounds)
-	{
-		return EPlacementResult::OutOfBounds;
-	}
-	else if (bHasOverlapping)
-	{
-		return EPlacementResult::ReplaceExisting;
-	}
-	else
-	{
-		return EPlacementResult::Valid;
-	}
+	return ArcaneBoardAdapter::ToPlacementResult(Result);
 }
 
-bool UGS_ArcaneBoardManager::PlaceRune(uint8 RuneID, const FIntPoint& Pos, TArray<uint8>& OutRemovedRunes)
+bool UGS_ArcaneBoardManager::PlaceRune(int32 RuneID, const FIntPoint& Pos, TArray<int32>& OutRemovedRunes, uint8 Orientation)
 {
-	OutRemovedRunes.Empty();
+	ARCANEBOARD_SCOPE_CYCLE_COUNTER(PlaceRune);
 
-	TArray<uint8> AffectedRuneIDs;
-	EPlacementResult PlacementResult = CheckRunePlacement(RuneID, Pos, AffectedRuneIDs);
+	RecordEdit(ArcaneCore::EBoardEditOp::Place, Orientation, RuneID, Pos);
+	OutRemovedRunes.Empty();
 
-	if (PlacementResult == EPlacementResult::OutOfBounds)
+	if (!GetRuneVariant(RuneID, Orientation))
 	{
 		return false;
 	}
 
-	// 겹치는 룬들 제거
-	if (PlacementResult == EPlacementResult::ReplaceExisting)
+	// 겹치는 룬 제거까지 코어에서 처리
+	if (!Board->Place(ArcaneBoardAdapter::ToPlacement(FPlacedRuneInfo(RuneID, Pos, Orientation), GetRuneIdRemap()), &ScratchRuneIDs))
 	{
-		for (uint8 OverlappingRuneID : AffectedRuneIDs)
-		{
-			if (RemoveRune(OverlappingRuneID))
-			{
-				OutRemovedRunes.Add(OverlappingRuneID);
-			}
-		}
+		return false;
 	}
-
-	TMap<FIntPoint, UTexture2D*> RuneShape;
-	if (!GetFragmentedRuneTexture(RuneID, RuneShape))
+	for (ArcaneCore::RuneId RemovedID : ScratchRuneIDs)
 	{
-		return false;
+		OutRemovedRunes.Add(GetRuneIdRemap().ToExternal(RemovedID));
 	}
 
-	PlacedRunes.Add(FPlacedRuneInfo(RuneID, Pos));
-	ApplyRuneToGrid(RuneID, Pos, EGridCellState::Occupied, true);
-
+	SyncPlacedRunes();
 	bHasUnsavedChanges = true;
 	CalculateStatEffects();
 	OnStatsChanged.Broadcast(CurrBoardStats);
@@ -186,27 +348,18 @@ bool UGS_ArcaneBoardManager::PlaceRune(uint8 RuneID, const FIntPoint& Pos, TArra
 	return true;
 }
 
-bool UGS_ArcaneBoardManager::RemoveRune(uint8 RuneID)
+bool UGS_ArcaneBoardManager::RemoveRune(int32 RuneID)
 {
-	int32 RuneIndex = INDEX_NONE;
-	for (int32 i = 0; i < PlacedRunes.Num(); ++i)
-	{
-		if (PlacedRunes[i].RuneID == RuneID)
-		{
-			RuneIndex = i;
-			break;
-		}
-	}
+	ARCANEBOARD_SCOPE_CYCLE_COUNTER(RemoveRune);
 
-	if (RuneIndex == INDEX_NONE)
+	RecordEdit(ArcaneCore::EBoardEditOp::Remove, 0, RuneID);
+
+	if (!Board->Remove(GetRuneIdRemap().ToInternal(RuneID)))
 	{
 		return false;
 	}
 
-	FIntPoint RunePos = PlacedRunes[RuneIndex].Pos;
-	ApplyRuneToGrid(RuneID, RunePos, EGridCellState::Empty, false);
-	PlacedRunes.RemoveAt(RuneIndex);
-
+	SyncPlacedRunes();
 	bHasUnsavedChanges = true;
 	CalculateStatEffects();
 	OnStatsChanged.Broadcast(CurrBoardStats);
@@ -214,137 +367,151 @@ bool UGS_ArcaneBoardManager::RemoveRune(uint8 RuneID)
 	return true;
 }
 
-void UGS_ArcaneBoardManager::CalculateStatEffects()
+bool UGS_ArcaneBoardManager::BuildPlacementAnchorMap(int32 RuneID, uint8 Orientation, ArcaneCore::FPlacementAnchorMap& OutAnchors) const
 {
-	UpdateConnections();
-
-	FGS_StatRow BaseStats, BonusStats;
-	float ConnectionBonus = static_cast<float>(ConnectedRuneCnt);
-
-	for (const FPlacedRuneInfo& RuneInfo : PlacedRunes)
-	{
-		FRuneTableRow RuneData;
-		if (!GetRuneData(RuneInfo.RuneID, RuneData))
-		{
-			continue;
-		}
+	ARCANEBOARD_SCOPE_CYCLE_COUNTER(BuildAnchorMap);
 
-		bool bIsConnected = IsRuneConnected(RuneInfo.RuneID);
-		ApplyRuneStatEffect(RuneData.StatEffect, BaseStats, BonusStats, bIsConnected, ConnectionBonus);
-	}
-
-	CurrBoardStats.RuneStats = BaseStats;
-	CurrBoardStats.BonusStats = BonusStats;
+	return Board->BuildAnchorMap(GetRuneIdRemap().ToInternal(RuneID), Orientation, OutAnchors);
 }
 
-void UGS_ArcaneBoardManager::ApplyRuneStatEffect(const FStatEffect& StatEffect, FGS_StatRow& BaseStats,
-	FGS_StatRow& BonusStats, bool bIsConnected, float BonusValue)
+bool UGS_ArcaneBoardManager::PreviewRunePlacement(int32 RuneID, const FIntPoint& Pos, FArcaneBoardPreview& OutPreview, uint8 Orientation) const
 {
-	const FName& StatName = StatEffect.StatName;
-	float StatValue = StatEffect.Value;
+	ARCANEBOARD_SCOPE_CYCLE_COUNTER(PreviewPlacement);
+
+	// 배열 용량은 유지
+	OutPreview.bIsValid = false;
+	OutPreview.StatDelta = FArcaneBoardStats();
+	OutPreview.ResultStats = FArcaneBoardStats();
+	OutPreview.DisplacedRuneIDs.Reset();
+	OutPreview.NewlyConnectedRuneIDs.Reset();
+	OutPreview.DisconnectedRuneIDs.Reset();
 
-	if (StatName == FName("HP"))
+	if (!GetRuneVariant(RuneID, Orientation))
 	{
-		BaseStats.HP += StatValue;
-		if (bIsConnected && BonusStats.HP == 0)
-		{
-			BonusStats.HP = BonusValue;
-		}
+		return false;
 	}
-	else if (StatName == FName("ATK"))
+
+	const ArcaneCore::FPlacement Placement = ArcaneBoardAdapter::ToPlacement(FPlacedRuneInfo(RuneID, Pos, Orientation), GetRuneIdRemap());
+	if (!ArcaneCore::PreviewPlacement(*Board, Placement, PreviewBoard, PreviewResult))
 	{
-		BaseStats.ATK += StatValue;
-		if (bIsConnected && BonusStats.ATK == 0)
-		{
-			BonusStats.ATK = BonusValue;
-		}
+		return false;
 	}
-	else if (StatName == FName("DEF"))
+
+	OutPreview.bIsValid = true;
+	OutPreview.StatDelta = ArcaneBoardAdapter::ToBoardStats(PreviewResult.StatDelta);
+	OutPreview.ResultStats = ArcaneBoardAdapter::ToBoardStats(PreviewResult.Stats);
+	for (ArcaneCore::RuneId InternalID : PreviewResult.Displaced)
 	{
-		BaseStats.DEF += StatValue;
-		if (bIsConnected && BonusStats.DEF == 0)
-		{
-			BonusStats.DEF = BonusValue;
-		}
+		OutPreview.DisplacedRuneIDs.Add(GetRuneIdRemap().ToExternal(InternalID));
 	}
-	else if (StatName == FName("AGL"))
+	for (ArcaneCore::RuneId InternalID : PreviewResult.NewlyConnected)
 	{
-		BaseStats.AGL += StatValue;
-		if (bIsConnected && BonusStats.AGL == 0)
-		{
-			BonusStats.AGL = BonusValue;
-		}
+		OutPreview.NewlyConnectedRuneIDs.Add(GetRuneIdRemap().ToExternal(InternalID));
 	}
-	else if (StatName == FName("ATS"))
+	for (ArcaneCore::RuneId InternalID : PreviewResult.Disconnected)
 	{
-		BaseStats.ATS += StatValue;
-		if (bIsConnected && BonusStats.ATS == 0)
-		{
-			BonusStats.ATS = BonusValue;
-		}
+		OutPreview.DisconnectedRuneIDs.Add(GetRuneIdRemap().ToExternal(InternalID));
 	}
+
+	return true;
+}
+
+void UGS_ArcaneBoardManager::CalculateStatEffects()
+{
+	ARCANEBOARD_SCOPE_CYCLE_COUNTER(CalculateStatEffects);
+
+	UpdateConnections();
+
+	// 시너지 보너스는 코어에서 배치 델타마다 누적된 값을 그대로 사용
+	CurrBoardStats = ArcaneBoardAdapter::ToBoardStats(Board->ComputeStats());
 }
 
-// DFS로 연결된 셀 탐색
 void UGS_ArcaneBoardManager::UpdateConnections()
 {
-	for (auto& CellPair : CurrGridState)
+	ARCANEBOARD_SCOPE_CYCLE_COUNTER(UpdateConnections);
+
+	Board->UpdateConnections();
+	ConnectedRuneCnt = Board->GetConnectedRuneCount();
+}
+
+const ArcaneCore::FBoardLayout* UGS_ArcaneBoardManager::GetClassLayout(ECharacterClass Class)
+{
+	if (const TUniquePtr<ArcaneCore::FBoardLayout>* CachedLayout = ClassLayoutCache.Find(Class))
 	{
-		CellPair.Value.bIsConnected = false;
+		return CachedLayout->Get();
 	}
 
-	TSet<FIntPoint> VisitedCells;
-	FindConnectedCells(SpecialCellPos, VisitedCells);
-
-	TSet<uint8> ConnectedRuneIDs;
-	for (const auto& CellPair : CurrGridState)
+	if (!LoadGridLayoutForClass(Class) || !IsValid(GridLayoutCache[Class]))
 	{
-		if (CellPair.Value.bIsConnected && CellPair.Value.PlacedRuneID > 0)
-		{
-			ConnectedRuneIDs.Add(CellPair.Value.PlacedRuneID);
-		}
+		return nullptr;
 	}
 
-	ConnectedRuneCnt = ConnectedRuneIDs.Num();
+	TUniquePtr<ArcaneCore::FBoardLayout>& NewLayout = ClassLayoutCache.Add(Class, MakeUnique<ArcaneCore::FBoardLayout>());
+	ArcaneBoardAdapter::BuildLayout(*GridLayoutCache[Class], GetRuneIdRemap(), *NewLayout);
+	return NewLayout.Get();
 }
 
-void UGS_ArcaneBoardManager::FindConnectedCells(const FIntPoint CellPos, TSet<FIntPoint>& VisitedCells)
+void UGS_ArcaneBoardManager::EvaluateBoardBatch(const ArcaneCore::FBoardBatch& Batch, TArray<FArcaneBoardBatchResult>& OutResults)
 {
-	if (VisitedCells.Contains(CellPos))
+	ARCANEBOARD_SCOPE_CYCLE_COUNTER(EvaluateBoardBatch);
+
+	OutResults.Reset();
+	const int32 NumBoards = Batch.Num();
+	if (NumBoards == 0)
 	{
 		return;
 	}
 
-	FGridCellData CellData;
-	if (!GetCellData(CellPos, CellData) || CellData.State == EGridCellState::Empty)
+	// 클래스별 코어 레이아웃 (인덱스 = ECharacterClass 값)
+	TArray<ECharacterClass> CachedClasses;
+	GridLayoutCache.GetKeys(CachedClasses);
+
+	std::vector<const ArcaneCore::FBoardLayout*> LayoutPtrs;
+	for (ECharacterClass Class : CachedClasses)
 	{
-		return;
+		const int32 LayoutIndex = static_cast<int32>(Class);
+		if (static_cast<int32>(LayoutPtrs.size()) <= LayoutIndex)
+		{
+			LayoutPtrs.resize(LayoutIndex + 1, nullptr);
+		}
+		LayoutPtrs[LayoutIndex] = GetClassLayout(Class);
 	}
 
-	VisitedCells.Add(CellPos);
-	if (CurrGridState.Contains(CellPos))
+	const ArcaneCore::FBatchEvaluator Evaluator(GetRuneCatalog(), GetSynergyRules(), LayoutPtrs);
+	std::vector<ArcaneCore::FBoardBatchResult> CoreResults(NumBoards);
+
+	constexpr int32 ChunkSize = 256;
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumBoards, ChunkSize);
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
 	{
-		CurrGridState[CellPos].bIsConnected = true;
-	}
+		const int32 BeginIndex = ChunkIndex * ChunkSize;
+		Evaluator.EvaluateRange(Batch, BeginIndex, FMath::Min(BeginIndex + ChunkSize, NumBoards), CoreResults.data());
+	});
 
-	static const TArray<FIntPoint> Directions = { {0, 1}, {0, -1}, {1, 0}, {-1, 0} };
-	for (const FIntPoint& Direction : Directions)
+	OutResults.SetNum(NumBoards);
+	for (int32 i = 0; i < NumBoards; ++i)
 	{
-		FIntPoint NextPos = CellPos + Direction;
-		FindConnectedCells(NextPos, VisitedCells);
+		OutResults[i].Stats = ArcaneBoardAdapter::ToBoardStats(CoreResults[i].Stats);
+		OutResults[i].ConnectedRuneCnt = CoreResults[i].ConnectedRuneCount;
+		OutResults[i].bIsValid = CoreResults[i].bValid;
 	}
 }
 
-bool UGS_ArcaneBoardManager::IsRuneConnected(uint8 RuneID) const
+bool UGS_ArcaneBoardManager::IsRuneConnected(int32 RuneID) const
 {
-	for (const auto& CellPair : CurrGridState)
+	const ArcaneCore::RuneId InternalID = GetRuneIdRemap().ToInternal(RuneID);
+	return InternalID != 0 && Board->IsRuneConnected(InternalID);
+}
+
+void UGS_ArcaneBoardManager::SyncPlacedRunes()
+{
+	const std::vector<ArcaneCore::FPlacement>& Placements = Board->GetPlacements();
+
+	PlacedRunes.Reset(Placements.size());
+	for (const ArcaneCore::FPlacement& Placement : Placements)
 	{
-		if (CellPair.Value.PlacedRuneID == RuneID && CellPair.Value.bIsConnected)
-		{
-			return true;
-		}
+		PlacedRunes.Add(ArcaneBoardAdapter::ToPlacedRuneInfo(Placement, GetRuneIdRemap()));
 	}
-	return false;
 }
 
 void UGS_ArcaneBoardManager::ApplyChanges()
@@ -356,6 +523,8 @@ void UGS_ArcaneBoardManager::ApplyChanges()
 
 void UGS_ArcaneBoardManager::ResetAllRune()
 {
+	RecordEdit(ArcaneCore::EBoardEditOp::ResetAll);
+
 	if (PlacedRunes.Num() == 0)
 	{
 		return;
@@ -370,15 +539,21 @@ void UGS_ArcaneBoardManager::ResetAllRune()
 
 void UGS_ArcaneBoardManager::LoadSavedData(ECharacterClass Class, const TArray<FPlacedRuneInfo>& Runes)
 {
-	PlacedRunes.Empty();
+	RecordEdit(ArcaneCore::EBoardEditOp::Load, static_cast<uint8>(Class), 0, FIntPoint::ZeroValue, &Runes);
+
 	InitGridState();
 	CurrBoardStats = FArcaneBoardStats();
 
 	for (const FPlacedRuneInfo& RuneInfo : Runes)
 	{
-		PlacedRunes.Add(RuneInfo);
-		ApplyRuneToGrid(RuneInfo.RuneID, RuneInfo.Pos, EGridCellState::Occupied, true);
+		// 테이블에서 빠진 룬은 건너뜀
+		const ArcaneCore::FPlacement Placement = ArcaneBoardAdapter::ToPlacement(RuneInfo, GetRuneIdRemap());
+		if (GetRuneCatalog().Find(Placement.Id))
+		{
+			Board->AddPlacementUnchecked(Placement);
+		}
 	}
+	SyncPlacedRunes();
 
 	CalculateStatEffects();
 	AppliedBoardStats = CurrBoardStats;
@@ -388,107 +563,139 @@ void UGS_ArcaneBoardManager::LoadSavedData(ECharacterClass Class, const TArray<F
 
 void UGS_ArcaneBoardManager::InitGridState()
 {
-	CurrGridState.Empty();
-	PlacedRunes.Empty();
+	// 레이아웃은 클래스별 캐시를 공유, 레이아웃에 미리 점유된 셀은 배치 목록에 포함
+	Board->Reset(CurrLayout, &GetRuneCatalog(), &GetSynergyRules());
+	ConnectedRuneCnt = 0;
+	SyncPlacedRunes();
+}
+
+void UGS_ArcaneBoardManager::InitDataCache()
+{
+	GridLayoutCache.Empty();
 
-	if (!IsValid(CurrGridLayout))
+	// 상주 보드가 레이아웃 캐시와 룬 데이터를 참조하므로 먼저 비움
+	ClassBoards.Empty();
+	ActiveClassBoard = nullptr;
+	Board = &EmptyBoard;
+	CurrLayout = &EmptyLayout;
+	ClassLayoutCache.Empty();
+
+	// 같은 테이블을 쓰는 다른 매니저가 이미 만들었으면 그대로 공유
+	if (RuneData.IsValid())
 	{
-		return;
+		RuneData->OnRuneDataChanged().RemoveAll(this);
 	}
+	RuneData = FGS_RuneDataCatalog::GetShared(RuneTable, SynergyTable);
+	RuneData->OnRuneDataChanged().AddUObject(this, &UGS_ArcaneBoardManager::HandleRuneDataChanged);
 
-	for (const FGridCellData& Cell : CurrGridLayout->GridCells)
-	{
-		FGridCellData NewCell = Cell;
+	CacheGridLayouts();
+	UpdateBoardStateMemoryStats();
+	SetCurrClass(CurrClass);
+}
 
-		if (NewCell.State == EGridCellState::Empty)
-		{
-			NewCell.PlacedRuneID = 0;
-		}
-		else if (NewCell.State == EGridCellState::Occupied)
-		{
-			PlacedRunes.Add(FPlacedRuneInfo(Cell.PlacedRuneID, Cell.Pos));
-		}
+void UGS_ArcaneBoardManager::StartEditRecording(int32 Capacity)
+{
+	EditLog.Init(Capacity);
+	EditLogStartTime = FPlatformTime::Seconds();
 
-		CurrGridState.Add(Cell.Pos, NewCell);
+	// 재생 시작점
+	RecordSnapshot();
+}
 
-		if (Cell.bIsSpecialCell)
-		{
-			SpecialCellPos = Cell.Pos;
-		}
-	}
+void UGS_ArcaneBoardManager::StopEditRecording()
+{
+	EditLog.Init(0);
 }
 
-void UGS_ArcaneBoardManager::ApplyRuneToGrid(uint8 RuneID, const FIntPoint& Position, EGridCellState NewState, bool bApplyTexture)
+bool UGS_ArcaneBoardManager::DumpEditRecording(const FString& FilePath) const
 {
-	TMap<FIntPoint, UTexture2D*> RuneShape, ConnectedRuneShape;
-	if (!GetFragmentedRuneTexture(RuneID, RuneShape) ||
-		!GetConnectedFragmentedRuneTexture(RuneID, ConnectedRuneShape))
+	if (!EditLog.IsEnabled())
 	{
-		return;
+		return false;
 	}
 
-	for (const auto& ShapePair : RuneShape)
-	{
-		FIntPoint CellPos = Position + ShapePair.Key;
-
-		UTexture2D* NormalTexture = nullptr;
-		UTexture2D* ConnectedTexture = nullptr;
-		uint8 RuneIDToApply = 0;
-
-		if (NewState == EGridCellState::Occupied && bApplyTexture)
-		{
-			NormalTexture = ShapePair.Value;
-			RuneIDToApply = RuneID;
-
-			if (ConnectedRuneShape.Contains(ShapePair.Key))
-			{
-				ConnectedTexture = ConnectedRuneShape[ShapePair.Key];
-			}
-		}
-
-		UpdateCellState(CellPos, NewState, RuneIDToApply, NormalTexture, ConnectedTexture);
-	}
+	std::vector<uint8> Bytes;
+	EditLog.Serialize(Bytes);
+	return FFileHelper::SaveArrayToFile(TArrayView<const uint8>(Bytes.data(), static_cast<int32>(Bytes.size())), *FilePath);
 }
 
-void UGS_ArcaneBoardManager::UpdateCellState(const FIntPoint& Pos, EGridCellState NewState, uint8 RuneID,
-	UTexture2D* RuneTextureFrag, UTexture2D* ConnectedRuneTextureFrag)
+void UGS_ArcaneBoardManager::RecordEdit(ArcaneCore::EBoardEditOp Op, uint8 Arg, int32 RuneID, const FIntPoint& Pos, const TArray<FPlacedRuneInfo>* Runes)
 {
-	if (CurrGridState.Contains(Pos))
+	if (!EditLog.IsEnabled())
+	{
+		return;
+	}
+
+	// 링이 돌아 앞부분이 잘려도 재생할 수 있도록 편집 전 상태를 주기적으로 남김
+	if (EditLog.NeedsSnapshot())
 	{
-		FGridCellData& CellData = CurrGridState[Pos];
-		CellData.State = NewState;
-		CellData.PlacedRuneID = RuneID;
-		CellData.RuneTextureFrag = RuneTextureFrag;
-		CellData.ConnectedRuneTextureFrag = ConnectedRuneTextureFrag;
+		RecordSnapshot();
 	}
+	AppendEditRecords(Op, Arg, RuneID, Pos, Runes);
 }
 
-void UGS_ArcaneBoardManager::InitDataCache()
+void UGS_ArcaneBoardManager::AppendEditRecords(ArcaneCore::EBoardEditOp Op, uint8 Arg, int32 RuneID, const FIntPoint& Pos, const TArray<FPlacedRuneInfo>* Runes)
 {
-	RuneDataCache.Empty();
-	GridLayoutCache.Empty();
-	CacheRuneData();
-	CacheGridLayouts();
-	SetCurrClass(CurrClass);
+	ArcaneCore::FBoardEditRecord Record;
+	Record.TimeMs = static_cast<uint32>((FPlatformTime::Seconds() - EditLogStartTime) * 1000.0);
+	Record.RuneId = RuneID;
+	Record.X = static_cast<int16>(Pos.X);
+	Record.Y = static_cast<int16>(Pos.Y);
+	Record.Op = Op;
+	Record.Arg = Arg;
+	Record.Count = Runes ? static_cast<uint16>(FMath::Min(Runes->Num(), static_cast<int32>(MAX_uint16))) : 0;
+	EditLog.Add(Record);
+
+	for (int32 i = 0; i < Record.Count; ++i)
+	{
+		const FPlacedRuneInfo& RuneInfo = (*Runes)[i];
+		ArcaneCore::FBoardEditRecord RuneRecord;
+		RuneRecord.TimeMs = Record.TimeMs;
+		RuneRecord.RuneId = RuneInfo.RuneID;
+		RuneRecord.X = static_cast<int16>(RuneInfo.Pos.X);
+		RuneRecord.Y = static_cast<int16>(RuneInfo.Pos.Y);
+		RuneRecord.Op = ArcaneCore::EBoardEditOp::Rune;
+		RuneRecord.Arg = RuneInfo.Orientation;
+		EditLog.Add(RuneRecord);
+	}
 }
 
-void UGS_ArcaneBoardManager::CacheRuneData()
+void UGS_ArcaneBoardManager::RecordSnapshot()
 {
-	if (!IsValid(RuneTable))
+	// 다른 클래스 상주 보드도 남겨야 재생 중 클래스 전환 결과가 같음
+	TArray<FPlacedRuneInfo> Runes;
+	int32 BlockIndex = 0;
+	for (const TPair<ECharacterClass, TUniquePtr<FClassBoard>>& ClassBoard : ClassBoards)
 	{
-		return;
+		if (ClassBoard.Value.Get() == ActiveClassBoard)
+		{
+			continue;
+		}
+
+		Runes.Reset();
+		for (const ArcaneCore::FPlacement& Placement : ClassBoard.Value->State.GetPlacements())
+		{
+			Runes.Add(ArcaneBoardAdapter::ToPlacedRuneInfo(Placement, GetRuneIdRemap()));
+		}
+		AppendEditRecords(ArcaneCore::EBoardEditOp::Snapshot, static_cast<uint8>(ClassBoard.Key), 0, FIntPoint(BlockIndex++, 0), &Runes);
 	}
 
-	TArray<FRuneTableRow*> RuneRows;
-	RuneTable->GetAllRows<FRuneTableRow>(TEXT("CacheRuneData"), RuneRows);
+	AppendEditRecords(ArcaneCore::EBoardEditOp::Snapshot, static_cast<uint8>(CurrClass), 0, FIntPoint(BlockIndex, 0), &PlacedRunes);
+}
 
-	for (FRuneTableRow* Row : RuneRows)
+void UGS_ArcaneBoardManager::UpdateBoardStateMemoryStats()
+{
+#if STATS
+	int64 BoardStateMemory = 0;
+	for (const TPair<ECharacterClass, TUniquePtr<FClassBoard>>& ClassBoard : ClassBoards)
 	{
-		if (Row)
-		{
-			RuneDataCache.Add(Row->RuneID, *Row);
-		}
+		BoardStateMemory += ClassBoard.Value->State.GetAllocatedSize();
 	}
+
+	DEC_MEMORY_STAT_BY(STAT_ArcaneBoard_BoardStateMemory, ReportedBoardStateMemory);
+	INC_MEMORY_STAT_BY(STAT_ArcaneBoard_BoardStateMemory, BoardStateMemory);
+	ReportedBoardStateMemory = BoardStateMemory;
+#endif
 }
 
 void UGS_ArcaneBoardManager::CacheGridLayouts()
@@ -514,81 +721,192 @@ void UGS_ArcaneBoardManager::CacheGridLayouts()
 	}
 }
 
-bool UGS_ArcaneBoardManager::GetRuneData(uint8 RuneID, FRuneTableRow& OutData)
+void UGS_ArcaneBoardManager::GetGridLayoutAssetPaths(TArray<FSoftObjectPath>& OutPaths) const
 {
-	// 캐시에서 먼저 찾기
-	if (RuneDataCache.Contains(RuneID))
+	if (!IsValid(GridLayoutTable))
 	{
-		OutData = RuneDataCache[RuneID];
-		return true;
+		return;
 	}
 
-	// 캐시에 없으면 테이블에서 찾아서 캐싱
-	if (IsValid(RuneTable))
-	{
-		FString RowName = FString::FromInt(RuneID);
-		FRuneTableRow* FoundRow = RuneTable->FindRow<FRuneTableRow>(*RowName, TEXT("GetRuneData"));
+	TArray<FGridLayoutTableRow*> GridRows;
+	GridLayoutTable->GetAllRows<FGridLayoutTableRow>(TEXT("GetGridLayoutAssetPaths"), GridRows);
 
-		if (FoundRow)
+	for (const FGridLayoutTableRow* Row : GridRows)
+	{
+		if (Row && !Row->GridLayoutAsset.IsNull())
 		{
-			RuneDataCache.Add(RuneID, *FoundRow);
-			OutData = *FoundRow;
-			return true;
+			OutPaths.Add(Row->GridLayoutAsset.ToSoftObjectPath());
 		}
 	}
+}
 
-	return false;
+bool UGS_ArcaneBoardManager::GetRuneData(int32 RuneID, FRuneTableRow& OutData)
+{
+	// 블루프린트용 복사, 네이티브 코드는 공용 룬 데이터의 행을 직접 참조
+	const FRuneTableRow* Row = FindRuneRow(RuneID);
+	if (!Row)
+	{
+		return false;
+	}
+
+	OutData = *Row;
+	return true;
 }
 
 bool UGS_ArcaneBoardManager::GetCellData(const FIntPoint& Pos, FGridCellData& OutCellData)
 {
-	if (CurrGridState.Contains(Pos))
+	const int32 CellIndex = CurrLayout->ToIndex(ArcaneBoardAdapter::ToCellPos(Pos));
+	if (CellIndex < 0)
 	{
-		OutCellData = CurrGridState[Pos];
-		return true;
+		return false;
 	}
-	return false;
+
+	const uint8 CellFlags = Board->GetCellFlags(CellIndex);
+	OutCellData.Pos = Pos;
+	OutCellData.State = (CellFlags & ArcaneCore::FBoardState::CF_Occupied) ? EGridCellState::Occupied : EGridCellState::Empty;
+	OutCellData.bIsSpecialCell = CurrLayout->IsSpecial(CellIndex);
+	OutCellData.bIsConnected = (CellFlags & ArcaneCore::FBoardState::CF_Connected) != 0;
+	OutCellData.PlacedRuneID = GetRuneIdRemap().ToExternal(Board->GetRuneAt(CellIndex));
+	return true;
+}
+
+int32 UGS_ArcaneBoardManager::GetSourceCellCount() const
+{
+	return CurrLayout->GetNumSourceCells();
+}
+
+int32 UGS_ArcaneBoardManager::GetSourceConnectedRuneCount(int32 SourceIndex) const
+{
+	return Board->GetSourceConnectedRuneCount(SourceIndex);
 }
 
-bool UGS_ArcaneBoardManager::GetRuneShape(uint8 RuneID, TArray<FIntPoint>& OutShape)
+UTexture2D* UGS_ArcaneBoardManager::GetCellRuneTexture(const FIntPoint& Pos, uint8& OutOrientation)
 {
-	FRuneTableRow RuneData;
-	if (GetRuneData(RuneID, RuneData))
+	OutOrientation = 0;
+
+	const int32 CellIndex = CurrLayout->ToIndex(ArcaneBoardAdapter::ToCellPos(Pos));
+	if (CellIndex < 0 || Board->GetRuneAt(CellIndex) == 0)
+	{
+		return nullptr;
+	}
+
+	const ArcaneCore::FPlacement* Placement = Board->FindPlacement(Board->GetRuneAt(CellIndex));
+	const FRuneFragmentTextures* Textures = Placement ? RuneData->FindTextures(Placement->Id) : nullptr;
+	const ArcaneCore::FRuneVariant* Variant = Placement ? GetRuneCatalog().FindVariant(Placement->Id, Placement->Orientation) : nullptr;
+	if (!Textures || !Variant)
+	{
+		return nullptr;
+	}
+
+	// (룬 ID, 로컬 오프셋)으로 조각 텍스처 결정
+	const ArcaneCore::FCellPos LocalOffset = ArcaneBoardAdapter::ToCellPos(Pos) - Placement->Pos;
+	const ArcaneCore::FCellPos* Offsets = GetRuneCatalog().GetOffsets(*Variant);
+	int32 FragIndex = INDEX_NONE;
+	for (int32 i = 0; i < Variant->NumOffsets; ++i)
+	{
+		if (Offsets[i] == LocalOffset)
+		{
+			FragIndex = i;
+			break;
+		}
+	}
+
+	if (!Textures->RuneTextureFrags.IsValidIndex(FragIndex))
 	{
-		RuneData.RuneShape.GenerateKeyArray(OutShape);
+		return nullptr;
+	}
+
+	OutOrientation = Placement->Orientation;
+
+	UTexture2D* ConnectedTexture = Textures->ConnectedRuneTextureFrags[FragIndex];
+	if (Board->IsConnectedCell(CellIndex) && ConnectedTexture)
+	{
+		return ConnectedTexture;
+	}
+	return Textures->RuneTextureFrags[FragIndex];
+}
+
+bool UGS_ArcaneBoardManager::GetPlacedRuneInfo(int32 RuneID, FPlacedRuneInfo& OutRuneInfo) const
+{
+	const ArcaneCore::RuneId InternalID = GetRuneIdRemap().ToInternal(RuneID);
+	if (const ArcaneCore::FPlacement* Placement = InternalID != 0 ? Board->FindPlacement(InternalID) : nullptr)
+	{
+		OutRuneInfo = ArcaneBoardAdapter::ToPlacedRuneInfo(*Placement, GetRuneIdRemap());
 		return true;
 	}
 	return false;
 }
 
-UTexture2D* UGS_ArcaneBoardManager::GetRuneTexture(uint8 RuneID)
+bool UGS_ArcaneBoardManager::GetRuneShape(int32 RuneID, TArray<FIntPoint>& OutShape, uint8 Orientation)
 {
-	FRuneTableRow RuneData;
-	if (GetRuneData(RuneID, RuneData))
+	const ArcaneCore::FRuneVariant* Variant = GetRuneVariant(RuneID, Orientation);
+	if (!Variant)
+	{
+		return false;
+	}
+
+	const ArcaneCore::FCellPos* Offsets = GetRuneCatalog().GetOffsets(*Variant);
+	OutShape.Reset(Variant->NumOffsets);
+	for (int32 i = 0; i < Variant->NumOffsets; ++i)
 	{
-		return RuneData.RuneTexture.LoadSynchronous();
+		OutShape.Add(ArcaneBoardAdapter::ToIntPoint(Offsets[i]));
 	}
-	return nullptr;
+	return true;
+}
+
+UTexture2D* UGS_ArcaneBoardManager::GetRuneTexture(int32 RuneID)
+{
+	return GetRuneTextureAsset(RuneID).LoadSynchronous();
 }
 
-bool UGS_ArcaneBoardManager::GetFragmentedRuneTexture(uint8 RuneID, TMap<FIntPoint, UTexture2D*>& OutShape)
+TSoftObjectPtr<UTexture2D> UGS_ArcaneBoardManager::GetRuneTextureAsset(int32 RuneID) const
 {
-	FRuneTableRow RuneData;
-	if (GetRuneData(RuneID, RuneData))
+	const FRuneTableRow* Row = FindRuneRow(RuneID);
+	return Row ? Row->RuneTexture : TSoftObjectPtr<UTexture2D>();
+}
+
+bool UGS_ArcaneBoardManager::GetFragmentedRuneTexture(int32 RuneID, TMap<FIntPoint, UTexture2D*>& OutShape, uint8 Orientation)
+{
+	const ArcaneCore::FRuneVariant* Variant = GetRuneVariant(RuneID, Orientation);
+	if (!Variant)
 	{
-		OutShape = RuneData.RuneShape;
-		return true;
+		return false;
 	}
-	return false;
+
+	const FRuneFragmentTextures* Textures = RuneData->FindTextures(GetRuneIdRemap().ToInternal(RuneID));
+
+	const ArcaneCore::FCellPos* Offsets = GetRuneCatalog().GetOffsets(*Variant);
+	OutShape.Empty(Variant->NumOffsets);
+	for (int32 i = 0; i < Variant->NumOffsets; ++i)
+	{
+		OutShape.Add(ArcaneBoardAdapter::ToIntPoint(Offsets[i]), Textures->RuneTextureFrags[i]);
+	}
+	return true;
 }
 
-bool UGS_ArcaneBoardManager::GetConnectedFragmentedRuneTexture(uint8 RuneID, TMap<FIntPoint, UTexture2D*>& OutShape)
+bool UGS_ArcaneBoardManager::GetConnectedFragmentedRuneTexture(int32 RuneID, TMap<FIntPoint, UTexture2D*>& OutShape, uint8 Orientation)
 {
-	FRuneTableRow RuneData;
-	if (GetRuneData(RuneID, RuneData))
+	const ArcaneCore::FRuneVariant* Variant = GetRuneVariant(RuneID, Orientation);
+	if (!Variant)
 	{
-		OutShape = RuneData.ConnectedRuneShape;
-		return true;
+		return false;
 	}
-	return false;
+
+	const FRuneFragmentTextures* Textures = RuneData->FindTextures(GetRuneIdRemap().ToInternal(RuneID));
+
+	const ArcaneCore::FCellPos* Offsets = GetRuneCatalog().GetOffsets(*Variant);
+	OutShape.Empty(Variant->NumOffsets);
+	for (int32 i = 0; i < Variant->NumOffsets; ++i)
+	{
+		if (Textures->ConnectedRuneTextureFrags[i])
+		{
+			OutShape.Add(ArcaneBoardAdapter::ToIntPoint(Offsets[i]), Textures->ConnectedRuneTextureFrags[i]);
+		}
+	}
+	return true;
+}
+
+const ArcaneCore::FRuneVariant* UGS_ArcaneBoardManager::GetRuneVariant(int32 RuneID, uint8 Orientation) const
+{
+	return GetRuneCatalog().FindVariant(GetRuneIdRemap().ToInternal(RuneID), Orientation);
 }
\ No newline at end of file
@@ -6,15 +6,23 @@
 #include "UObject/NoExportTypes.h"
 #include "GS_ArcaneBoardTableRows.h"
 #include "GS_ArcaneBoardTypes.h"
+#include "GS_RuneDataCatalog.h"
+#include "ArcaneBoardLayout.h"
+#include "ArcaneSynergy.h"
+#include "ArcaneBoardState.h"
+#include "ArcaneBatchEvaluator.h"
+#include "ArcaneBoardEditLog.h"
 #include "GS_ArcaneBoardManager.generated.h"
 
 class UGS_GridLayoutDataAsset;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStatsChangedDelegate, const FArcaneBoardStats&, BoardStats);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnBoardRevalidatedDelegate, const FGS_RuneDataChange&);
 
 /**
  * 룬 시스템 핵심 매니저
  * - 룬 배치/제거, 실시간 스탯 계산, 연결성 탐지
+ * - 알고리즘은 엔진 비의존 ArcaneBoardCore에 있고, 여기서는 데이터 로드와 UE 타입 변환을 담당
  */
 UCLASS()
 class GAS_API UGS_ArcaneBoardManager : public UObject
@@ -24,6 +32,14 @@ class GAS_API UGS_ArcaneBoardManager : public UObject
 public:
 	UGS_ArcaneBoardManager();
 
+	// 레이아웃 쿠킹 등 매니저 밖에서 같은 룬 테이블을 읽을 때 사용
+	static const TCHAR* const RuneDataTablePath;
+
+	// 세이브가 없는 플레이어에게 주는 기본 룬 (외부 ID 1 ~ NumStarterRunes)
+	static constexpr int32 NumStarterRunes = 8;
+
+	virtual void BeginDestroy() override;
+
 	UPROPERTY(BlueprintReadWrite, Category = "ArcaneBoard")
 	ECharacterClass CurrClass;
 
@@ -45,25 +61,47 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "ArcaneBoard|Events")
 	FOnStatsChangedDelegate OnStatsChanged;
 
+	// 룬 데이터 변경을 보드에 모두 반영한 뒤 호출 (인벤토리/UI는 카탈로그 대신 이 이벤트로 갱신)
+	FOnBoardRevalidatedDelegate& OnBoardRevalidated() { return BoardRevalidatedDelegate; }
+
 	// 클래스/그리드 관리
+	// 클래스마다 보드 상태를 상주시켜 두고 전환 시 활성 보드만 교체 (처음 방문할 때만 초기화/계산)
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Class")
 	bool SetCurrClass(ECharacterClass NewClass);
 
+	// 이미 방문해 상주 보드가 있는 클래스인지 (없으면 세이브에서 불러와야 함)
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Class")
+	bool IsClassBoardResident(ECharacterClass Class) const;
+
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Class")
 	ECharacterClass GetCurrClass() { return CurrClass; }
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Grid")
 	UGS_GridLayoutDataAsset* GetCurrGridLayout() const { return CurrGridLayout; }
 
+	// 레이아웃 테이블의 모든 레이아웃 에셋 경로 (생성 전에 비동기로 미리 읽을 때 CDO에서 호출)
+	void GetGridLayoutAssetPaths(TArray<FSoftObjectPath>& OutPaths) const;
+
 	// 룬 배치 시스템
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Placement")
-	EPlacementResult CheckRunePlacement(uint8 RuneID, const FIntPoint& Pos, TArray<uint8>& OutAffectedRuneIDs);
+	EPlacementResult CheckRunePlacement(int32 RuneID, const FIntPoint& Pos, TArray<int32>& OutAffectedRuneIDs, uint8 Orientation = 0);
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Placement")
-	bool PlaceRune(uint8 RuneID, const FIntPoint& Pos, TArray<uint8>& OutRemovedRunes);
+	bool PlaceRune(int32 RuneID, const FIntPoint& Pos, TArray<int32>& OutRemovedRunes, uint8 Orientation = 0);
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Placement")
-	bool RemoveRune(uint8 RuneID);
+	bool RemoveRune(int32 RuneID);
+
+	// 모든 앵커의 CheckRunePlacement 결과를 한 번에 계산 (룬을 들 때 한 번, 커서 이동 중에는 조회만)
+	bool BuildPlacementAnchorMap(int32 RuneID, uint8 Orientation, ArcaneCore::FPlacementAnchorMap& OutAnchors) const;
+
+	/**
+	 * 배치했을 때의 결과 미리보기, 현재 보드는 바꾸지 않음
+	 * - 보드 복사본을 재사용하므로 미리보기 셀이 바뀔 때마다 호출해도 할당 없음
+	 * - 이미 놓인 룬이면 옮겼을 때의 결과
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Placement")
+	bool PreviewRunePlacement(int32 RuneID, const FIntPoint& Pos, FArcaneBoardPreview& OutPreview, uint8 Orientation = 0) const;
 
 	// 스탯 계산
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Stats")
@@ -81,22 +119,65 @@ public:
 
 	// 데이터 접근
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Data")
-	bool GetRuneData(uint8 RuneID, FRuneTableRow& OutData);
+	bool GetRuneData(int32 RuneID, FRuneTableRow& OutData);
+
+	// 복사 없이 테이블 행 참조 (없으면 nullptr)
+	const FRuneTableRow* FindRuneRow(int32 RuneID) const { return RuneData->FindRow(ToInternalRuneID(RuneID)); }
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Data")
 	bool GetCellData(const FIntPoint& Pos, FGridCellData& OutCellData);
 
+	// 특수 셀(연결 소스) 수와 소스별 연결된 룬 수, 소스 번호는 레이아웃 셀 정의 순서
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Data")
+	int32 GetSourceCellCount() const;
+
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Data")
+	int32 GetSourceConnectedRuneCount(int32 SourceIndex) const;
+
+	// 셀에 배치된 룬 조각 텍스처 (연결 상태 반영), 조각 회전용 방향도 함께 반환
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Data")
+	UTexture2D* GetCellRuneTexture(const FIntPoint& Pos, uint8& OutOrientation);
+
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Data")
-	bool GetRuneShape(uint8 RuneID, TArray<FIntPoint>& OutShape);
+	bool GetPlacedRuneInfo(int32 RuneID, FPlacedRuneInfo& OutRuneInfo) const;
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Data")
-	UTexture2D* GetRuneTexture(uint8 RuneID);
+	bool GetRuneShape(int32 RuneID, TArray<FIntPoint>& OutShape, uint8 Orientation = 0);
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Data")
-	bool GetFragmentedRuneTexture(uint8 RuneID, TMap<FIntPoint, UTexture2D*>& OutShape);
+	UTexture2D* GetRuneTexture(int32 RuneID);
+
+	// 로드하지 않고 아이콘 경로만 반환 (UI 비동기 로드용)
+	TSoftObjectPtr<UTexture2D> GetRuneTextureAsset(int32 RuneID) const;
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Data")
-	bool GetConnectedFragmentedRuneTexture(uint8 RuneID, TMap<FIntPoint, UTexture2D*>& OutShape);
+	bool GetFragmentedRuneTexture(int32 RuneID, TMap<FIntPoint, UTexture2D*>& OutShape, uint8 Orientation = 0);
+
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Data")
+	bool GetConnectedFragmentedRuneTexture(int32 RuneID, TMap<FIntPoint, UTexture2D*>& OutShape, uint8 Orientation = 0);
+
+	// 방향별 사전 계산 모양 (공용 룬 데이터를 만들 때 코어 카탈로그에 생성)
+	const ArcaneCore::FRuneVariant* GetRuneVariant(int32 RuneID, uint8 Orientation) const;
+
+	// 외부 룬 ID <-> 코어 내부 인덱스 (없는 ID는 0)
+	ArcaneCore::RuneId ToInternalRuneID(int32 RuneID) const { return GetRuneIdRemap().ToInternal(RuneID); }
+	int32 ToExternalRuneID(ArcaneCore::RuneId InternalID) const { return GetRuneIdRemap().ToExternal(InternalID); }
+	const ArcaneCore::FRuneIdRemap& GetRuneIdRemap() const { return RuneData->GetRemap(); }
+
+	/**
+	 * 밸런스 검증용 배치 평가
+	 * - 레이아웃 인덱스는 ECharacterClass 값, 현재 보드 상태는 건드리지 않음
+	 * - 워커 스레드에서 청크 단위로 병렬 평가, 보드별 UObject 생성 없음
+	 */
+	void EvaluateBoardBatch(const ArcaneCore::FBoardBatch& Batch, TArray<FArcaneBoardBatchResult>& OutResults);
+
+	// 클래스별 코어 레이아웃, 처음 요청할 때 생성 후 유지 (없으면 nullptr)
+	const ArcaneCore::FBoardLayout* GetClassLayout(ECharacterClass Class);
+
+	const ArcaneCore::FRuneCatalog& GetRuneCatalog() const { return RuneData->GetCatalog(); }
+	const ArcaneCore::FSynergyRuleSet& GetSynergyRules() const { return RuneData->GetSynergyRules(); }
+	const TSharedPtr<const FGS_RuneDataCatalog>& GetRuneDataCatalog() const { return RuneData; }
+	const ArcaneCore::FBoardState& GetBoardState() const { return *Board; }
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Data")
 	void InitDataCache();
@@ -104,6 +185,25 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Grid")
 	void InitGridState();
 
+	/**
+	 * 편집 기록 (재현/성능 회귀용), 기본 꺼짐
+	 * - SetCurrClass/PlaceRune/RemoveRune/ResetAllRune/LoadSavedData 호출을 입력 그대로 링 버퍼에 기록
+	 * - ArcaneBoard.RecordEdits > 0이면 매니저 생성 시 자동 시작
+	 * - 저장한 파일은 -run=GS_ArcaneBoardReplay로 헤드리스 재생
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Debug")
+	void StartEditRecording(int32 Capacity = 4096);
+
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Debug")
+	void StopEditRecording();
+
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Debug")
+	bool IsRecordingEdits() const { return EditLog.IsEnabled(); }
+
+	// 남아 있는 가장 오래된 스냅샷부터 파일로 저장
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Debug")
+	bool DumpEditRecording(const FString& FilePath) const;
+
 private:
 	UPROPERTY()
 	UDataTable* RuneTable;
@@ -111,28 +211,71 @@ private:
 	UPROPERTY()
 	UDataTable* GridLayoutTable;
 
-	TMap<uint8, FRuneTableRow> RuneDataCache;
+	UPROPERTY()
+	UDataTable* SynergyTable;
+
 	TMap<ECharacterClass, UGS_GridLayoutDataAsset*> GridLayoutCache;
 
 	UPROPERTY()
 	UGS_GridLayoutDataAsset* CurrGridLayout;
 
-	TMap<FIntPoint, FGridCellData> CurrGridState;
-	FIntPoint SpecialCellPos;
+	// 클래스별 상주 보드 (보드 상태 + 전환 시 보존할 스탯/변경 여부)
+	struct FClassBoard
+	{
+		ArcaneCore::FBoardState State;
+		FArcaneBoardStats CurrStats;
+		FArcaneBoardStats AppliedStats;
+		bool bHasUnsavedChanges = false;
+	};
+
+	// 공용 룬 데이터 (카탈로그/규칙은 보드 상태가 참조하므로 보드보다 오래 유지)
+	TSharedPtr<const FGS_RuneDataCatalog> RuneData;
+	TMap<ECharacterClass, TUniquePtr<ArcaneCore::FBoardLayout>> ClassLayoutCache;
+	TMap<ECharacterClass, TUniquePtr<FClassBoard>> ClassBoards;
+
+	// 활성 클래스 보드/레이아웃, 클래스가 없으면 빈 보드를 가리킴
+	FClassBoard* ActiveClassBoard;
+	ArcaneCore::FBoardState* Board;
+	const ArcaneCore::FBoardLayout* CurrLayout;
+	ArcaneCore::FBoardState EmptyBoard;
+	ArcaneCore::FBoardLayout EmptyLayout;
+	std::vector<ArcaneCore::RuneId> ScratchRuneIDs;
+
+	FOnBoardRevalidatedDelegate BoardRevalidatedDelegate;
+
+	// 미리보기용 보드 복사본
+	mutable ArcaneCore::FBoardState PreviewBoard;
+	mutable ArcaneCore::FPlacementPreview PreviewResult;
+
+	// 테이블 변경 반영: 영향받은 상주 보드를 새 데이터로 다시 배치, 더 이상 놓일 수 없는 룬은 뺌
+	void HandleRuneDataChanged(const FGS_RuneDataChange& Change);
+	int32 RevalidateClassBoard(ECharacterClass Class, FClassBoard& ClassBoard, const ArcaneCore::FRuneIdRemap& OldRemap);
 
 	bool LoadGridLayoutForClass(ECharacterClass TargetClass);
-	void ApplyRuneStatEffect(const FStatEffect& StatEffect, FGS_StatRow& BaseStats,
-		FGS_StatRow& BonusStats, bool bIsConnected, float BonusValue);
+	void StashActiveClassBoard();
+	void ActivateClassBoard(ECharacterClass Class);
 
-	// DFS로 연결된 셀 탐색
+	// 특수 셀들에서 연결된 셀 탐색
 	void UpdateConnections();
-	void FindConnectedCells(const FIntPoint CellPos, TSet<FIntPoint>& VisitedCells);
-	bool IsRuneConnected(uint8 RuneID) const;
+	bool IsRuneConnected(int32 RuneID) const;
 
-	void ApplyRuneToGrid(uint8 RuneID, const FIntPoint& Position, EGridCellState NewState, bool bApplyTexture = true);
-	void UpdateCellState(const FIntPoint& Pos, EGridCellState NewState, uint8 RuneID = 0,
-		UTexture2D* RuneTextureFrag = nullptr, UTexture2D* ConnectedRuneTextureFrag = nullptr);
+	// 코어 배치 목록 -> PlacedRunes
+	void SyncPlacedRunes();
 
-	void CacheRuneData();
 	void CacheGridLayouts();
+
+	// 편집 기록, 기록 시각은 시작 시점 기준
+	ArcaneCore::FBoardEditLog EditLog;
+	double EditLogStartTime;
+
+	// 필요하면 스냅샷을 먼저 남기고 기록, Runes는 Load 블록에 딸린 배치
+	void RecordEdit(ArcaneCore::EBoardEditOp Op, uint8 Arg = 0, int32 RuneID = 0, const FIntPoint& Pos = FIntPoint::ZeroValue,
+		const TArray<FPlacedRuneInfo>* Runes = nullptr);
+	void AppendEditRecords(ArcaneCore::EBoardEditOp Op, uint8 Arg, int32 RuneID, const FIntPoint& Pos, const TArray<FPlacedRuneInfo>* Runes);
+	// 상주 보드 전부, 활성 클래스를 마지막에 기록
+	void RecordSnapshot();
+
+	// stat ArcaneBoard 상주 보드 상태 메모리 (공용 룬 데이터는 카탈로그가 따로 집계)
+	int64 ReportedBoardStateMemory;
+	void UpdateBoardStateMemoryStats();
 };
\ No newline at end of file
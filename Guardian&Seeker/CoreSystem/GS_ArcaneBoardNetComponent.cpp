@@ -0,0 +1,363 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RuneSystem/GS_ArcaneBoardNetComponent.h"
+#include "RuneSystem/GS_ArcaneBoardValidationSubsystem.h"
+#include "RuneSystem/GS_ArcaneBoardManager.h"
+#include "RuneSystem/GS_ArcaneBoardCoreAdapter.h"
+#include "RuneSystem/GS_RuneStatReceiver.h"
+#include "RuneSystem/GS_ArcaneBoardSaveGame.h"
+#include "RuneSystem/GS_ArcaneBoardLPS.h"
+#include "Engine/LocalPlayer.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/Paths.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Net/UnrealNetwork.h"
+
+#if !UE_BUILD_SHIPPING
+// 켜면 서버 소유 검증이 무의미해지므로 개발 빌드 테스트 전용
+static TAutoConsoleVariable<bool> CVarArcaneBoardTrustClientInventory(
+	TEXT("ArcaneBoard.TrustClientInventory"),
+	false,
+	TEXT("원격 클라이언트가 보고한 룬 인벤토리를 서버 소유 룬으로 사용 (서버 세이브 없이 테스트할 때, 쉬핑 빌드에서는 제외)"),
+	ECVF_Cheat);
+#endif
+
+UGS_ArcaneBoardNetComponent::UGS_ArcaneBoardNetComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	SetIsReplicatedByDefault(true);
+	LastValidationResult = EArcaneBoardValidationResult::Accepted;
+	AppliedClass = ECharacterClass::Ares;
+}
+
+void UGS_ArcaneBoardNetComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UGS_ArcaneBoardNetComponent, AppliedBoard);
+	DOREPLIFETIME(UGS_ArcaneBoardNetComponent, AppliedClass);
+	DOREPLIFETIME(UGS_ArcaneBoardNetComponent, QuantizedStats);
+}
+
+void UGS_ArcaneBoardNetComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		if (APlayerState* OwnerPlayerState = GetOwner<APlayerState>())
+		{
+			OwnerPlayerState->OnPawnSet.AddDynamic(this, &UGS_ArcaneBoardNetComponent::OnOwnerPawnSet);
+		}
+	}
+}
+
+void UGS_ArcaneBoardNetComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		if (UGS_ArcaneBoardValidationSubsystem* ValidationSubsystem = UWorld::GetSubsystem<UGS_ArcaneBoardValidationSubsystem>(GetWorld()))
+		{
+			ValidationSubsystem->RemovePlayer(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UGS_ArcaneBoardNetComponent::SubmitBoard(ECharacterClass Class, const TArray<FPlacedRuneInfo>& Runes)
+{
+	TArray<FGS_CompactRunePlacement> Placements;
+	Placements.Reserve(Runes.Num());
+	for (const FPlacedRuneInfo& RuneInfo : Runes)
+	{
+		// 레이아웃 고정 셀(ID 0)은 서버도 알고 있으므로 생략
+		if (RuneInfo.RuneID != 0)
+		{
+			Placements.Emplace(RuneInfo);
+		}
+	}
+
+	ServerSubmitBoard(Class, Placements);
+}
+
+void UGS_ArcaneBoardNetComponent::ReportOwnedRunes(const TArray<int32>& RuneIDs)
+{
+	ServerReportOwnedRunes(RuneIDs);
+}
+
+void UGS_ArcaneBoardNetComponent::GrantRune(int32 RuneID)
+{
+	if (GetOwnerRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	// 로드 전에 지급하면 이후 로드가 덮어쓰므로 먼저 로드
+	LoadOwnedRunes();
+	if (!AddOwnedRune(RuneID))
+	{
+		return;
+	}
+
+	SaveOwnedRunes();
+	ClientRuneGranted(RuneID);
+}
+
+const ArcaneCore::FRuneIdSet& UGS_ArcaneBoardNetComponent::GetOwnedRunes()
+{
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		LoadOwnedRunes();
+	}
+	return OwnedRunes;
+}
+
+bool UGS_ArcaneBoardNetComponent::AddOwnedRune(int32 RuneID)
+{
+	// 외부 ID -> 서버 테이블 기준 내부 인덱스, 테이블에 없는 룬은 무시
+	UGS_ArcaneBoardValidationSubsystem* ValidationSubsystem = UWorld::GetSubsystem<UGS_ArcaneBoardValidationSubsystem>(GetWorld());
+	UGS_ArcaneBoardManager* Manager = ValidationSubsystem ? ValidationSubsystem->GetOrCreateDataManager() : nullptr;
+	const ArcaneCore::RuneId InternalID = Manager ? Manager->ToInternalRuneID(RuneID) : 0;
+	if (InternalID == 0)
+	{
+		return false;
+	}
+
+	OwnedRunes.Add(InternalID);
+	return true;
+}
+
+bool UGS_ArcaneBoardNetComponent::IsHostPlayer() const
+{
+	const APlayerState* OwnerPlayerState = GetOwner<APlayerState>();
+	const APlayerController* OwnerController = OwnerPlayerState ? OwnerPlayerState->GetPlayerController() : nullptr;
+	return OwnerController && OwnerController->IsLocalController();
+}
+
+bool UGS_ArcaneBoardNetComponent::GetServerSaveSlotName(FString& OutSlotName) const
+{
+	const APlayerState* OwnerPlayerState = GetOwner<APlayerState>();
+	if (!OwnerPlayerState || !OwnerPlayerState->GetUniqueId().IsValid())
+	{
+		return false;
+	}
+
+	OutSlotName = FString(TEXT("ArcaneBoardServer_")) + FPaths::MakeValidFileName(OwnerPlayerState->GetUniqueId().ToString(), TEXT('_'));
+	return true;
+}
+
+void UGS_ArcaneBoardNetComponent::LoadOwnedRunes()
+{
+	if (bOwnedRunesLoaded)
+	{
+		return;
+	}
+	bOwnedRunesLoaded = true;
+	OwnedRunes.Clear();
+
+	FString SlotName;
+	const UGS_ArcaneBoardSaveGame* SaveGame = nullptr;
+	if (GetServerSaveSlotName(SlotName) && UGameplayStatics::DoesSaveGameExist(SlotName, 0))
+	{
+		SaveGame = Cast<UGS_ArcaneBoardSaveGame>(UGameplayStatics::LoadGameFromSlot(SlotName, 0));
+	}
+
+	if (SaveGame)
+	{
+		for (int32 RuneID : SaveGame->OwnedRuneExternalIDs)
+		{
+			AddOwnedRune(RuneID);
+		}
+	}
+	else
+	{
+		// 처음 접속한 플레이어는 클라이언트 InitializeTestRunes와 같은 기본 룬
+		for (int32 RuneID = 1; RuneID <= UGS_ArcaneBoardManager::NumStarterRunes; ++RuneID)
+		{
+			AddOwnedRune(RuneID);
+		}
+	}
+}
+
+void UGS_ArcaneBoardNetComponent::SaveOwnedRunes() const
+{
+	// 호스트는 로컬 세이브(LPS)가 소유 룬을 저장
+	FString SlotName;
+	if (IsHostPlayer() || !GetServerSaveSlotName(SlotName))
+	{
+		return;
+	}
+
+	UGS_ArcaneBoardValidationSubsystem* ValidationSubsystem = UWorld::GetSubsystem<UGS_ArcaneBoardValidationSubsystem>(GetWorld());
+	const UGS_ArcaneBoardManager* Manager = ValidationSubsystem ? ValidationSubsystem->GetOrCreateDataManager() : nullptr;
+	UGS_ArcaneBoardSaveGame* SaveGame = Cast<UGS_ArcaneBoardSaveGame>(UGameplayStatics::CreateSaveGameObject(UGS_ArcaneBoardSaveGame::StaticClass()));
+	if (!Manager || !SaveGame)
+	{
+		return;
+	}
+
+	// 서버 슬롯은 소유 룬만 사용
+	OwnedRunes.ForEach([Manager, SaveGame](ArcaneCore::RuneId InternalID)
+	{
+		SaveGame->OwnedRuneExternalIDs.Add(Manager->ToExternalRuneID(InternalID));
+	});
+	UGameplayStatics::AsyncSaveGameToSlot(SaveGame, SlotName, 0);
+}
+
+void UGS_ArcaneBoardNetComponent::OnValidationFinished(EArcaneBoardValidationResult Result, const FArcaneBoardStats& Stats)
+{
+	// 서버도 양자화된 값을 사용해 클라이언트와 같은 스탯을 보도록
+	QuantizedStats.FromBoardStats(Stats);
+	LastValidationResult = Result;
+	ValidatedStats = QuantizedStats.ToBoardStats();
+
+	// 리슨 서버 호스트는 클라이언트 RPC가 로컬에서 실행되므로 거기서 한 번만 알림
+	const APlayerState* OwnerPlayerState = GetOwner<APlayerState>();
+	const APlayerController* OwnerController = OwnerPlayerState ? OwnerPlayerState->GetPlayerController() : nullptr;
+	if (!OwnerController || !OwnerController->IsLocalController())
+	{
+		OnBoardValidated.Broadcast(Result, ValidatedStats);
+	}
+	ClientBoardValidated(Result);
+
+	PushStatsToPawn();
+}
+
+void UGS_ArcaneBoardNetComponent::OnOwnerPawnSet(APlayerState* Player, APawn* NewPawn, APawn* OldPawn)
+{
+	// 리스폰 시 캐시된 검증 스탯만 전달하므로 여러 플레이어가 동시에 부활해도 보드 평가 없음
+	PushStatsToPawn();
+}
+
+void UGS_ArcaneBoardNetComponent::PushStatsToPawn()
+{
+	const APlayerState* OwnerPlayerState = GetOwner<APlayerState>();
+	APawn* Pawn = OwnerPlayerState ? OwnerPlayerState->GetPawn() : nullptr;
+
+	IGS_RuneStatReceiver* Receiver = Cast<IGS_RuneStatReceiver>(Pawn);
+	if (!Receiver && Pawn)
+	{
+		Receiver = Cast<IGS_RuneStatReceiver>(Pawn->FindComponentByInterface(UGS_RuneStatReceiver::StaticClass()));
+	}
+	if (!Receiver)
+	{
+		StatPawn = nullptr;
+		return;
+	}
+
+	// 새 폰은 보드 스탯이 하나도 반영되지 않은 상태
+	if (StatPawn.Get() != Pawn)
+	{
+		StatPawn = Pawn;
+		PushedStats = ArcaneCore::FStatBlock();
+	}
+
+	const ArcaneCore::FStatBlock TargetStats = ArcaneBoardAdapter::ToTotalStatBlock(ValidatedStats);
+	ArcaneCore::FStatBlock Delta = TargetStats;
+	Delta.AddScaled(PushedStats, -1.0f);
+
+	bool bChanged = false;
+	for (int32 Stat = 0; Stat < ArcaneCore::StatIndex::Count; ++Stat)
+	{
+		bChanged |= !FMath::IsNearlyZero(Delta[Stat]);
+	}
+	if (!bChanged)
+	{
+		return;
+	}
+
+	Receiver->ApplyRuneStatDelta(ArcaneBoardAdapter::ToStatRow(Delta));
+	PushedStats = TargetStats;
+}
+
+void UGS_ArcaneBoardNetComponent::SetAppliedBoard(ECharacterClass Class, const std::vector<ArcaneCore::FPlacement>& Placements, const ArcaneCore::FRuneIdRemap& Remap)
+{
+	if (AppliedClass != Class)
+	{
+		AppliedClass = Class;
+		AppliedBoard.Items.Reset();
+		AppliedBoard.MarkArrayDirty();
+	}
+	AppliedBoard.SetPlacements(Placements, Remap);
+}
+
+void UGS_ArcaneBoardNetComponent::GetAppliedRunes(TArray<FPlacedRuneInfo>& OutRunes) const
+{
+	AppliedBoard.GetPlacedRunes(OutRunes);
+}
+
+bool UGS_ArcaneBoardNetComponent::ServerSubmitBoard_Validate(ECharacterClass Class, const TArray<FGS_CompactRunePlacement>& Placements)
+{
+	// 정상 클라이언트가 보낼 수 없는 크기만 연결 끊기, 그 외 제한은 검증 결과로 응답
+	return Placements.Num() <= ArcaneCore::MaxRuneCount;
+}
+
+void UGS_ArcaneBoardNetComponent::ServerSubmitBoard_Implementation(ECharacterClass Class, const TArray<FGS_CompactRunePlacement>& Placements)
+{
+	if (UGS_ArcaneBoardValidationSubsystem* ValidationSubsystem = UWorld::GetSubsystem<UGS_ArcaneBoardValidationSubsystem>(GetWorld()))
+	{
+		ValidationSubsystem->EnqueueSubmission(this, Class, Placements);
+	}
+}
+
+bool UGS_ArcaneBoardNetComponent::ServerReportOwnedRunes_Validate(const TArray<int32>& RuneIDs)
+{
+	return RuneIDs.Num() <= ArcaneCore::MaxRuneCount;
+}
+
+void UGS_ArcaneBoardNetComponent::ServerReportOwnedRunes_Implementation(const TArray<int32>& RuneIDs)
+{
+	// 리슨 서버 호스트/단독 실행은 로컬 인벤토리가 곧 서버 인벤토리
+	bool bTrustReport = IsHostPlayer();
+#if !UE_BUILD_SHIPPING
+	bTrustReport |= CVarArcaneBoardTrustClientInventory.GetValueOnGameThread();
+#endif
+	if (!bTrustReport)
+	{
+		return;
+	}
+
+	bOwnedRunesLoaded = true;
+	OwnedRunes.Clear();
+	for (int32 RuneID : RuneIDs)
+	{
+		AddOwnedRune(RuneID);
+	}
+}
+
+void UGS_ArcaneBoardNetComponent::ClientBoardValidated_Implementation(EArcaneBoardValidationResult Result)
+{
+	// 스탯은 복제로 따로 도착, 먼저 도착한 값으로 알리고 이후 변경은 OnAppliedBoardReplicated로 전달
+	if (GetOwnerRole() < ROLE_Authority)
+	{
+		ValidatedStats = QuantizedStats.ToBoardStats();
+	}
+	LastValidationResult = Result;
+	OnBoardValidated.Broadcast(Result, ValidatedStats);
+}
+
+void UGS_ArcaneBoardNetComponent::ClientRuneGranted_Implementation(int32 RuneID)
+{
+	const APlayerState* OwnerPlayerState = GetOwner<APlayerState>();
+	const APlayerController* OwnerController = OwnerPlayerState ? OwnerPlayerState->GetPlayerController() : nullptr;
+	const ULocalPlayer* LocalPlayer = OwnerController ? OwnerController->GetLocalPlayer() : nullptr;
+	if (UGS_ArcaneBoardLPS* BoardLPS = LocalPlayer ? LocalPlayer->GetSubsystem<UGS_ArcaneBoardLPS>() : nullptr)
+	{
+		BoardLPS->AddRuneToInventory(RuneID);
+	}
+}
+
+void UGS_ArcaneBoardNetComponent::OnRep_AppliedBoard()
+{
+	OnAppliedBoardReplicated.Broadcast();
+}
+
+void UGS_ArcaneBoardNetComponent::OnRep_QuantizedStats()
+{
+	ValidatedStats = QuantizedStats.ToBoardStats();
+	OnAppliedBoardReplicated.Broadcast();
+}
@@ -0,0 +1,134 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GS_ArcaneBoardTypes.h"
+#include "GS_ArcaneBoardNetTypes.h"
+#include "ArcaneBoardValidator.h"
+#include "GS_ArcaneBoardNetComponent.generated.h"
+
+class APawn;
+class APlayerState;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBoardValidatedDelegate, EArcaneBoardValidationResult, Result, const FArcaneBoardStats&, ValidatedStats);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAppliedBoardReplicatedDelegate);
+
+/**
+ * 아케인 보드 서버 검증용 컴포넌트 (PlayerState에 부착)
+ * - 클라이언트는 적용한 보드를 압축 배치 목록으로 서버에 제출
+ * - 서버는 UGS_ArcaneBoardValidationSubsystem 대기열에 넣고, 검증된 스탯만 신뢰
+ * - 소유 룬은 서버 쪽 내부 인덱스 비트 집합으로 관리 (RPC/복제는 외부 룬 ID)
+ *   처음 검증할 때 플레이어별 서버 세이브에서 로드 (없으면 기본 룬), GrantRune으로 추가하면 저장 후 클라이언트에 알림
+ *   리슨 서버 호스트/단독 실행은 로컬 인벤토리가 곧 서버 인벤토리이므로 보고를 그대로 사용
+ * - 검증된 보드는 델타 배열, 스탯은 양자화 값으로 모든 클라이언트에 복제 (관전/살펴보기용)
+ * - 서버는 검증된 스탯과 현재 폰에 반영한 스탯의 차이만 IGS_RuneStatReceiver에 한 번에 전달
+ *   (리스폰으로 폰이 바뀌면 전체 스탯을 변화량으로 전달, 보드 재계산 없음)
+ */
+UCLASS(ClassGroup = (ArcaneBoard), meta = (BlueprintSpawnableComponent))
+class GAS_API UGS_ArcaneBoardNetComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UGS_ArcaneBoardNetComponent();
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// 한 번에 제출할 수 있는 최대 룬 수
+	static constexpr int32 MaxSubmittedRunes = 64;
+
+	// 서버에서 검증된 최신 스탯 (클라이언트에는 양자화 값으로 복제)
+	UPROPERTY(BlueprintReadOnly, Category = "ArcaneBoard|Net")
+	FArcaneBoardStats ValidatedStats;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ArcaneBoard|Net")
+	EArcaneBoardValidationResult LastValidationResult;
+
+	UPROPERTY(BlueprintAssignable, Category = "ArcaneBoard|Net")
+	FOnBoardValidatedDelegate OnBoardValidated;
+
+	// 복제된 보드/스탯이 바뀌면 호출 (소유자 외 클라이언트 포함)
+	UPROPERTY(BlueprintAssignable, Category = "ArcaneBoard|Net")
+	FOnAppliedBoardReplicatedDelegate OnAppliedBoardReplicated;
+
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Net")
+	ECharacterClass GetAppliedClass() const { return AppliedClass; }
+
+	// 복제된 배치 복원, 레이아웃 고정 셀은 포함하지 않음
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Net")
+	void GetAppliedRunes(TArray<FPlacedRuneInfo>& OutRunes) const;
+
+	// 클라이언트: 적용한 보드 제출
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Net")
+	void SubmitBoard(ECharacterClass Class, const TArray<FPlacedRuneInfo>& Runes);
+
+	// 클라이언트: 로컬 인벤토리 보고
+	// 서버는 호스트 자신의 보고이거나 ArcaneBoard.TrustClientInventory가 켜진 개발 빌드에서만 반영
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Net")
+	void ReportOwnedRunes(const TArray<int32>& RuneIDs);
+
+	// 서버: 룬 지급, 서버 세이브에 저장하고 소유 클라이언트 인벤토리에도 추가
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "ArcaneBoard|Net")
+	void GrantRune(int32 RuneID);
+
+	// 서버: 소유 룬, 처음 호출 시 서버 세이브에서 로드
+	const ArcaneCore::FRuneIdSet& GetOwnedRunes();
+
+	// 서버: 검증 서브시스템이 결과 전달
+	void OnValidationFinished(EArcaneBoardValidationResult Result, const FArcaneBoardStats& Stats);
+
+	// 서버: 검증된 배치 반영, 바뀐 룬만 복제
+	void SetAppliedBoard(ECharacterClass Class, const std::vector<ArcaneCore::FPlacement>& Placements, const ArcaneCore::FRuneIdRemap& Remap);
+
+protected:
+	UFUNCTION(Server, Reliable, WithValidation)
+	void ServerSubmitBoard(ECharacterClass Class, const TArray<FGS_CompactRunePlacement>& Placements);
+
+	UFUNCTION(Server, Reliable, WithValidation)
+	void ServerReportOwnedRunes(const TArray<int32>& RuneIDs);
+
+	UFUNCTION(Client, Reliable)
+	void ClientBoardValidated(EArcaneBoardValidationResult Result);
+
+	UFUNCTION(Client, Reliable)
+	void ClientRuneGranted(int32 RuneID);
+
+	UFUNCTION()
+	void OnRep_AppliedBoard();
+
+	UFUNCTION()
+	void OnRep_QuantizedStats();
+
+	UFUNCTION()
+	void OnOwnerPawnSet(APlayerState* Player, APawn* NewPawn, APawn* OldPawn);
+
+private:
+	UPROPERTY(ReplicatedUsing = OnRep_AppliedBoard)
+	FGS_ReplicatedArcaneBoard AppliedBoard;
+
+	UPROPERTY(ReplicatedUsing = OnRep_AppliedBoard)
+	ECharacterClass AppliedClass;
+
+	UPROPERTY(ReplicatedUsing = OnRep_QuantizedStats)
+	FGS_QuantizedBoardStats QuantizedStats;
+
+	ArcaneCore::FRuneIdSet OwnedRunes;
+	bool bOwnedRunesLoaded = false;
+
+	// 서버: 스탯을 반영한 폰과 그 폰에 반영된 합계
+	TWeakObjectPtr<APawn> StatPawn;
+	ArcaneCore::FStatBlock PushedStats;
+
+	void PushStatsToPawn();
+
+	// 서버: 소유 룬 서버 세이브 (플레이어 고유 ID별 슬롯)
+	bool GetServerSaveSlotName(FString& OutSlotName) const;
+	void LoadOwnedRunes();
+	void SaveOwnedRunes() const;
+	bool IsHostPlayer() const;
+	bool AddOwnedRune(int32 RuneID);
+};
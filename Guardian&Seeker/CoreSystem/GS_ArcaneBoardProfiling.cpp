@@ -0,0 +1,39 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RuneSystem/GS_ArcaneBoardProfiling.h"
+
+UE_TRACE_CHANNEL_DEFINE(ArcaneBoardChannel);
+
+DEFINE_STAT(STAT_ArcaneBoard_CheckRunePlacement);
+DEFINE_STAT(STAT_ArcaneBoard_PlaceRune);
+DEFINE_STAT(STAT_ArcaneBoard_RemoveRune);
+DEFINE_STAT(STAT_ArcaneBoard_PreviewPlacement);
+DEFINE_STAT(STAT_ArcaneBoard_BuildAnchorMap);
+DEFINE_STAT(STAT_ArcaneBoard_UpdateConnections);
+DEFINE_STAT(STAT_ArcaneBoard_CalculateStatEffects);
+DEFINE_STAT(STAT_ArcaneBoard_SaveBoardConfig);
+DEFINE_STAT(STAT_ArcaneBoard_LoadBoardConfig);
+DEFINE_STAT(STAT_ArcaneBoard_GenerateGridLayout);
+DEFINE_STAT(STAT_ArcaneBoard_PreviewMouseMove);
+DEFINE_STAT(STAT_ArcaneBoard_EvaluateBoardBatch);
+DEFINE_STAT(STAT_ArcaneBoard_ValidateSubmittedBoard);
+
+DEFINE_STAT(STAT_ArcaneBoard_CheckRunePlacement_Calls);
+DEFINE_STAT(STAT_ArcaneBoard_PlaceRune_Calls);
+DEFINE_STAT(STAT_ArcaneBoard_RemoveRune_Calls);
+DEFINE_STAT(STAT_ArcaneBoard_PreviewPlacement_Calls);
+DEFINE_STAT(STAT_ArcaneBoard_BuildAnchorMap_Calls);
+DEFINE_STAT(STAT_ArcaneBoard_UpdateConnections_Calls);
+DEFINE_STAT(STAT_ArcaneBoard_CalculateStatEffects_Calls);
+DEFINE_STAT(STAT_ArcaneBoard_SaveBoardConfig_Calls);
+DEFINE_STAT(STAT_ArcaneBoard_LoadBoardConfig_Calls);
+DEFINE_STAT(STAT_ArcaneBoard_GenerateGridLayout_Calls);
+DEFINE_STAT(STAT_ArcaneBoard_PreviewMouseMove_Calls);
+DEFINE_STAT(STAT_ArcaneBoard_EvaluateBoardBatch_Calls);
+DEFINE_STAT(STAT_ArcaneBoard_ValidateSubmittedBoard_Calls);
+
+DEFINE_STAT(STAT_ArcaneBoard_PendingValidations);
+
+DEFINE_STAT(STAT_ArcaneBoard_RuneDataCacheMemory);
+DEFINE_STAT(STAT_ArcaneBoard_RuneTextureMemory);
+DEFINE_STAT(STAT_ArcaneBoard_BoardStateMemory);
@@ -0,0 +1,61 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/**
+ * 아케인 보드 프로파일링
+ * - 'stat ArcaneBoard' 로 사이클/호출 수/메모리 확인
+ * - Unreal Insights: -trace=cpu,ArcaneBoard 로 채널 활성화
+ */
+DECLARE_STATS_GROUP(TEXT("ArcaneBoard"), STATGROUP_ArcaneBoard, STATCAT_Advanced);
+
+UE_TRACE_CHANNEL_EXTERN(ArcaneBoardChannel, GAS_API);
+
+// 사이클 카운터
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CheckRunePlacement"), STAT_ArcaneBoard_CheckRunePlacement, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PlaceRune"), STAT_ArcaneBoard_PlaceRune, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RemoveRune"), STAT_ArcaneBoard_RemoveRune, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PreviewPlacement"), STAT_ArcaneBoard_PreviewPlacement, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("BuildAnchorMap"), STAT_ArcaneBoard_BuildAnchorMap, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateConnections"), STAT_ArcaneBoard_UpdateConnections, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CalculateStatEffects"), STAT_ArcaneBoard_CalculateStatEffects, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SaveBoardConfig"), STAT_ArcaneBoard_SaveBoardConfig, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LoadBoardConfig"), STAT_ArcaneBoard_LoadBoardConfig, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GenerateGridLayout"), STAT_ArcaneBoard_GenerateGridLayout, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PreviewMouseMove"), STAT_ArcaneBoard_PreviewMouseMove, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("EvaluateBoardBatch"), STAT_ArcaneBoard_EvaluateBoardBatch, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ValidateSubmittedBoard"), STAT_ArcaneBoard_ValidateSubmittedBoard, STATGROUP_ArcaneBoard, GAS_API);
+
+// 누적 호출 수 (세션 전체)
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("CheckRunePlacement Calls"), STAT_ArcaneBoard_CheckRunePlacement_Calls, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("PlaceRune Calls"), STAT_ArcaneBoard_PlaceRune_Calls, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("RemoveRune Calls"), STAT_ArcaneBoard_RemoveRune_Calls, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("PreviewPlacement Calls"), STAT_ArcaneBoard_PreviewPlacement_Calls, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("BuildAnchorMap Calls"), STAT_ArcaneBoard_BuildAnchorMap_Calls, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("UpdateConnections Calls"), STAT_ArcaneBoard_UpdateConnections_Calls, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("CalculateStatEffects Calls"), STAT_ArcaneBoard_CalculateStatEffects_Calls, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("SaveBoardConfig Calls"), STAT_ArcaneBoard_SaveBoardConfig_Calls, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("LoadBoardConfig Calls"), STAT_ArcaneBoard_LoadBoardConfig_Calls, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("GenerateGridLayout Calls"), STAT_ArcaneBoard_GenerateGridLayout_Calls, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("PreviewMouseMove Calls"), STAT_ArcaneBoard_PreviewMouseMove_Calls, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("EvaluateBoardBatch Calls"), STAT_ArcaneBoard_EvaluateBoardBatch_Calls, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("ValidateSubmittedBoard Calls"), STAT_ArcaneBoard_ValidateSubmittedBoard_Calls, STATGROUP_ArcaneBoard, GAS_API);
+
+// 서버 검증 대기열
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pending Validations"), STAT_ArcaneBoard_PendingValidations, STATGROUP_ArcaneBoard, GAS_API);
+
+// 메모리
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Rune Data Cache"), STAT_ArcaneBoard_RuneDataCacheMemory, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Rune Textures"), STAT_ArcaneBoard_RuneTextureMemory, STATGROUP_ArcaneBoard, GAS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Resident Board States"), STAT_ArcaneBoard_BoardStateMemory, STATGROUP_ArcaneBoard, GAS_API);
+
+// 사이클 + 누적 호출 수 + Insights 이벤트를 한 번에 기록
+#define ARCANEBOARD_SCOPE_CYCLE_COUNTER(StatName) \
+	SCOPE_CYCLE_COUNTER(STAT_ArcaneBoard_##StatName); \
+	INC_DWORD_STAT(STAT_ArcaneBoard_##StatName##_Calls); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(ArcaneBoard_##StatName, ArcaneBoardChannel)
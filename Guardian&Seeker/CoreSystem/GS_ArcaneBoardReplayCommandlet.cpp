@@ -0,0 +1,218 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RuneSystem/GS_ArcaneBoardReplayCommandlet.h"
+#include "RuneSystem/GS_ArcaneBoardManager.h"
+#include "ArcaneBoardEditLog.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogArcaneBoardReplay, Log, All);
+
+namespace
+{
+	using ArcaneCore::EBoardEditOp;
+	using ArcaneCore::FBoardEditRecord;
+
+	const TCHAR* GetEditOpName(EBoardEditOp Op)
+	{
+		switch (Op)
+		{
+		case EBoardEditOp::Snapshot: return TEXT("Snapshot");
+		case EBoardEditOp::SetClass: return TEXT("SetClass");
+		case EBoardEditOp::Place: return TEXT("Place");
+		case EBoardEditOp::Remove: return TEXT("Remove");
+		case EBoardEditOp::ResetAll: return TEXT("ResetAll");
+		case EBoardEditOp::Load: return TEXT("Load");
+		default: return TEXT("Rune");
+		}
+	}
+
+	struct FEditOpTiming
+	{
+		int32 Calls = 0;
+		double TotalSeconds = 0.0;
+		double MaxSeconds = 0.0;
+	};
+
+	// 블록 헤더 뒤의 Rune 레코드 (Deserialize에서 길이 검증됨)
+	void ReadRuneBlock(const std::vector<FBoardEditRecord>& Records, int32 HeaderIndex, TArray<FPlacedRuneInfo>& OutRunes)
+	{
+		const FBoardEditRecord& Header = Records[HeaderIndex];
+		OutRunes.Reset(Header.Count);
+		for (int32 i = 1; i <= Header.Count; ++i)
+		{
+			const FBoardEditRecord& Rune = Records[HeaderIndex + i];
+			OutRunes.Emplace(Rune.RuneId, FIntPoint(Rune.X, Rune.Y), Rune.Arg);
+		}
+	}
+
+	// 배치 순서는 편집 경로에 따라 다를 수 있으므로 룬 ID 순으로 비교
+	bool MatchesPlacedRunes(TArray<FPlacedRuneInfo> Expected, TArray<FPlacedRuneInfo> Actual)
+	{
+		if (Expected.Num() != Actual.Num())
+		{
+			return false;
+		}
+
+		auto ByRuneID = [](const FPlacedRuneInfo& A, const FPlacedRuneInfo& B) { return A.RuneID < B.RuneID; };
+		Expected.Sort(ByRuneID);
+		Actual.Sort(ByRuneID);
+		for (int32 i = 0; i < Expected.Num(); ++i)
+		{
+			if (Expected[i].RuneID != Actual[i].RuneID || Expected[i].Pos != Actual[i].Pos || Expected[i].Orientation != Actual[i].Orientation)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+UGS_ArcaneBoardReplayCommandlet::UGS_ArcaneBoardReplayCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UGS_ArcaneBoardReplayCommandlet::Main(const FString& Params)
+{
+	FString LogPath, OutputPath;
+	int32 NumRepeats = 1;
+
+	FParse::Value(*Params, TEXT("Log="), LogPath);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+	FParse::Value(*Params, TEXT("Repeat="), NumRepeats);
+	const bool bRealtime = FParse::Param(*Params, TEXT("Realtime"));
+	NumRepeats = FMath::Max(NumRepeats, 1);
+
+	TArray<uint8> Bytes;
+	std::vector<FBoardEditRecord> Records;
+	if (!FFileHelper::LoadFileToArray(Bytes, *LogPath) ||
+		!ArcaneCore::FBoardEditLog::Deserialize(Bytes.GetData(), Bytes.Num(), Records))
+	{
+		UE_LOG(LogArcaneBoardReplay, Error, TEXT("편집 기록을 읽을 수 없음: %s"), *LogPath);
+		return 1;
+	}
+
+	if (Records.empty() || Records[0].Op != EBoardEditOp::Snapshot)
+	{
+		UE_LOG(LogArcaneBoardReplay, Error, TEXT("재생 시작 스냅샷이 없음: %s"), *LogPath);
+		return 1;
+	}
+
+	FEditOpTiming Timings[static_cast<int32>(EBoardEditOp::Count)];
+	FString Chunk = OutputPath.IsEmpty() ? FString() : TEXT("Repeat,Index,Op,TimeMs,DurationUs\n");
+	TArray<FPlacedRuneInfo> Runes;
+	TArray<int32> RemovedRunes;
+	int32 NumMismatches = 0;
+
+	for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+	{
+		// 반복마다 새 매니저, 시작 스냅샷 묶음으로 기록 당시 상주 보드를 복원 (시간 측정 제외)
+		UGS_ArcaneBoardManager* BoardManager = NewObject<UGS_ArcaneBoardManager>();
+		bool bInitialSnapshot = true;
+		const double ReplayStartTime = FPlatformTime::Seconds();
+		const uint32 FirstTimeMs = Records[0].TimeMs;
+
+		for (int32 Index = 0; Index < static_cast<int32>(Records.size()); ++Index)
+		{
+			const FBoardEditRecord& Record = Records[Index];
+			const ECharacterClass RecordClass = static_cast<ECharacterClass>(Record.Arg);
+
+			if (Record.Op == EBoardEditOp::Snapshot)
+			{
+				ReadRuneBlock(Records, Index, Runes);
+				if (bInitialSnapshot)
+				{
+					BoardManager->SetCurrClass(RecordClass);
+					BoardManager->LoadSavedData(RecordClass, Runes);
+				}
+				else if (RecordClass == BoardManager->GetCurrClass() && !MatchesPlacedRunes(Runes, BoardManager->PlacedRunes))
+				{
+					++NumMismatches;
+					UE_LOG(LogArcaneBoardReplay, Warning, TEXT("%d번 스냅샷과 재생 결과가 다름 (기록 %d개, 재생 %d개)"),
+						Index, Runes.Num(), BoardManager->PlacedRunes.Num());
+				}
+				Index += Record.Count;
+				continue;
+			}
+			bInitialSnapshot = false;
+
+			if (bRealtime)
+			{
+				const double WaitSeconds = (Record.TimeMs - FirstTimeMs) / 1000.0 - (FPlatformTime::Seconds() - ReplayStartTime);
+				if (WaitSeconds > 0.0)
+				{
+					FPlatformProcess::Sleep(static_cast<float>(WaitSeconds));
+				}
+			}
+
+			if (Record.Op == EBoardEditOp::Load)
+			{
+				ReadRuneBlock(Records, Index, Runes);
+			}
+
+			const double OpStartTime = FPlatformTime::Seconds();
+			switch (Record.Op)
+			{
+			case EBoardEditOp::SetClass:
+				BoardManager->SetCurrClass(RecordClass);
+				break;
+			case EBoardEditOp::Place:
+				BoardManager->PlaceRune(Record.RuneId, FIntPoint(Record.X, Record.Y), RemovedRunes, Record.Arg);
+				break;
+			case EBoardEditOp::Remove:
+				BoardManager->RemoveRune(Record.RuneId);
+				break;
+			case EBoardEditOp::ResetAll:
+				BoardManager->ResetAllRune();
+				break;
+			case EBoardEditOp::Load:
+				BoardManager->LoadSavedData(RecordClass, Runes);
+				break;
+			default:
+				break;
+			}
+			const double OpSeconds = FPlatformTime::Seconds() - OpStartTime;
+
+			FEditOpTiming& Timing = Timings[static_cast<int32>(Record.Op)];
+			++Timing.Calls;
+			Timing.TotalSeconds += OpSeconds;
+			Timing.MaxSeconds = FMath::Max(Timing.MaxSeconds, OpSeconds);
+
+			if (!OutputPath.IsEmpty())
+			{
+				Chunk += FString::Printf(TEXT("%d,%d,%s,%u,%.2f\n"), Repeat, Index, GetEditOpName(Record.Op), Record.TimeMs, OpSeconds * 1e6);
+			}
+
+			if (Record.Op == EBoardEditOp::Load)
+			{
+				Index += Record.Count;
+			}
+		}
+	}
+
+	double TotalSeconds = 0.0;
+	for (int32 OpIndex = 0; OpIndex < static_cast<int32>(EBoardEditOp::Count); ++OpIndex)
+	{
+		const FEditOpTiming& Timing = Timings[OpIndex];
+		if (Timing.Calls > 0)
+		{
+			TotalSeconds += Timing.TotalSeconds;
+			UE_LOG(LogArcaneBoardReplay, Display, TEXT("%-8s %7d회  평균 %8.2fus  최대 %8.2fus"), GetEditOpName(static_cast<EBoardEditOp>(OpIndex)),
+				Timing.Calls, Timing.TotalSeconds * 1e6 / Timing.Calls, Timing.MaxSeconds * 1e6);
+		}
+	}
+
+	if (!OutputPath.IsEmpty() && !FFileHelper::SaveStringToFile(Chunk, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogArcaneBoardReplay, Error, TEXT("출력 파일을 만들 수 없음: %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogArcaneBoardReplay, Display, TEXT("%s: 레코드 %d개 x %d회 재생, 편집 합계 %.3fms, 스냅샷 불일치 %d"),
+		*FPaths::GetCleanFilename(LogPath), static_cast<int32>(Records.size()), NumRepeats, TotalSeconds * 1000.0, NumMismatches);
+	return NumMismatches > 0 ? 1 : 0;
+}
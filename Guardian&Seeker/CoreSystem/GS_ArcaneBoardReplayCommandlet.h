@@ -0,0 +1,25 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GS_ArcaneBoardReplayCommandlet.generated.h"
+
+/**
+ * 보드 편집 기록 재생 커맨드렛 (버그 재현/성능 회귀용)
+ * - UGS_ArcaneBoardManager::DumpEditRecording으로 저장한 파일을 새 매니저에 그대로 재생
+ * - 편집 종류별 호출 수/평균/최대 시간 출력, -Output이 있으면 편집별 시간을 CSV로 저장
+ * - 중간 스냅샷은 다시 적용하지 않고 재생 결과와 비교 (다르면 비결정적 재생으로 보고)
+ * - 사용법: -run=GS_ArcaneBoardReplay -Log=Session.abel [-Repeat=N] [-Realtime] [-Output=Timings.csv]
+ */
+UCLASS()
+class GAS_API UGS_ArcaneBoardReplayCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGS_ArcaneBoardReplayCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
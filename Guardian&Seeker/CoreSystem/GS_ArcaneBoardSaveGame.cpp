@@ -0,0 +1,43 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RuneSystem/GS_ArcaneBoardSaveGame.h"
+
+UGS_ArcaneBoardSaveGame::UGS_ArcaneBoardSaveGame()
+	: SaveVersion(ESaveVersion::Initial)
+{
+	// 이전 세이브에는 버전 값이 없으므로 기본값은 Initial, 저장 시 Latest로 기록
+}
+
+void UGS_ArcaneBoardSaveGame::Serialize(FArchive& Ar)
+{
+	if (Ar.IsSaving())
+	{
+		MigrateToLatest();
+	}
+
+	Super::Serialize(Ar);
+
+	if (Ar.IsLoading())
+	{
+		MigrateToLatest();
+	}
+}
+
+void UGS_ArcaneBoardSaveGame::MigrateToLatest()
+{
+	if (SaveVersion < ESaveVersion::WideRuneIDs)
+	{
+		// uint8 ID는 그대로 외부 ID
+		// 프리셋의 FPlacedRuneInfo::RuneID는 태그 직렬화의 숫자 타입 변환으로 int32로 로드됨
+		for (uint8 RuneID : OwnedRuneIDs)
+		{
+			if (RuneID != 0)
+			{
+				OwnedRuneExternalIDs.Add(RuneID);
+			}
+		}
+		OwnedRuneIDs.Empty();
+	}
+
+	SaveVersion = ESaveVersion::Latest;
+}
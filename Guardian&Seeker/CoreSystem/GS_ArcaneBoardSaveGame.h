@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/SaveGame.h"
+#include "GS_ArcaneBoardTypes.h"
+#include "GS_ArcaneBoardSaveGame.generated.h"
+
+/**
+ * 아케인 보드 세이브 데이터
+ * - 룬 ID는 테이블의 외부 ID로 저장 (내부 인덱스는 테이블 구성에 따라 바뀔 수 있음)
+ * - 로드 시 이전 포맷을 최신 포맷으로 변환
+ */
+UCLASS()
+class GAS_API UGS_ArcaneBoardSaveGame : public USaveGame
+{
+	GENERATED_BODY()
+
+public:
+	enum ESaveVersion : int32
+	{
+		// 룬 ID uint8
+		Initial = 0,
+		// 룬 ID int32 외부 ID
+		WideRuneIDs = 1,
+
+		Latest = WideRuneIDs
+	};
+
+	UGS_ArcaneBoardSaveGame();
+
+	virtual void Serialize(FArchive& Ar) override;
+
+	UPROPERTY()
+	int32 SaveVersion;
+
+	UPROPERTY()
+	TMap<ECharacterClass, FArcaneBoardPresets> SavedRunesByClass;
+
+	UPROPERTY()
+	TSet<int32> OwnedRuneExternalIDs;
+
+	// 2개 이상 보유한 룬만 기록, 없으면 1개
+	UPROPERTY()
+	TMap<int32, int32> RuneStackCounts;
+
+private:
+	// Initial 포맷의 소유 룬 (로드 전용, 변환 후 비움)
+	UPROPERTY()
+	TSet<uint8> OwnedRuneIDs;
+
+	void MigrateToLatest();
+};
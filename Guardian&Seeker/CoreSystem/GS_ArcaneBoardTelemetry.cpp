@@ -0,0 +1,175 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RuneSystem/GS_ArcaneBoardTelemetry.h"
+#include "RuneSystem/GS_ArcaneBoardManager.h"
+#include "RuneSystem/GS_ArcaneBoardCoreAdapter.h"
+#include "RuneSystem/GS_RuneDataCatalog.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+static TAutoConsoleVariable<int32> CVarArcaneBoardTelemetry(
+	TEXT("ArcaneBoard.Telemetry"),
+	1,
+	TEXT("1이면 적용한 보드 구성을 로컬에 집계해 Saved/ArcaneBoard/Telemetry에 저장"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarArcaneBoardTelemetryFlushSeconds(
+	TEXT("ArcaneBoard.TelemetryFlushSeconds"),
+	300.0f,
+	TEXT("보드 구성 집계를 파일로 내보내는 간격 (초)"),
+	ECVF_Default);
+
+static FAutoConsoleCommand CmdArcaneBoardFlushTelemetry(
+	TEXT("ArcaneBoard.FlushTelemetry"),
+	TEXT("지금까지 모인 보드 구성 집계를 바로 파일로 내보냄"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FGS_ArcaneBoardTelemetry::Get().Flush();
+	}));
+
+FGS_ArcaneBoardTelemetry& FGS_ArcaneBoardTelemetry::Get()
+{
+	check(IsInGameThread());
+
+	static FGS_ArcaneBoardTelemetry Telemetry;
+	return Telemetry;
+}
+
+void FGS_ArcaneBoardTelemetry::RecordAppliedBoard(const UGS_ArcaneBoardManager& BoardManager)
+{
+	const TSharedPtr<const FGS_RuneDataCatalog>& RuneData = BoardManager.GetRuneDataCatalog();
+	const ArcaneCore::FBoardState& BoardState = BoardManager.GetBoardState();
+	if (CVarArcaneBoardTelemetry.GetValueOnGameThread() == 0 || !RuneData.IsValid() || !BoardState.GetLayout())
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (Aggregator.GetNumBoards() > 0 &&
+		(!WindowRuneData.HasSameObject(RuneData.Get()) || Now - WindowStartTime >= CVarArcaneBoardTelemetryFlushSeconds.GetValueOnGameThread()))
+	{
+		Flush();
+	}
+	if (Aggregator.GetNumBoards() == 0)
+	{
+		SetWindowRuneData(RuneData);
+		WindowStartTime = Now;
+
+		// 더 적용하지 않아도 구간이 끝나면 내보내도록
+		if (!FlushTickerHandle.IsValid())
+		{
+			FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGS_ArcaneBoardTelemetry::TickFlush),
+				FMath::Max(CVarArcaneBoardTelemetryFlushSeconds.GetValueOnGameThread(), 1.0f));
+		}
+	}
+
+	if (HashedLayout != BoardState.GetLayout())
+	{
+		HashedLayout = BoardState.GetLayout();
+		HashedLayoutValue = ArcaneCore::HashLayout(*HashedLayout);
+	}
+
+	ArcaneCore::FBoardFingerprint Fingerprint;
+	Fingerprint.LayoutHash = HashedLayoutValue;
+	Fingerprint.LayoutIndex = static_cast<uint8>(BoardManager.CurrClass);
+	Fingerprint.Runes = BoardState.GetPlacedRunes();
+	Fingerprint.StatTotals = ArcaneBoardAdapter::ToTotalStatBlock(BoardManager.AppliedBoardStats);
+	Aggregator.Add(Fingerprint);
+}
+
+void FGS_ArcaneBoardTelemetry::Flush(bool bWait)
+{
+	const TSharedPtr<const FGS_RuneDataCatalog> RuneData = WindowRuneData.Pin();
+	FlushWindow(RuneData.IsValid() ? &RuneData->GetRemap() : nullptr, bWait);
+}
+
+void FGS_ArcaneBoardTelemetry::SetWindowRuneData(const TSharedPtr<const FGS_RuneDataCatalog>& RuneData)
+{
+	if (WindowRuneData.HasSameObject(RuneData.Get()))
+	{
+		return;
+	}
+
+	if (const TSharedPtr<const FGS_RuneDataCatalog> OldRuneData = WindowRuneData.Pin())
+	{
+		OldRuneData->OnRuneDataChanged().RemoveAll(this);
+	}
+	WindowRuneData = RuneData;
+	HashedLayout = nullptr;
+	if (RuneData.IsValid())
+	{
+		RuneData->OnRuneDataChanged().AddRaw(this, &FGS_ArcaneBoardTelemetry::HandleRuneDataChanged);
+	}
+}
+
+void FGS_ArcaneBoardTelemetry::HandleRuneDataChanged(const FGS_RuneDataChange& Change)
+{
+	// 레이아웃 캐시가 비워지면 같은 주소에 새 레이아웃이 만들어질 수 있음
+	HashedLayout = nullptr;
+
+	// 집계된 룬은 변경 전 내부 인덱스 기준
+	if (Change.bRemapped)
+	{
+		FlushWindow(&Change.OldRemap, false);
+	}
+	else
+	{
+		Flush();
+	}
+}
+
+bool FGS_ArcaneBoardTelemetry::TickFlush(float DeltaTime)
+{
+	if (FPlatformTime::Seconds() - WindowStartTime < CVarArcaneBoardTelemetryFlushSeconds.GetValueOnGameThread())
+	{
+		return true;
+	}
+
+	// 반환값으로 티커가 제거되므로 FlushWindow에서 다시 제거하지 않도록
+	FlushTickerHandle.Reset();
+	Flush();
+	return false;
+}
+
+void FGS_ArcaneBoardTelemetry::FlushWindow(const ArcaneCore::FRuneIdRemap* Remap, bool bWait)
+{
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+	}
+
+	if (Aggregator.GetNumBoards() == 0)
+	{
+		return;
+	}
+
+	// 직렬화만 게임 스레드에서 (고정 크기 메모리 복사), 파일 쓰기는 백그라운드
+	std::vector<uint8> Bytes;
+	Aggregator.Serialize(Remap, Bytes);
+	Aggregator.Clear();
+
+	// 구간 사이에 매니저가 바뀌어 레이아웃이 같은 주소에 다시 할당될 수 있으므로 구간마다 다시 해시
+	HashedLayout = nullptr;
+
+	const FString FilePath = FPaths::ProjectSavedDir() / TEXT("ArcaneBoard/Telemetry") / FString::Printf(TEXT("Board_%s.abtm"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S-%s")));
+	auto WriteFile = [Bytes = MoveTemp(Bytes), FilePath]()
+	{
+		if (!FFileHelper::SaveArrayToFile(TArrayView<const uint8>(Bytes.data(), static_cast<int32>(Bytes.size())), *FilePath))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("FGS_ArcaneBoardTelemetry: 파일을 쓸 수 없음 %s"), *FilePath);
+		}
+	};
+
+	if (bWait)
+	{
+		WriteFile();
+	}
+	else
+	{
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, MoveTemp(WriteFile));
+	}
+}
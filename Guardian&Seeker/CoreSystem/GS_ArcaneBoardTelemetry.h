@@ -0,0 +1,52 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "ArcaneBoardTelemetry.h"
+
+class UGS_ArcaneBoardManager;
+class FGS_RuneDataCatalog;
+struct FGS_RuneDataChange;
+
+namespace ArcaneCore
+{
+	class FBoardLayout;
+}
+
+/**
+ * 적용한 보드 구성 로컬 집계 (밸런스/최적화 우선순위용)
+ * - 보드 적용마다 지문(레이아웃 해시, 룬 비트셋, 스탯 합계)을 고정 크기 집계에 누적, 파일 쓰기는 백그라운드
+ * - ArcaneBoard.TelemetryFlushSeconds가 지나면 (적용이 없어도 티커로) Saved/ArcaneBoard/Telemetry에 구간 파일로 내보내고 비움
+ * - 구간 중 룬 데이터가 바뀌면 (내부 인덱스가 달라지므로) 변경 전 기준으로 먼저 내보냄
+ * - 게임 스레드 전용
+ */
+class GAS_API FGS_ArcaneBoardTelemetry
+{
+public:
+	static FGS_ArcaneBoardTelemetry& Get();
+
+	// ArcaneBoard.Telemetry가 꺼져 있으면 무시
+	void RecordAppliedBoard(const UGS_ArcaneBoardManager& BoardManager);
+
+	// 모인 게 있으면 파일로 내보내고 비움, bWait면 쓰기가 끝날 때까지 대기 (종료 시)
+	void Flush(bool bWait = false);
+
+private:
+	ArcaneCore::FBoardTelemetryAggregator Aggregator;
+
+	// 현재 구간 룬 ID 기준
+	TWeakPtr<const FGS_RuneDataCatalog> WindowRuneData;
+	double WindowStartTime = 0.0;
+	FTSTicker::FDelegateHandle FlushTickerHandle;
+
+	// 마지막 레이아웃 해시 (적용은 대부분 같은 레이아웃), 룬 데이터가 바뀌면 레이아웃이 다시 만들어지므로 비움
+	const ArcaneCore::FBoardLayout* HashedLayout = nullptr;
+	uint64 HashedLayoutValue = 0;
+
+	void FlushWindow(const ArcaneCore::FRuneIdRemap* Remap, bool bWait);
+	void SetWindowRuneData(const TSharedPtr<const FGS_RuneDataCatalog>& RuneData);
+	void HandleRuneDataChanged(const FGS_RuneDataChange& Change);
+	bool TickFlush(float DeltaTime);
+};
@@ -0,0 +1,186 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RuneSystem/GS_ArcaneBoardValidationSubsystem.h"
+#include "RuneSystem/GS_ArcaneBoardNetComponent.h"
+#include "RuneSystem/GS_ArcaneBoardManager.h"
+#include "RuneSystem/GS_ArcaneBoardCoreAdapter.h"
+#include "RuneSystem/GS_ArcaneBoardProfiling.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarArcaneBoardValidationBudgetMs(
+	TEXT("ArcaneBoard.ValidationBudgetMs"),
+	1.0f,
+	TEXT("틱당 보드 검증에 쓸 시간 (ms), 최소 한 건은 처리"),
+	ECVF_Default);
+
+bool UGS_ArcaneBoardValidationSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void UGS_ArcaneBoardValidationSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (InWorld.GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	// 첫 제출에서 테이블 로드/레이아웃 생성이 일어나지 않도록 미리 준비
+	if (UGS_ArcaneBoardManager* Manager = GetOrCreateDataManager())
+	{
+		for (ECharacterClass Class : { ECharacterClass::Ares, ECharacterClass::Merci, ECharacterClass::Chan })
+		{
+			Manager->GetClassLayout(Class);
+		}
+	}
+}
+
+void UGS_ArcaneBoardValidationSubsystem::Deinitialize()
+{
+	PendingSubmissions.Empty();
+	PendingOrder.Empty();
+	ValidatedBoards.Empty();
+	SET_DWORD_STAT(STAT_ArcaneBoard_PendingValidations, 0);
+	if (IsValid(DataManager))
+	{
+		DataManager->GetRuneDataCatalog()->OnRuneDataChanged().RemoveAll(this);
+	}
+	DataManager = nullptr;
+
+	Super::Deinitialize();
+}
+
+TStatId UGS_ArcaneBoardValidationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGS_ArcaneBoardValidationSubsystem, STATGROUP_ArcaneBoard);
+}
+
+void UGS_ArcaneBoardValidationSubsystem::EnqueueSubmission(UGS_ArcaneBoardNetComponent* Player, ECharacterClass Class, const TArray<FGS_CompactRunePlacement>& Placements)
+{
+	if (!IsValid(Player))
+	{
+		return;
+	}
+
+	FPendingSubmission* Pending = PendingSubmissions.Find(Player);
+	if (!Pending)
+	{
+		Pending = &PendingSubmissions.Add(Player);
+		PendingOrder.Add(Player);
+	}
+
+	Pending->Class = Class;
+	Pending->Placements = Placements;
+	SET_DWORD_STAT(STAT_ArcaneBoard_PendingValidations, PendingOrder.Num());
+}
+
+void UGS_ArcaneBoardValidationSubsystem::RemovePlayer(UGS_ArcaneBoardNetComponent* Player)
+{
+	PendingSubmissions.Remove(Player);
+	PendingOrder.Remove(Player);
+	ValidatedBoards.Remove(Player);
+	SET_DWORD_STAT(STAT_ArcaneBoard_PendingValidations, PendingOrder.Num());
+}
+
+void UGS_ArcaneBoardValidationSubsystem::Tick(float DeltaTime)
+{
+	const double EndTime = FPlatformTime::Seconds() + CVarArcaneBoardValidationBudgetMs.GetValueOnGameThread() / 1000.0;
+
+	do
+	{
+		// 결과 알림에서 플레이어가 나가 RemovePlayer가 불려도 되도록 처리 전에 대기열에서 뺌
+		const TWeakObjectPtr<UGS_ArcaneBoardNetComponent> Player = PendingOrder[0];
+		PendingOrder.RemoveAt(0);
+
+		FPendingSubmission Submission;
+		if (PendingSubmissions.RemoveAndCopyValue(Player, Submission) && Player.IsValid())
+		{
+			ProcessSubmission(Player.Get(), Submission);
+		}
+	}
+	while (PendingOrder.Num() > 0 && FPlatformTime::Seconds() < EndTime);
+
+	// 떠난 플레이어의 검증 상태 정리
+	for (auto It = ValidatedBoards.CreateIterator(); It; ++It)
+	{
+		if (!It->Key.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	SET_DWORD_STAT(STAT_ArcaneBoard_PendingValidations, PendingOrder.Num());
+}
+
+UGS_ArcaneBoardManager* UGS_ArcaneBoardValidationSubsystem::GetOrCreateDataManager()
+{
+	if (!IsValid(DataManager))
+	{
+		DataManager = NewObject<UGS_ArcaneBoardManager>(this);
+		DataManager->GetRuneDataCatalog()->OnRuneDataChanged().AddUObject(this, &UGS_ArcaneBoardValidationSubsystem::HandleRuneDataChanged);
+	}
+	return DataManager;
+}
+
+void UGS_ArcaneBoardValidationSubsystem::HandleRuneDataChanged(const FGS_RuneDataChange& Change)
+{
+	ValidatedBoards.Empty();
+}
+
+void UGS_ArcaneBoardValidationSubsystem::ProcessSubmission(UGS_ArcaneBoardNetComponent* Player, const FPendingSubmission& Submission)
+{
+	ARCANEBOARD_SCOPE_CYCLE_COUNTER(ValidateSubmittedBoard);
+
+	if (Submission.Placements.Num() > UGS_ArcaneBoardNetComponent::MaxSubmittedRunes)
+	{
+		Player->OnValidationFinished(EArcaneBoardValidationResult::TooManyRunes, Player->ValidatedStats);
+		return;
+	}
+
+	UGS_ArcaneBoardManager* Manager = GetOrCreateDataManager();
+	const ArcaneCore::FBoardLayout* Layout = Manager ? Manager->GetClassLayout(Submission.Class) : nullptr;
+	if (!Layout)
+	{
+		Player->OnValidationFinished(EArcaneBoardValidationResult::InvalidClass, Player->ValidatedStats);
+		return;
+	}
+
+	TUniquePtr<FValidatedBoard>& Validated = ValidatedBoards.FindOrAdd(Player);
+	if (!Validated.IsValid() || Validated->Class != Submission.Class)
+	{
+		// 클래스가 바뀌면 빈 보드부터 다시 검증
+		if (!Validated.IsValid())
+		{
+			Validated = MakeUnique<FValidatedBoard>();
+		}
+		Validated->Class = Submission.Class;
+		Validated->State.Reset(Layout, &Manager->GetRuneCatalog(), &Manager->GetSynergyRules());
+	}
+
+	ScratchPlacements.clear();
+	for (const FGS_CompactRunePlacement& Compact : Submission.Placements)
+	{
+		// 테이블에 없는 외부 ID는 내부 0으로 바뀌어 검증에서 거부
+		ScratchPlacements.push_back(ArcaneBoardAdapter::ToPlacement(Compact, Manager->GetRuneIdRemap()));
+	}
+
+	const ArcaneCore::EValidationResult Result = ArcaneCore::ApplySubmittedBoard(Validated->State,
+		ScratchPlacements.data(), static_cast<int32>(ScratchPlacements.size()), Player->GetOwnedRunes());
+
+	// 실패해도 이전에 검증된 보드로 되돌려져 있으므로 그 스탯을 다시 보냄
+	const FArcaneBoardStats Stats = ArcaneBoardAdapter::ToBoardStats(Validated->State.Evaluate());
+	if (Result == ArcaneCore::EValidationResult::Accepted)
+	{
+		Player->SetAppliedBoard(Submission.Class, Validated->State.GetPlacements(), Manager->GetRuneIdRemap());
+	}
+	Player->OnValidationFinished(ArcaneBoardAdapter::ToValidationResult(Result), Stats);
+}
@@ -0,0 +1,71 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GS_ArcaneBoardTypes.h"
+#include "ArcaneBoardState.h"
+#include "GS_RuneDataCatalog.h"
+#include "GS_ArcaneBoardValidationSubsystem.generated.h"
+
+class UGS_ArcaneBoardManager;
+class UGS_ArcaneBoardNetComponent;
+
+/**
+ * 서버 권한 아케인 보드 검증
+ * - 플레이어별로 마지막으로 검증된 보드 상태를 유지하고, 제출이 오면 바뀐 룬만 검사
+ * - 제출은 플레이어당 하나로 합쳐 대기열에 넣고 틱마다 시간 예산 안에서 처리
+ *   (매치 시작 시 동시 제출이 몰려도 한 프레임에 몰아서 처리하지 않음)
+ * - 룬/레이아웃/시너지 데이터는 월드 시작 시 미리 로드
+ */
+UCLASS()
+class GAS_API UGS_ArcaneBoardValidationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return PendingOrder.Num() > 0; }
+
+	// 같은 플레이어의 이전 제출이 아직 대기 중이면 최신 제출로 교체
+	void EnqueueSubmission(UGS_ArcaneBoardNetComponent* Player, ECharacterClass Class, const TArray<FGS_CompactRunePlacement>& Placements);
+
+	void RemovePlayer(UGS_ArcaneBoardNetComponent* Player);
+
+	// 서버 쪽 룬/레이아웃 데이터 (외부 룬 ID 변환 포함)
+	UGS_ArcaneBoardManager* GetOrCreateDataManager();
+
+private:
+	struct FPendingSubmission
+	{
+		ECharacterClass Class = ECharacterClass::Ares;
+		TArray<FGS_CompactRunePlacement> Placements;
+	};
+
+	// 플레이어별 마지막으로 검증된 보드
+	struct FValidatedBoard
+	{
+		ECharacterClass Class = ECharacterClass::Ares;
+		ArcaneCore::FBoardState State;
+	};
+
+	UPROPERTY()
+	UGS_ArcaneBoardManager* DataManager;
+
+	TMap<TWeakObjectPtr<UGS_ArcaneBoardNetComponent>, FPendingSubmission> PendingSubmissions;
+	TArray<TWeakObjectPtr<UGS_ArcaneBoardNetComponent>> PendingOrder;
+	TMap<TWeakObjectPtr<UGS_ArcaneBoardNetComponent>, TUniquePtr<FValidatedBoard>> ValidatedBoards;
+
+	std::vector<ArcaneCore::FPlacement> ScratchPlacements;
+
+	void ProcessSubmission(UGS_ArcaneBoardNetComponent* Player, const FPendingSubmission& Submission);
+
+	// 에디터에서 룬 데이터가 바뀌면 검증된 보드를 버리고 다음 제출을 빈 보드부터 검증
+	void HandleRuneDataChanged(const FGS_RuneDataChange& Change);
+};
@@ -4,6 +4,8 @@
 #include "RuneSystem/GS_ArcaneBoardManager.h"
 #include "RuneSystem/GS_GridLayoutDataAsset.h"
 #include "RuneSystem/GS_ArcaneBoardLPS.h"
+#include "RuneSystem/GS_ArcaneBoardProfiling.h"
+#include "RuneSystem/GS_ArcaneBoardCoreAdapter.h"
 #include "Components/UniformGridPanel.h"
 #include "Components/Button.h"
 #include "UI/RuneSystem/GS_RuneGridCellWidget.h"
@@ -19,15 +21,27 @@ UGS_ArcaneBoardWidget::UGS_ArcaneBoardWidget(const FObjectInitializer& ObjectIni
 	: Super(ObjectInitializer)
 {
 	SelectedRuneID = 0;
+	SelectedRuneOrientation = 0;
 	bIsInSelectionMode = false;
+	PreviewAnchorPos = FIntPoint::ZeroValue;
+	bHasPreviewAnchor = false;
+	RotateRuneKey = EKeys::R;
+	MirrorRuneKey = EKeys::F;
 	SelectionVisualWidget = nullptr;
+	CachedSelectionVisualWidget = nullptr;
 	RuneTooltipWidget = nullptr;
+	CachedTooltipWidget = nullptr;
 	CurrTooltipRuneID = 0;
 	LastClickedCell = nullptr;
 	BoardManager = nullptr;
 	ArcaneBoardLPS = nullptr;
 	PendingPresetIndex = -1;
 	PresetSaveConfirmPopup = nullptr;
+	NextGridCellIndex = 0;
+	bDeferBoardBuild = false;
+
+	// 드래그 중 회전/반전 키 입력용
+	SetIsFocusable(true);
 }
 
 void UGS_ArcaneBoardWidget::NativeConstruct()
@@ -67,16 +81,18 @@ void UGS_ArcaneBoardWidget::NativeDestruct()
 {
 	UnbindFromLPS();
 
-	if (IsValid(SelectionVisualWidget))
+	SelectionVisualWidget = nullptr;
+	if (IsValid(CachedSelectionVisualWidget))
 	{
-		SelectionVisualWidget->RemoveFromParent();
-		SelectionVisualWidget = nullptr;
+		CachedSelectionVisualWidget->RemoveFromParent();
+		CachedSelectionVisualWidget = nullptr;
 	}
 
-	if (IsValid(RuneTooltipWidget))
+	RuneTooltipWidget = nullptr;
+	if (IsValid(CachedTooltipWidget))
 	{
-		RuneTooltipWidget->RemoveFromParent();
-		RuneTooltipWidget = nullptr;
+		CachedTooltipWidget->RemoveFromParent();
+		CachedTooltipWidget = nullptr;
 	}
 
 	if (IsValid(PresetSaveConfirmPopup))
@@ -88,6 +104,7 @@ void UGS_ArcaneBoardWidget::NativeDestruct()
 	if (GetWorld())
 	{
 		GetWorld()->GetTimerManager().ClearTimer(TooltipDelayTimer);
+		GetWorld()->GetTimerManager().ClearTimer(StatPanelUpdateTimer);
 	}
 
 	Super::NativeDestruct();
@@ -123,6 +140,8 @@ FReply UGS_ArcaneBoardWidget::NativeOnMouseMove(const FGeometry& InGeometry, con
 		return Reply;
 	}
 
+	ARCANEBOARD_SCOPE_CYCLE_COUNTER(PreviewMouseMove);
+
 	// 드래그 비주얼 위치 업데이트
 	PositionDragVisualAtMouse();
 
@@ -130,7 +149,7 @@ FReply UGS_ArcaneBoardWidget::NativeOnMouseMove(const FGeometry& InGeometry, con
 	UGS_RuneGridCellWidget* CellUnderMouse = GetCellAtPos(MousePos);
 	if (CellUnderMouse)
 	{
-		UpdateGridPreview(SelectedRuneID, CellUnderMouse->GetCellPos());
+		UpdateGridPreview(SelectedRuneID, CellUnderMouse->GetCellPos(), SelectedRuneOrientation);
 	}
 	else
 	{
@@ -154,7 +173,7 @@ FReply UGS_ArcaneBoardWidget::NativeOnMouseButtonDown(const FGeometry& InGeometr
 
 		if (CellUnderMouse)
 		{
-			uint8 RuneID = CellUnderMouse->GetPlacedRuneID();
+			int32 RuneID = CellUnderMouse->GetPlacedRuneID();
 
 			if (bIsInSelectionMode)
 			{
@@ -178,6 +197,36 @@ FReply UGS_ArcaneBoardWidget::NativeOnMouseButtonDown(const FGeometry& InGeometr
 	return Reply;
 }
 
+FReply UGS_ArcaneBoardWidget::NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
+{
+	if (bIsInSelectionMode && InMouseEvent.GetWheelDelta() != 0.f)
+	{
+		RotateSelectedRune(InMouseEvent.GetWheelDelta() > 0.f ? 1 : -1);
+		return FReply::Handled();
+	}
+
+	return Super::NativeOnMouseWheel(InGeometry, InMouseEvent);
+}
+
+FReply UGS_ArcaneBoardWidget::NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent)
+{
+	if (bIsInSelectionMode)
+	{
+		if (InKeyEvent.GetKey() == RotateRuneKey)
+		{
+			RotateSelectedRune(InKeyEvent.IsShiftDown() ? -1 : 1);
+			return FReply::Handled();
+		}
+		else if (InKeyEvent.GetKey() == MirrorRuneKey)
+		{
+			MirrorSelectedRune();
+			return FReply::Handled();
+		}
+	}
+
+	return Super::NativeOnKeyDown(InGeometry, InKeyEvent);
+}
+
 void UGS_ArcaneBoardWidget::RefreshForCurrCharacter()
 {
 	if (IsValid(BoardManager))
@@ -192,6 +241,7 @@ void UGS_ArcaneBoardWidget::RefreshForCurrCharacter()
 
 		if (IsValid(StatPanel))
 		{
+			// 목록을 새로 만들었으므로 같은 값이어도 다시 채움
 			StatPanel->InitStatList(BoardManager);
 			OnStatsChanged(BoardManager->CurrBoardStats);
 		}
@@ -200,15 +250,54 @@ void UGS_ArcaneBoardWidget::RefreshForCurrCharacter()
 	}
 }
 
+void UGS_ArcaneBoardWidget::RefreshForRuneDataChange(bool bRemapped)
+{
+	if (bIsInSelectionMode)
+	{
+		EndRuneSelection(false);
+	}
+
+	// 인벤토리 항목 풀이 내부 인덱스 기준이므로 재매핑되면 새로 만듦
+	if (bRemapped && IsValid(RuneInven))
+	{
+		RuneInven->ResetItemPool();
+	}
+
+	RefreshForCurrCharacter();
+}
+
 void UGS_ArcaneBoardWidget::OnStatsChanged(const FArcaneBoardStats& NewStats)
 {
-	if (IsValid(StatPanel))
+	// 교체 배치(제거 + 배치)처럼 한 프레임에 여러 번 와도 패널은 다음 틱에 한 번만 갱신
+	PendingPanelStats = NewStats;
+
+	UWorld* World = GetWorld();
+	if (!World)
 	{
-		StatPanel->UpdateStats(NewStats);
+		FlushStatPanel();
+		return;
+	}
+
+	if (!StatPanelUpdateTimer.IsValid())
+	{
+		StatPanelUpdateTimer = World->GetTimerManager().SetTimerForNextTick(this, &UGS_ArcaneBoardWidget::FlushStatPanel);
 	}
 }
 
-void UGS_ArcaneBoardWidget::StartRuneSelection(uint8 RuneID)
+void UGS_ArcaneBoardWidget::FlushStatPanel()
+{
+	StatPanelUpdateTimer.Invalidate();
+
+	if (!IsValid(StatPanel))
+	{
+		return;
+	}
+
+	// 패널이 칸별로 표시 값을 캐시하고 바뀐 칸만 다시 씀
+	StatPanel->UpdateStats(PendingPanelStats);
+}
+
+void UGS_ArcaneBoardWidget::StartRuneSelection(int32 RuneID, uint8 Orientation)
 {
 	UE_LOG(LogTemp, Display, TEXT("룬 선택 시작: ID=%d"), RuneID);
 
@@ -225,27 +314,23 @@ void UGS_ArcaneBoardWidget::StartRuneSelection(uint8 RuneID)
 	}
 
 	SelectedRuneID = RuneID;
+	SelectedRuneOrientation = Orientation;
 	bIsInSelectionMode = true;
 
+	RefreshAnchorHints();
+
 	if (IsValid(DragVisualWidgetClass) && IsValid(BoardManager))
 	{
-		SelectionVisualWidget = CreateWidget<UGS_DragVisualWidget>(this, DragVisualWidgetClass);
+		SelectionVisualWidget = AcquireSelectionVisual();
 		if (SelectionVisualWidget)
 		{
-			UTexture2D* RuneTexture = BoardManager->GetRuneTexture(RuneID);
-			TMap<FIntPoint, UTexture2D*> RuneShape;
-			BoardManager->GetFragmentedRuneTexture(RuneID, RuneShape);
-
-			FVector2D BoardCellSize = GetArcaneBoardCellSize();
-			float ScaleFactor = 0.6f;
-
-			SelectionVisualWidget->Setup(RuneID, RuneTexture, RuneShape, BoardCellSize, ScaleFactor);
-			SelectionVisualWidget->SetVisibility(ESlateVisibility::HitTestInvisible);
-			SelectionVisualWidget->AddToViewport(3);
-
+			SetupSelectionVisual();
 			PositionDragVisualAtMouse();
+			SelectionVisualWidget->SetVisibility(ESlateVisibility::HitTestInvisible);
 		}
 	}
+
+	SetKeyboardFocus();
 }
 
 void UGS_ArcaneBoardWidget::EndRuneSelection(bool bPlaceRune)
@@ -259,11 +344,7 @@ void UGS_ArcaneBoardWidget::EndRuneSelection(bool bPlaceRune)
 			UGameplayStatics::PlaySound2D(this, RuneCancelSound);
 		}
 
-		if (IsValid(SelectionVisualWidget))
-		{
-			SelectionVisualWidget->RemoveFromParent();
-			SelectionVisualWidget = nullptr;
-		}
+		ReleaseSelectionVisual();
 		ClearPreview();
 	}
 	else
@@ -276,9 +357,9 @@ void UGS_ArcaneBoardWidget::EndRuneSelection(bool bPlaceRune)
 			{
 				FIntPoint PlacementPos = TargetCell->GetCellPos();
 				int32 PreviousConnectedRuneCnt = BoardManager->ConnectedRuneCnt;
-				TArray<uint8> RemovedRunes;
+				TArray<int32> RemovedRunes;
 
-				bool bPlaceSuccess = BoardManager->PlaceRune(SelectedRuneID, PlacementPos, RemovedRunes);
+				bool bPlaceSuccess = BoardManager->PlaceRune(SelectedRuneID, PlacementPos, RemovedRunes, SelectedRuneOrientation);
 
 				if (bPlaceSuccess)
 				{
@@ -304,7 +385,7 @@ void UGS_ArcaneBoardWidget::EndRuneSelection(bool bPlaceRune)
 					}
 
 					// 제거된 룬들 UI 업데이트
-					for (uint8 RemovedRuneID : RemovedRunes)
+					for (int32 RemovedRuneID : RemovedRunes)
 					{
 						if (IsValid(RuneInven))
 						{
@@ -336,21 +417,20 @@ void UGS_ArcaneBoardWidget::EndRuneSelection(bool bPlaceRune)
 				UE_LOG(LogTemp, Warning, TEXT("클릭한 셀을 찾을 수 없음"));
 			}
 
-			if (IsValid(SelectionVisualWidget))
-			{
-				SelectionVisualWidget->RemoveFromParent();
-				SelectionVisualWidget = nullptr;
-			}
+			ReleaseSelectionVisual();
 		}
 		ClearPreview();
 	}
 
+	ClearAnchorHints();
+
 	LastClickedCell = nullptr;
 	bIsInSelectionMode = false;
 	SelectedRuneID = 0;
+	SelectedRuneOrientation = 0;
 }
 
-void UGS_ArcaneBoardWidget::RequestShowTooltip(uint8 RuneID, const FVector2D& MousePos)
+void UGS_ArcaneBoardWidget::RequestShowTooltip(int32 RuneID, const FVector2D& MousePos)
 {
 	if (!ShouldShowTooltip())
 	{
@@ -404,16 +484,31 @@ void UGS_ArcaneBoardWidget::HideTooltip()
 
 	if (IsValid(RuneTooltipWidget))
 	{
-		RuneTooltipWidget->RemoveFromParent();
+		RuneTooltipWidget->SetVisibility(ESlateVisibility::Collapsed);
 		RuneTooltipWidget = nullptr;
 	}
 }
 
-uint8 UGS_ArcaneBoardWidget::GetSelectedRuneID() const
+int32 UGS_ArcaneBoardWidget::GetSelectedRuneID() const
 {
 	return SelectedRuneID;
 }
 
+uint8 UGS_ArcaneBoardWidget::GetSelectedRuneOrientation() const
+{
+	return SelectedRuneOrientation;
+}
+
+void UGS_ArcaneBoardWidget::RotateSelectedRune(int32 Steps)
+{
+	SetSelectedRuneOrientation(RuneOrientation::Rotate(SelectedRuneOrientation, Steps));
+}
+
+void UGS_ArcaneBoardWidget::MirrorSelectedRune()
+{
+	SetSelectedRuneOrientation(RuneOrientation::Mirror(SelectedRuneOrientation));
+}
+
 bool UGS_ArcaneBoardWidget::HasUnsavedChanges() const
 {
 	if (IsValid(BoardManager))
@@ -496,7 +591,7 @@ void UGS_ArcaneBoardWidget::BindToLPS()
 		ArcaneBoardLPS->SetCurrUIWidget(this);
 
 		BoardManager = ArcaneBoardLPS->GetOrCreateBoardManager();
-		if (IsValid(BoardManager))
+		if (IsValid(BoardManager) && !bDeferBoardBuild)
 		{
 			ArcaneBoardLPS->LoadBoardConfig();
 			RefreshForCurrCharacter();
@@ -512,25 +607,49 @@ void UGS_ArcaneBoardWidget::UnbindFromLPS()
 	}
 }
 
+bool UGS_ArcaneBoardWidget::PrewarmBoardChunk(double EndTime)
+{
+	if (!GenerateGridLayoutChunk(EndTime))
+	{
+		return false;
+	}
+	return !IsValid(RuneInven) || RuneInven->PrewarmItemPool(EndTime);
+}
+
 // 그리드 관리
 void UGS_ArcaneBoardWidget::GenerateGridLayout()
 {
+	GenerateGridLayoutChunk(TNumericLimits<double>::Max());
+}
+
+bool UGS_ArcaneBoardWidget::GenerateGridLayoutChunk(double EndTime)
+{
+	ARCANEBOARD_SCOPE_CYCLE_COUNTER(GenerateGridLayout);
+
 	if (!IsValid(BoardManager) || !IsValid(GridPanel) || !IsValid(GridCellWidgetClass))
 	{
-		return;
+		return true;
 	}
 
 	UGS_GridLayoutDataAsset* GridLayout = BoardManager->GetCurrGridLayout();
 	if (!GridLayout)
 	{
-		return;
+		return true;
 	}
 
-	GridPanel->ClearChildren();
-	GridCells.Empty();
+	// 같은 레이아웃이면 셀 위젯 재사용 (미리 만든 위젯을 다시 열 때), 나눠 만드는 중이면 이어서 만듦
+	if (GeneratedGridLayout.Get() != GridLayout)
+	{
+		GeneratedGridLayout = GridLayout;
+		GridPanel->ClearChildren();
+		GridCells.Empty();
+		NextGridCellIndex = 0;
+	}
 
-	for (const FGridCellData& CellData : GridLayout->GridCells)
+	const TArray<FGridCellData>& LayoutCells = GridLayout->GridCells;
+	while (NextGridCellIndex < LayoutCells.Num())
 	{
+		const FGridCellData& CellData = LayoutCells[NextGridCellIndex++];
 		UGS_RuneGridCellWidget* CellWidget = CreateWidget<UGS_RuneGridCellWidget>(this, GridCellWidgetClass);
 		if (CellWidget)
 		{
@@ -538,7 +657,13 @@ void UGS_ArcaneBoardWidget::GenerateGridLayout()
 			GridPanel->AddChildToUniformGrid(CellWidget, CellData.Pos.X, CellData.Pos.Y);
 			GridCells.Add(CellData.Pos, CellWidget);
 		}
+
+		if (FPlatformTime::Seconds() >= EndTime)
+		{
+			break;
+		}
 	}
+	return NextGridCellIndex >= LayoutCells.Num();
 }
 
 void UGS_ArcaneBoardWidget::UpdateGridVisuals()
@@ -555,25 +680,36 @@ void UGS_ArcaneBoardWidget::UpdateGridVisuals()
 
 		if (BoardManager->GetCellData(CellPair.Key, UpdatedCellData))
 		{
-			CellWidget->SetCellData(UpdatedCellData);
+			uint8 FragOrientation = 0;
+			UTexture2D* FragTexture = BoardManager->GetCellRuneTexture(CellPair.Key, FragOrientation);
+			CellWidget->SetCellData(UpdatedCellData, FragTexture, FragOrientation);
 		}
 	}
 }
 
-void UGS_ArcaneBoardWidget::UpdateGridPreview(uint8 RuneID, const FIntPoint& ReferenceCellPos)
+void UGS_ArcaneBoardWidget::UpdateGridPreview(int32 RuneID, const FIntPoint& ReferenceCellPos, uint8 Orientation, bool bForceRefresh)
 {
-	if (!IsValid(BoardManager))
+	// 같은 셀 안에서의 마우스 이동은 보드 복사/이벤트 없이 무시
+	if (!IsValid(BoardManager) || (!bForceRefresh && bHasPreviewAnchor && ReferenceCellPos == PreviewAnchorPos))
 	{
 		return;
 	}
 
-	ClearPreview();
+	// 미리보기가 이어지는 동안에는 해제 이벤트 없이 셀만 되돌림
+	ClearPreviewCells();
 
-	TArray<uint8> AffectedRuneIDs;
-	EPlacementResult PlacementResult = BoardManager->CheckRunePlacement(RuneID, ReferenceCellPos, AffectedRuneIDs);
+	PreviewAnchorPos = ReferenceCellPos;
+	bHasPreviewAnchor = true;
+
+	// 셀마다 검사하지 않고 룬을 들 때 만든 앵커 맵을 조회
+	if (!SelectionAnchors.IsBuiltFor(BoardManager->ToInternalRuneID(RuneID), Orientation))
+	{
+		BoardManager->BuildPlacementAnchorMap(RuneID, Orientation, SelectionAnchors);
+	}
+	const EPlacementResult PlacementResult = ArcaneBoardAdapter::ToPlacementResult(SelectionAnchors.Get(ArcaneBoardAdapter::ToCellPos(ReferenceCellPos)));
 
 	TArray<FIntPoint> RuneShape;
-	if (!BoardManager->GetRuneShape(RuneID, RuneShape))
+	if (!BoardManager->GetRuneShape(RuneID, RuneShape, Orientation))
 	{
 		return;
 	}
@@ -607,9 +743,23 @@ void UGS_ArcaneBoardWidget::UpdateGridPreview(uint8 RuneID, const FIntPoint& Ref
 			}
 		}
 	}
+
+	BoardManager->PreviewRunePlacement(RuneID, ReferenceCellPos, PlacementPreview, Orientation);
+	OnPlacementPreviewChanged(PlacementPreview);
 }
 
 void UGS_ArcaneBoardWidget::ClearPreview()
+{
+	const bool bHadPreview = bHasPreviewAnchor;
+	ClearPreviewCells();
+
+	if (bHadPreview)
+	{
+		OnPlacementPreviewCleared();
+	}
+}
+
+void UGS_ArcaneBoardWidget::ClearPreviewCells()
 {
 	for (const FIntPoint& CellPos : PreviewCells)
 	{
@@ -624,9 +774,90 @@ void UGS_ArcaneBoardWidget::ClearPreview()
 	}
 
 	PreviewCells.Empty();
+	bHasPreviewAnchor = false;
+}
+
+void UGS_ArcaneBoardWidget::RefreshAnchorHints()
+{
+	if (!IsValid(BoardManager) || !BoardManager->BuildPlacementAnchorMap(SelectedRuneID, SelectedRuneOrientation, SelectionAnchors))
+	{
+		ClearAnchorHints();
+		return;
+	}
+
+	for (auto& CellPair : GridCells)
+	{
+		if (!IsValid(CellPair.Value))
+		{
+			continue;
+		}
+
+		switch (SelectionAnchors.Get(ArcaneBoardAdapter::ToCellPos(CellPair.Key)))
+		{
+		case ArcaneCore::EPlacementResult::Valid:
+			CellPair.Value->SetAnchorHintState(EGridCellVisualState::Valid);
+			break;
+		case ArcaneCore::EPlacementResult::ReplaceExisting:
+			CellPair.Value->SetAnchorHintState(EGridCellVisualState::ReplaceExisting);
+			break;
+		default:
+			CellPair.Value->SetAnchorHintState(EGridCellVisualState::Normal);
+			break;
+		}
+	}
+}
+
+void UGS_ArcaneBoardWidget::ClearAnchorHints()
+{
+	SelectionAnchors.Reset();
+
+	for (auto& CellPair : GridCells)
+	{
+		if (IsValid(CellPair.Value))
+		{
+			CellPair.Value->SetAnchorHintState(EGridCellVisualState::Normal);
+		}
+	}
 }
 
 // 드래그 앤 드롭
+void UGS_ArcaneBoardWidget::SetupSelectionVisual()
+{
+	if (!IsValid(SelectionVisualWidget) || !IsValid(BoardManager))
+	{
+		return;
+	}
+
+	UTexture2D* RuneTexture = BoardManager->GetRuneTexture(SelectedRuneID);
+	TMap<FIntPoint, UTexture2D*> RuneShape;
+	BoardManager->GetFragmentedRuneTexture(SelectedRuneID, RuneShape, SelectedRuneOrientation);
+
+	FVector2D BoardCellSize = GetArcaneBoardCellSize();
+	float ScaleFactor = 0.6f;
+
+	SelectionVisualWidget->Setup(SelectedRuneID, RuneTexture, RuneShape, BoardCellSize, ScaleFactor, SelectedRuneOrientation);
+}
+
+void UGS_ArcaneBoardWidget::SetSelectedRuneOrientation(uint8 NewOrientation)
+{
+	if (!bIsInSelectionMode || SelectedRuneOrientation == NewOrientation)
+	{
+		return;
+	}
+
+	SelectedRuneOrientation = NewOrientation;
+
+	// 방향별 모양/텍스처는 캐시된 데이터를 그대로 사용
+	SetupSelectionVisual();
+	PositionDragVisualAtMouse();
+	RefreshAnchorHints();
+
+	if (bHasPreviewAnchor)
+	{
+		UpdateGridPreview(SelectedRuneID, PreviewAnchorPos, SelectedRuneOrientation, true);
+	}
+}
+
 void UGS_ArcaneBoardWidget::PositionDragVisualAtMouse()
 {
 	if (!IsValid(SelectionVisualWidget) || !GetWorld())
@@ -641,8 +872,11 @@ void UGS_ArcaneBoardWidget::PositionDragVisualAtMouse()
 	SelectionVisualWidget->SetPositionInViewport(AdjustedPos, false);
 }
 
-bool UGS_ArcaneBoardWidget::StartRuneReposition(uint8 RuneID)
+bool UGS_ArcaneBoardWidget::StartRuneReposition(int32 RuneID)
 {
+	FPlacedRuneInfo RuneInfo;
+	BoardManager->GetPlacedRuneInfo(RuneID, RuneInfo);
+
 	if (!BoardManager->RemoveRune(RuneID))
 	{
 		return false;
@@ -655,7 +889,7 @@ bool UGS_ArcaneBoardWidget::StartRuneReposition(uint8 RuneID)
 		RuneInven->UpdatePlacedStateOfRune(RuneID, false);
 	}
 
-	StartRuneSelection(RuneID);
+	StartRuneSelection(RuneID, RuneInfo.Orientation);
 	return true;
 }
 
@@ -683,7 +917,7 @@ UGS_RuneGridCellWidget* UGS_ArcaneBoardWidget::GetCellAtPos(const FVector2D& Scr
 }
 
 // 툴팁
-void UGS_ArcaneBoardWidget::ShowTooltip(uint8 RuneID, const FVector2D& MousePos)
+void UGS_ArcaneBoardWidget::ShowTooltip(int32 RuneID, const FVector2D& MousePos)
 {
 	if (!ShouldShowTooltip() || !IsValid(BoardManager) || !IsValid(TooltipWidgetClass))
 	{
@@ -695,26 +929,68 @@ void UGS_ArcaneBoardWidget::ShowTooltip(uint8 RuneID, const FVector2D& MousePos)
 		return;
 	}
 
-	FRuneTableRow RuneData;
-	if (!BoardManager->GetRuneData(RuneID, RuneData))
+	const FRuneTableRow* RuneData = BoardManager->FindRuneRow(RuneID);
+	if (!RuneData)
 	{
 		return;
 	}
 
 	HideTooltip();
 
-	RuneTooltipWidget = CreateWidget<UGS_RuneTooltipWidget>(this, TooltipWidgetClass);
+	RuneTooltipWidget = AcquireTooltipWidget();
 	if (RuneTooltipWidget)
 	{
 		CurrTooltipRuneID = RuneID;
-		RuneTooltipWidget->SetRuneData(RuneData);
+		RuneTooltipWidget->SetRuneData(*RuneData);
 
 		RuneTooltipWidget->SetPositionInViewport(MousePos, false);
 		RuneTooltipWidget->SetVisibility(ESlateVisibility::HitTestInvisible);
-		RuneTooltipWidget->AddToViewport(5);
 	}
 }
 
+UGS_RuneTooltipWidget* UGS_ArcaneBoardWidget::AcquireTooltipWidget()
+{
+	if (!IsValid(CachedTooltipWidget) && IsValid(TooltipWidgetClass))
+	{
+		CachedTooltipWidget = CreateWidget<UGS_RuneTooltipWidget>(this, TooltipWidgetClass);
+		if (CachedTooltipWidget)
+		{
+			CachedTooltipWidget->SetVisibility(ESlateVisibility::Collapsed);
+			CachedTooltipWidget->AddToViewport(5);
+		}
+	}
+	return CachedTooltipWidget;
+}
+
+UGS_DragVisualWidget* UGS_ArcaneBoardWidget::AcquireSelectionVisual()
+{
+	if (!IsValid(CachedSelectionVisualWidget) && IsValid(DragVisualWidgetClass))
+	{
+		CachedSelectionVisualWidget = CreateWidget<UGS_DragVisualWidget>(this, DragVisualWidgetClass);
+		if (CachedSelectionVisualWidget)
+		{
+			CachedSelectionVisualWidget->SetVisibility(ESlateVisibility::Collapsed);
+			CachedSelectionVisualWidget->AddToViewport(3);
+		}
+	}
+	return CachedSelectionVisualWidget;
+}
+
+void UGS_ArcaneBoardWidget::ReleaseSelectionVisual()
+{
+	if (IsValid(SelectionVisualWidget))
+	{
+		SelectionVisualWidget->SetVisibility(ESlateVisibility::Collapsed);
+	}
+	SelectionVisualWidget = nullptr;
+}
+
+void UGS_ArcaneBoardWidget::PrewarmPopupWidgets()
+{
+	AcquireTooltipWidget();
+	AcquireSelectionVisual();
+}
+
 void UGS_ArcaneBoardWidget::CancelTooltipRequest()
 {
 	if (GetWorld())
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
 #include "RuneSystem/GS_ArcaneBoardTypes.h"
+#include "ArcaneBoardState.h"
 #include "GS_ArcaneBoardWidget.generated.h"
 
 class UUniformGridPanel;
@@ -17,6 +18,7 @@ class UGS_RuneTooltipWidget;
 class UGS_ArcaneBoardManager;
 class UGS_ArcaneBoardLPS;
 class UGS_CommonTwoBtnPopup;
+class UGS_GridLayoutDataAsset;
 
 /**
  * 아케인 보드 메인 위젯
@@ -34,27 +36,51 @@ public:
 
 	virtual FReply NativeOnMouseMove(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
 	virtual FReply NativeOnMouseButtonDown(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
+	virtual FReply NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
+	virtual FReply NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
 	void RefreshForCurrCharacter();
 
+	// 룬 데이터가 바뀐 뒤 다시 표시, 선택 중이던 룬은 취소
+	void RefreshForRuneDataChange(bool bRemapped);
+
+	// 툴팁/드래그 비주얼을 미리 만들어 숨겨 둠, 이후 열고 닫을 때 재사용
+	void PrewarmPopupWidgets();
+
+	// 미리 만들기용: 켜 두고 뷰포트에 추가하면 NativeConstruct에서 세이브 로드/그리드/인벤토리를 만들지 않음
+	// (LPS가 PrewarmBoardChunk로 프레임을 나눠 만든 뒤 RefreshForCurrCharacter로 마무리)
+	void SetDeferBoardBuild(bool bDefer) { bDeferBoardBuild = bDefer; }
+
+	// 셀 위젯과 인벤토리 항목을 시간 예산 안에서 이어서 만듦, 모두 만들었으면 true
+	bool PrewarmBoardChunk(double EndTime);
+
 	UFUNCTION()
 	void OnStatsChanged(const FArcaneBoardStats& NewStats);
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
-	void StartRuneSelection(uint8 RuneID);
+	void StartRuneSelection(int32 RuneID, uint8 Orientation = 0);
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
 	void EndRuneSelection(bool bPlaceRune = false);
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
-	void RequestShowTooltip(uint8 RuneID, const FVector2D& MousePos);
+	void RequestShowTooltip(int32 RuneID, const FVector2D& MousePos);
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
 	void HideTooltip();
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
-	uint8 GetSelectedRuneID() const;
+	int32 GetSelectedRuneID() const;
+
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
+	uint8 GetSelectedRuneOrientation() const;
+
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
+	void RotateSelectedRune(int32 Steps = 1);
+
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
+	void MirrorSelectedRune();
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
 	bool HasUnsavedChanges() const;
@@ -96,6 +122,12 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ArcaneBoard")
 	TSubclassOf<UGS_CommonTwoBtnPopup> PresetSaveConfirmPopupClass;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ArcaneBoard|Input")
+	FKey RotateRuneKey;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ArcaneBoard|Input")
+	FKey MirrorRuneKey;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sound")
 	USoundBase* RunePickupSound;
 
@@ -111,6 +143,13 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sound")
 	USoundBase* RuneConnectionBonusSound;
 
+	// 미리보기 앵커 셀이나 방향이 바뀔 때마다 호출 (스탯 변화량/연결 변화 표시용)
+	UFUNCTION(BlueprintImplementableEvent, Category = "ArcaneBoard|Preview")
+	void OnPlacementPreviewChanged(const FArcaneBoardPreview& Preview);
+
+	UFUNCTION(BlueprintImplementableEvent, Category = "ArcaneBoard|Preview")
+	void OnPlacementPreviewCleared();
+
 private:
 	// 핵심 참조
 	UPROPERTY()
@@ -123,25 +162,49 @@ private:
 	UPROPERTY()
 	TMap<FIntPoint, UGS_RuneGridCellWidget*> GridCells;
 
+	TWeakObjectPtr<UGS_GridLayoutDataAsset> GeneratedGridLayout;
+	// GeneratedGridLayout에서 다음에 만들 셀 (나눠 만드는 중이면 GridCells는 일부만 있음)
+	int32 NextGridCellIndex;
+	bool bDeferBoardBuild;
+
 	TArray<FIntPoint> PreviewCells;
+	FIntPoint PreviewAnchorPos;
+	bool bHasPreviewAnchor;
+	FArcaneBoardPreview PlacementPreview;
+
+	// 들고 있는 룬/방향의 앵커별 배치 결과
+	ArcaneCore::FPlacementAnchorMap SelectionAnchors;
 
 	// 선택 상태
-	uint8 SelectedRuneID;
+	int32 SelectedRuneID;
+	uint8 SelectedRuneOrientation;
 	bool bIsInSelectionMode;
 
+	// 드래그 중일 때만 설정, 위젯 자체는 CachedSelectionVisualWidget으로 유지
 	UPROPERTY()
 	UGS_DragVisualWidget* SelectionVisualWidget;
 
+	UPROPERTY()
+	UGS_DragVisualWidget* CachedSelectionVisualWidget;
+
 	UPROPERTY()
 	UGS_RuneGridCellWidget* LastClickedCell;
 
 	// 툴팁 시스템
+	// 표시 중일 때만 설정
 	UPROPERTY()
 	UGS_RuneTooltipWidget* RuneTooltipWidget;
 
-	uint8 CurrTooltipRuneID;
+	UPROPERTY()
+	UGS_RuneTooltipWidget* CachedTooltipWidget;
+
+	int32 CurrTooltipRuneID;
 	FTimerHandle TooltipDelayTimer;
 
+	// 스탯 패널 갱신 (한 프레임의 변경을 모아 한 번만 전달, 바뀐 칸만 패널이 다시 씀)
+	FArcaneBoardStats PendingPanelStats;
+	FTimerHandle StatPanelUpdateTimer;
+
 	// 프리셋 저장 확인 시스템
 	int32 PendingPresetIndex;
 
@@ -164,23 +227,35 @@ private:
 	UFUNCTION()
 	void OnPresetButton3Clicked();
 
+	void FlushStatPanel();
+
 	// 시스템 초기화
 	void BindToLPS();
 	void UnbindFromLPS();
 
 	// 그리드 관리
 	void GenerateGridLayout();
+	bool GenerateGridLayoutChunk(double EndTime);
 	void UpdateGridVisuals();
-	void UpdateGridPreview(uint8 RuneID, const FIntPoint& ReferenceCellPos);
+	// 앵커 셀이 그대로면 무시, 방향이 바뀐 경우 bForceRefresh로 다시 계산
+	void UpdateGridPreview(int32 RuneID, const FIntPoint& ReferenceCellPos, uint8 Orientation, bool bForceRefresh = false);
 	void ClearPreview();
+	void ClearPreviewCells();
+	void RefreshAnchorHints();
+	void ClearAnchorHints();
 
 	// 드래그 앤 드롭
+	void SetupSelectionVisual();
+	void SetSelectedRuneOrientation(uint8 NewOrientation);
 	void PositionDragVisualAtMouse();
-	bool StartRuneReposition(uint8 RuneID);
+	UGS_DragVisualWidget* AcquireSelectionVisual();
+	void ReleaseSelectionVisual();
+	bool StartRuneReposition(int32 RuneID);
 	UGS_RuneGridCellWidget* GetCellAtPos(const FVector2D& ScreenPos);
 
 	// 툴팁
-	void ShowTooltip(uint8 RuneID, const FVector2D& MousePos);
+	void ShowTooltip(int32 RuneID, const FVector2D& MousePos);
+	UGS_RuneTooltipWidget* AcquireTooltipWidget();
 	void CancelTooltipRequest();
 	bool ShouldShowTooltip() const;
 	bool IsMouseOverTooltipWidget(const FVector2D& ScreenPos);
@@ -0,0 +1,255 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RuneSystem/GS_RuneDataCatalog.h"
+#include "RuneSystem/GS_ArcaneBoardCoreAdapter.h"
+#include "RuneSystem/GS_ArcaneBoardProfiling.h"
+#include "Engine/DataTable.h"
+#include "Engine/Texture2D.h"
+
+namespace
+{
+	using FRuneDataCatalogKey = TPair<const UDataTable*, const UDataTable*>;
+
+	// 살아 있는 테이블 조합별 공유 데이터, 테이블은 공유 데이터를 든 매니저가 유지하므로 주소 재사용 없음
+	TMap<FRuneDataCatalogKey, TWeakPtr<const FGS_RuneDataCatalog>>& GetSharedCatalogs()
+	{
+		static TMap<FRuneDataCatalogKey, TWeakPtr<const FGS_RuneDataCatalog>> SharedCatalogs;
+		return SharedCatalogs;
+	}
+}
+
+FGS_RuneDataCatalog::~FGS_RuneDataCatalog()
+{
+#if WITH_EDITOR
+	if (UDataTable* RuneTable = const_cast<UDataTable*>(RuneTablePtr.Get()))
+	{
+		RuneTable->OnDataTableChanged().RemoveAll(this);
+	}
+	if (UDataTable* SynergyTable = const_cast<UDataTable*>(SynergyTablePtr.Get()))
+	{
+		SynergyTable->OnDataTableChanged().RemoveAll(this);
+	}
+#endif
+
+	DEC_MEMORY_STAT_BY(STAT_ArcaneBoard_RuneDataCacheMemory, ReportedCacheMemory);
+	DEC_MEMORY_STAT_BY(STAT_ArcaneBoard_RuneTextureMemory, ReportedTextureMemory);
+}
+
+TSharedRef<const FGS_RuneDataCatalog> FGS_RuneDataCatalog::GetShared(const UDataTable* RuneTable, const UDataTable* SynergyTable)
+{
+	check(IsInGameThread());
+
+	TMap<FRuneDataCatalogKey, TWeakPtr<const FGS_RuneDataCatalog>>& SharedCatalogs = GetSharedCatalogs();
+	const FRuneDataCatalogKey Key(RuneTable, SynergyTable);
+	if (const TWeakPtr<const FGS_RuneDataCatalog>* Existing = SharedCatalogs.Find(Key))
+	{
+		if (TSharedPtr<const FGS_RuneDataCatalog> Pinned = Existing->Pin())
+		{
+			return Pinned.ToSharedRef();
+		}
+	}
+
+	// 해제된 항목 정리
+	for (auto It = SharedCatalogs.CreateIterator(); It; ++It)
+	{
+		if (!It->Value.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TSharedRef<FGS_RuneDataCatalog> NewCatalog = MakeShareable(new FGS_RuneDataCatalog());
+	NewCatalog->Build(RuneTable, SynergyTable);
+	SharedCatalogs.Add(Key, NewCatalog);
+	return NewCatalog;
+}
+
+namespace
+{
+	void GetRuneRows(const UDataTable* RuneTable, TArray<FRuneTableRow*>& OutRows, std::vector<int32>& OutExternalIDs)
+	{
+		OutRows.Reset();
+		OutExternalIDs.clear();
+		if (!IsValid(RuneTable))
+		{
+			return;
+		}
+
+		RuneTable->GetAllRows<FRuneTableRow>(TEXT("FGS_RuneDataCatalog"), OutRows);
+		OutExternalIDs.reserve(OutRows.Num());
+		for (const FRuneTableRow* Row : OutRows)
+		{
+			if (Row)
+			{
+				OutExternalIDs.push_back(Row->RuneID);
+			}
+		}
+	}
+}
+
+void FGS_RuneDataCatalog::Build(const UDataTable* RuneTable, const UDataTable* SynergyTable)
+{
+	RuneTablePtr = RuneTable;
+	SynergyTablePtr = SynergyTable;
+
+	// 외부 ID를 정렬해 내부 인덱스 부여, 이후 캐시는 모두 내부 인덱스 배열
+	TArray<FRuneTableRow*> RuneRows;
+	std::vector<int32> ExternalIDs;
+	GetRuneRows(RuneTable, RuneRows, ExternalIDs);
+	Remap.Build(MoveTemp(ExternalIDs));
+	BuildAllRunes(RuneRows);
+
+	ArcaneBoardAdapter::BuildSynergyRules(SynergyTable, Catalog, Remap, SynergyRules);
+	UpdateMemoryStats();
+
+#if WITH_EDITOR
+	if (UDataTable* MutableRuneTable = const_cast<UDataTable*>(RuneTable))
+	{
+		MutableRuneTable->OnDataTableChanged().AddRaw(this, &FGS_RuneDataCatalog::HandleRuneTableChanged);
+	}
+	if (UDataTable* MutableSynergyTable = const_cast<UDataTable*>(SynergyTable))
+	{
+		MutableSynergyTable->OnDataTableChanged().AddRaw(this, &FGS_RuneDataCatalog::HandleSynergyTableChanged);
+	}
+#endif
+}
+
+void FGS_RuneDataCatalog::BuildAllRunes(const TArray<FRuneTableRow*>& RuneRows)
+{
+	if (Remap.GetNumDropped() > 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("FGS_RuneDataCatalog: 룬 테이블이 최대 %d종을 넘어 %d종을 버림"),
+			ArcaneCore::MaxRuneCount - 1, Remap.GetNumDropped());
+	}
+
+	Catalog.Clear();
+	Rows.Init(nullptr, Remap.Num() + 1);
+	Textures.Reset();
+	Textures.SetNum(Remap.Num() + 1);
+
+	for (const FRuneTableRow* Row : RuneRows)
+	{
+		const ArcaneCore::RuneId InternalID = Row ? Remap.ToInternal(Row->RuneID) : 0;
+		if (InternalID == 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("FGS_RuneDataCatalog: 사용할 수 없는 룬 ID (%d), 최대 %d종"),
+				Row ? Row->RuneID : 0, ArcaneCore::MaxRuneCount - 1);
+			continue;
+		}
+
+		Rows[InternalID] = Row;
+		Catalog.AddRune(ArcaneBoardAdapter::BuildRuneDef(*Row, InternalID, Textures[InternalID]));
+	}
+}
+
+#if WITH_EDITOR
+void FGS_RuneDataCatalog::HandleRuneTableChanged()
+{
+	TArray<FRuneTableRow*> RuneRows;
+	std::vector<int32> ExternalIDs;
+	GetRuneRows(RuneTablePtr.Get(), RuneRows, ExternalIDs);
+
+	FGS_RuneDataChange Change;
+	Change.OldRemap = Remap;
+
+	ArcaneCore::FRuneIdRemap NewRemap;
+	NewRemap.Build(MoveTemp(ExternalIDs));
+	Change.bRemapped = NewRemap.Num() != Remap.Num();
+	for (int32 i = 1; !Change.bRemapped && i <= Remap.Num(); ++i)
+	{
+		Change.bRemapped = NewRemap.ToExternal(static_cast<ArcaneCore::RuneId>(i)) != Remap.ToExternal(static_cast<ArcaneCore::RuneId>(i));
+	}
+
+	if (Change.bRemapped)
+	{
+		Remap = MoveTemp(NewRemap);
+		BuildAllRunes(RuneRows);
+		Change.bRebuildAll = true;
+	}
+	else
+	{
+		// 행 포인터는 재임포트로 바뀔 수 있으므로 모두 다시 받고, 스탯/모양이 바뀐 룬만 다시 등록
+		for (const FRuneTableRow* Row : RuneRows)
+		{
+			const ArcaneCore::RuneId InternalID = Row ? Remap.ToInternal(Row->RuneID) : 0;
+			if (InternalID == 0)
+			{
+				continue;
+			}
+
+			Rows[InternalID] = Row;
+			const ArcaneCore::FRuneDef RuneDef = ArcaneBoardAdapter::BuildRuneDef(*Row, InternalID, Textures[InternalID]);
+			if (!Catalog.Matches(RuneDef))
+			{
+				Catalog.AddRune(RuneDef);
+				Change.ChangedRunes.Add(InternalID);
+			}
+		}
+	}
+
+	// 규칙은 스탯 종류/내부 인덱스를 참조하므로 다시 컴파일 (규칙 수는 시너지 테이블이 그대로면 같음)
+	ArcaneBoardAdapter::BuildSynergyRules(SynergyTablePtr.Get(), Catalog, Remap, SynergyRules);
+	UpdateMemoryStats();
+
+	UE_LOG(LogTemp, Log, TEXT("FGS_RuneDataCatalog: 룬 테이블 갱신 (%s, 바뀐 룬 %d종)"),
+		Change.bRemapped ? TEXT("전체 재구성") : TEXT("부분 갱신"), Change.bRemapped ? Remap.Num() : Change.ChangedRunes.Num());
+	RuneDataChangedDelegate.Broadcast(Change);
+}
+
+void FGS_RuneDataCatalog::HandleSynergyTableChanged()
+{
+	ArcaneBoardAdapter::BuildSynergyRules(SynergyTablePtr.Get(), Catalog, Remap, SynergyRules);
+	UpdateMemoryStats();
+
+	FGS_RuneDataChange Change;
+	Change.OldRemap = Remap;
+	Change.bRebuildAll = true;
+	RuneDataChangedDelegate.Broadcast(Change);
+}
+#endif
+
+void FGS_RuneDataCatalog::UpdateMemoryStats()
+{
+#if STATS
+	int64 CacheMemory = Rows.GetAllocatedSize() + Textures.GetAllocatedSize();
+	CacheMemory += Remap.GetAllocatedSize() + Catalog.GetAllocatedSize() + SynergyRules.GetAllocatedSize();
+
+	TSet<const UTexture2D*> RuneTextures;
+	for (const FRuneFragmentTextures& Frags : Textures)
+	{
+		CacheMemory += Frags.RuneTextureFrags.GetAllocatedSize() + Frags.ConnectedRuneTextureFrags.GetAllocatedSize();
+		for (const UTexture2D* Frag : Frags.RuneTextureFrags)
+		{
+			RuneTextures.Add(Frag);
+		}
+		for (const UTexture2D* Frag : Frags.ConnectedRuneTextureFrags)
+		{
+			RuneTextures.Add(Frag);
+		}
+	}
+	for (const FRuneTableRow* Row : Rows)
+	{
+		if (const UTexture2D* IconTexture = Row ? Row->RuneTexture.Get() : nullptr)
+		{
+			RuneTextures.Add(IconTexture);
+		}
+	}
+
+	int64 TextureMemory = 0;
+	for (const UTexture2D* Texture : RuneTextures)
+	{
+		if (Texture)
+		{
+			TextureMemory += Texture->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+		}
+	}
+
+	DEC_MEMORY_STAT_BY(STAT_ArcaneBoard_RuneDataCacheMemory, ReportedCacheMemory);
+	DEC_MEMORY_STAT_BY(STAT_ArcaneBoard_RuneTextureMemory, ReportedTextureMemory);
+	INC_MEMORY_STAT_BY(STAT_ArcaneBoard_RuneDataCacheMemory, CacheMemory);
+	INC_MEMORY_STAT_BY(STAT_ArcaneBoard_RuneTextureMemory, TextureMemory);
+
+	ReportedCacheMemory = CacheMemory;
+	ReportedTextureMemory = TextureMemory;
+#endif
+}
@@ -0,0 +1,92 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GS_ArcaneBoardTableRows.h"
+#include "GS_ArcaneBoardTypes.h"
+#include "ArcaneRuneCatalog.h"
+#include "ArcaneSynergy.h"
+
+class UDataTable;
+
+// 테이블 변경으로 공용 룬 데이터가 갱신된 내용
+struct FGS_RuneDataChange
+{
+	// 스탯/모양이 바뀐 룬 (갱신 후 내부 인덱스)
+	ArcaneCore::FRuneIdSet ChangedRunes;
+
+	// 룬이 추가/삭제되어 내부 인덱스를 다시 부여함 (보드는 OldRemap으로 외부 ID를 복원)
+	bool bRemapped = false;
+
+	// 재매핑/시너지 규칙 변경으로 모든 보드를 다시 구성해야 함
+	bool bRebuildAll = false;
+
+	ArcaneCore::FRuneIdRemap OldRemap;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnRuneDataChangedDelegate, const FGS_RuneDataChange&);
+
+/**
+ * 프로세스 공용 룬 데이터 (같은 룬/시너지 테이블을 쓰는 매니저끼리 공유, 읽는 쪽에는 const)
+ * - 배치/스탯 계산에 쓰는 값은 코어 카탈로그 (내부 인덱스 조밀 배열)
+ * - 이름/설명/텍스처는 복사하지 않고 테이블 행 포인터로 참조
+ * - 행은 테이블 소유, 테이블은 공유 데이터를 들고 있는 매니저의 UPROPERTY가 유지
+ * - 마지막 참조가 사라지면 해제되고 다음 요청 때 다시 생성
+ * - 에디터에서 테이블이 바뀌면 바뀐 룬만 게임 스레드에서 갱신하고 OnRuneDataChanged로 알림
+ *   (룬이 추가/삭제된 경우만 전체 재구성)
+ */
+class GAS_API FGS_RuneDataCatalog
+{
+public:
+	~FGS_RuneDataCatalog();
+
+	// 게임 스레드 전용
+	static TSharedRef<const FGS_RuneDataCatalog> GetShared(const UDataTable* RuneTable, const UDataTable* SynergyTable);
+
+	const ArcaneCore::FRuneIdRemap& GetRemap() const { return Remap; }
+	const ArcaneCore::FRuneCatalog& GetCatalog() const { return Catalog; }
+	const ArcaneCore::FSynergyRuleSet& GetSynergyRules() const { return SynergyRules; }
+
+	// 내부 인덱스 -> 테이블 행/조각 텍스처 (없으면 nullptr)
+	const FRuneTableRow* FindRow(ArcaneCore::RuneId InternalID) const
+	{
+		return Rows.IsValidIndex(InternalID) ? Rows[InternalID] : nullptr;
+	}
+
+	const FRuneFragmentTextures* FindTextures(ArcaneCore::RuneId InternalID) const
+	{
+		return InternalID != 0 && Textures.IsValidIndex(InternalID) ? &Textures[InternalID] : nullptr;
+	}
+
+	// 보드를 들고 있는 쪽은 받은 즉시 보드를 다시 구성해야 함 (카탈로그/규칙 참조가 바뀜)
+	FOnRuneDataChangedDelegate& OnRuneDataChanged() const { return RuneDataChangedDelegate; }
+
+private:
+	FGS_RuneDataCatalog() = default;
+
+	void Build(const UDataTable* RuneTable, const UDataTable* SynergyTable);
+	void BuildAllRunes(const TArray<FRuneTableRow*>& RuneRows);
+	void UpdateMemoryStats();
+
+#if WITH_EDITOR
+	void HandleRuneTableChanged();
+	void HandleSynergyTableChanged();
+#endif
+
+	TWeakObjectPtr<const UDataTable> RuneTablePtr;
+	TWeakObjectPtr<const UDataTable> SynergyTablePtr;
+	mutable FOnRuneDataChangedDelegate RuneDataChangedDelegate;
+
+	ArcaneCore::FRuneIdRemap Remap;
+	ArcaneCore::FRuneCatalog Catalog;
+	ArcaneCore::FSynergyRuleSet SynergyRules;
+
+	// 내부 인덱스로 인덱싱 (0번은 비어 있음)
+	TArray<const FRuneTableRow*> Rows;
+	TArray<FRuneFragmentTextures> Textures;
+
+	// stat ArcaneBoard 메모리 카운터 (공유 데이터 한 벌 기준)
+	int64 ReportedCacheMemory = 0;
+	int64 ReportedTextureMemory = 0;
+};
@@ -0,0 +1,28 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "Character/Component/GS_StatRow.h"
+#include "GS_RuneStatReceiver.generated.h"
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UGS_RuneStatReceiver : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * 아케인 보드 스탯을 받는 쪽 (캐릭터 스탯 컴포넌트 또는 폰)
+ * - 서버에서 검증된 보드 스탯이 바뀌거나 새 폰이 빙의될 때 변화량만 한 번에 전달
+ * - 받은 값을 기존 룬 스탯에 더하면 됨 (룬별로 다시 적용하지 않음)
+ */
+class GAS_API IGS_RuneStatReceiver
+{
+	GENERATED_BODY()
+
+public:
+	// 룬 스탯 + 보너스 스탯 합계의 변화량
+	virtual void ApplyRuneStatDelta(const FGS_StatRow& Delta) = 0;
+};
@@ -0,0 +1,175 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RuneSystem/GS_ArcaneBoardNetTypes.h"
+
+bool FGS_CompactRunePlacement::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint32 PackedID = static_cast<uint32>(FMath::Max(RuneID, 0));
+	Ar.SerializeIntPacked(PackedID);
+
+	uint32 PackedPos = 0;
+	if (Ar.IsSaving())
+	{
+		PackedPos = PosX
+			| (static_cast<uint32>(PosY) << 8)
+			| (static_cast<uint32>(Orientation & 0x7) << 16);
+	}
+
+	Ar.SerializeBits(&PackedPos, 19);
+
+	if (Ar.IsLoading())
+	{
+		RuneID = static_cast<int32>(FMath::Min<uint32>(PackedID, MAX_int32));
+		PosX = static_cast<uint8>(PackedPos & 0xFF);
+		PosY = static_cast<uint8>((PackedPos >> 8) & 0xFF);
+		Orientation = static_cast<uint8>((PackedPos >> 16) & 0x7);
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+int32 FGS_ReplicatedArcaneBoard::SetPlacements(const std::vector<ArcaneCore::FPlacement>& Placements, const ArcaneCore::FRuneIdRemap& Remap)
+{
+	// 내부 룬 인덱스 -> 배치 인덱스
+	int16 PlacementIndex[ArcaneCore::MaxRuneCount];
+	FMemory::Memset(PlacementIndex, 0xFF, sizeof(PlacementIndex));
+	for (int32 i = 0; i < static_cast<int32>(Placements.size()); ++i)
+	{
+		if (Placements[i].Id != 0)
+		{
+			PlacementIndex[Placements[i].Id] = static_cast<int16>(i);
+		}
+	}
+
+	int32 NumChanged = 0;
+	bool bRemoved = false;
+	for (int32 ItemIndex = Items.Num() - 1; ItemIndex >= 0; --ItemIndex)
+	{
+		FGS_ReplicatedRuneItem& Item = Items[ItemIndex];
+		const ArcaneCore::RuneId InternalID = Remap.ToInternal(Item.Placement.RuneID);
+		const int16 Index = InternalID != 0 ? PlacementIndex[InternalID] : -1;
+		if (Index < 0)
+		{
+			Items.RemoveAtSwap(ItemIndex);
+			bRemoved = true;
+			++NumChanged;
+			continue;
+		}
+
+		// 처리한 룬 표시
+		PlacementIndex[InternalID] = -1;
+
+		const ArcaneCore::FPlacement& Placement = Placements[Index];
+		if (Item.Placement.PosX != Placement.Pos.X || Item.Placement.PosY != Placement.Pos.Y ||
+			Item.Placement.Orientation != Placement.Orientation)
+		{
+			Item.Placement.PosX = static_cast<uint8>(Placement.Pos.X);
+			Item.Placement.PosY = static_cast<uint8>(Placement.Pos.Y);
+			Item.Placement.Orientation = Placement.Orientation;
+			MarkItemDirty(Item);
+			++NumChanged;
+		}
+	}
+
+	for (const ArcaneCore::FPlacement& Placement : Placements)
+	{
+		if (Placement.Id == 0 || PlacementIndex[Placement.Id] < 0)
+		{
+			continue;
+		}
+
+		FGS_ReplicatedRuneItem& NewItem = Items.AddDefaulted_GetRef();
+		NewItem.Placement.RuneID = Remap.ToExternal(Placement.Id);
+		NewItem.Placement.PosX = static_cast<uint8>(Placement.Pos.X);
+		NewItem.Placement.PosY = static_cast<uint8>(Placement.Pos.Y);
+		NewItem.Placement.Orientation = Placement.Orientation;
+		MarkItemDirty(NewItem);
+		++NumChanged;
+	}
+
+	if (bRemoved)
+	{
+		MarkArrayDirty();
+	}
+	return NumChanged;
+}
+
+void FGS_ReplicatedArcaneBoard::GetPlacedRunes(TArray<FPlacedRuneInfo>& OutRunes) const
+{
+	OutRunes.Reset(Items.Num());
+	for (const FGS_ReplicatedRuneItem& Item : Items)
+	{
+		OutRunes.Emplace(Item.Placement.RuneID, FIntPoint(Item.Placement.PosX, Item.Placement.PosY), Item.Placement.Orientation);
+	}
+}
+
+namespace
+{
+	// 값 인덱스 0~4는 RuneStats, 5~9는 BonusStats (ArcaneCore::StatIndex 순서)
+	template <typename StatsType>
+	auto& GetStatField(StatsType& Stats, int32 ValueIndex)
+	{
+		auto& StatRow = ValueIndex < ArcaneCore::StatIndex::Count ? Stats.RuneStats : Stats.BonusStats;
+		switch (ValueIndex % ArcaneCore::StatIndex::Count)
+		{
+		case ArcaneCore::StatIndex::HP: return StatRow.HP;
+		case ArcaneCore::StatIndex::ATK: return StatRow.ATK;
+		case ArcaneCore::StatIndex::DEF: return StatRow.DEF;
+		case ArcaneCore::StatIndex::AGL: return StatRow.AGL;
+		default: return StatRow.ATS;
+		}
+	}
+}
+
+void FGS_QuantizedBoardStats::FromBoardStats(const FArcaneBoardStats& Stats)
+{
+	for (int32 i = 0; i < NumValues; ++i)
+	{
+		Values[i] = FMath::RoundToInt(GetStatField(Stats, i) * Scale);
+	}
+}
+
+FArcaneBoardStats FGS_QuantizedBoardStats::ToBoardStats() const
+{
+	FArcaneBoardStats Stats;
+	for (int32 i = 0; i < NumValues; ++i)
+	{
+		GetStatField(Stats, i) = Values[i] / Scale;
+	}
+	return Stats;
+}
+
+bool FGS_QuantizedBoardStats::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint32 NonZeroMask = 0;
+	if (Ar.IsSaving())
+	{
+		for (int32 i = 0; i < NumValues; ++i)
+		{
+			NonZeroMask |= (Values[i] != 0 ? 1u : 0u) << i;
+		}
+	}
+
+	Ar.SerializeBits(&NonZeroMask, NumValues);
+
+	for (int32 i = 0; i < NumValues; ++i)
+	{
+		if (!(NonZeroMask & (1u << i)))
+		{
+			Values[i] = 0;
+			continue;
+		}
+
+		// 부호는 지그재그 인코딩, 작은 값일수록 짧게
+		uint32 ZigZag = Ar.IsSaving() ? static_cast<uint32>((Values[i] << 1) ^ (Values[i] >> 31)) : 0;
+		Ar.SerializeIntPacked(ZigZag);
+		if (Ar.IsLoading())
+		{
+			Values[i] = static_cast<int32>(ZigZag >> 1) ^ -static_cast<int32>(ZigZag & 1);
+		}
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
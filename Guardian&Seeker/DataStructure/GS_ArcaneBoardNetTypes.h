@@ -0,0 +1,154 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "GS_ArcaneBoardTypes.h"
+#include "ArcaneBoardCoreTypes.h"
+#include "ArcaneRuneCatalog.h"
+#include <vector>
+#include "GS_ArcaneBoardNetTypes.generated.h"
+
+/**
+ * 네트워크용 압축 배치
+ * - 외부 룬 ID는 가변 길이 정수, 좌표 8비트 x2 + 방향 3비트 (보통 룬당 3~4바이트)
+ * - 보드 좌표는 0~255 범위라고 가정
+ */
+USTRUCT()
+struct FGS_CompactRunePlacement
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 RuneID;
+
+	UPROPERTY()
+	uint8 PosX;
+
+	UPROPERTY()
+	uint8 PosY;
+
+	UPROPERTY()
+	uint8 Orientation;
+
+	FGS_CompactRunePlacement()
+		: RuneID(0)
+		, PosX(0)
+		, PosY(0)
+		, Orientation(0)
+	{
+	}
+
+	explicit FGS_CompactRunePlacement(const FPlacedRuneInfo& RuneInfo)
+		: RuneID(RuneInfo.RuneID)
+		, PosX(static_cast<uint8>(RuneInfo.Pos.X))
+		, PosY(static_cast<uint8>(RuneInfo.Pos.Y))
+		, Orientation(RuneInfo.Orientation)
+	{
+	}
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FGS_CompactRunePlacement> : public TStructOpsTypeTraitsBase2<FGS_CompactRunePlacement>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+// 복제용 룬 배치 하나
+USTRUCT()
+struct FGS_ReplicatedRuneItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FGS_CompactRunePlacement Placement;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+	{
+		return Placement.NetSerialize(Ar, Map, bOutSuccess);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FGS_ReplicatedRuneItem> : public TStructOpsTypeTraitsBase2<FGS_ReplicatedRuneItem>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+ * 적용된 보드 복제 (델타)
+ * - 바뀐 룬만 전송, 룬 하나 배치/이동/제거에 몇 바이트
+ * - 레이아웃 고정 셀(ID 0)은 클래스만 알면 복원 가능하므로 보내지 않음
+ * - 클래스는 델타 직렬화 대상이 아니므로 소유 액터에서 따로 복제
+ */
+USTRUCT()
+struct FGS_ReplicatedArcaneBoard : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FGS_ReplicatedRuneItem> Items;
+
+	// 서버: 검증된 배치 목록과 비교해 바뀐 항목만 dirty 처리, 바뀐 항목 수 반환
+	int32 SetPlacements(const std::vector<ArcaneCore::FPlacement>& Placements, const ArcaneCore::FRuneIdRemap& Remap);
+
+	void GetPlacedRunes(TArray<FPlacedRuneInfo>& OutRunes) const;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FGS_ReplicatedRuneItem, FGS_ReplicatedArcaneBoard>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FGS_ReplicatedArcaneBoard> : public TStructOpsTypeTraitsBase2<FGS_ReplicatedArcaneBoard>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
+
+/**
+ * 양자화된 보드 스탯 (0.01 단위)
+ * - 0이 아닌 스탯만 10비트 마스크 + 가변 길이 정수로 전송
+ */
+USTRUCT()
+struct FGS_QuantizedBoardStats
+{
+	GENERATED_BODY()
+
+	static constexpr int32 NumValues = ArcaneCore::StatIndex::Count * 2;
+	static constexpr float Scale = 100.0f;
+
+	int32 Values[NumValues] = {};
+
+	void FromBoardStats(const FArcaneBoardStats& Stats);
+	FArcaneBoardStats ToBoardStats() const;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+	bool operator==(const FGS_QuantizedBoardStats& Other) const
+	{
+		return FMemory::Memcmp(Values, Other.Values, sizeof(Values)) == 0;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FGS_QuantizedBoardStats> : public TStructOpsTypeTraitsBase2<FGS_QuantizedBoardStats>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true
+	};
+};
@@ -14,8 +14,9 @@ struct FRuneTableRow : public FTableRowBase
 {
 	GENERATED_BODY()
 
+	// 외부 룬 ID (세이브/네트워크에 쓰이는 고정 ID, 1 이상)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	uint8 RuneID;
+	int32 RuneID;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	FText RuneName;
@@ -52,6 +53,43 @@ struct FRuneTableRow : public FTableRowBase
 	}
 };
 
+/**
+ * 룬 시너지 규칙
+ * - Adjacency: FirstStatName 룬과 SecondStatName 룬이 맞닿은 쌍이 RequiredCount개 이상이면 보너스
+ * - Set: RequiredRuneIDs가 모두 보드에 배치되면 보너스
+ */
+USTRUCT(BlueprintType)
+struct FRuneSynergyTableRow : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	ERuneSynergyType SynergyType;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "SynergyType == ERuneSynergyType::Adjacency"))
+	FName FirstStatName;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "SynergyType == ERuneSynergyType::Adjacency"))
+	FName SecondStatName;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "SynergyType == ERuneSynergyType::Adjacency"))
+	int32 RequiredCount;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "SynergyType == ERuneSynergyType::Set"))
+	TArray<int32> RequiredRuneIDs;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TArray<FStatEffect> BonusEffects;
+
+	FRuneSynergyTableRow()
+		: SynergyType(ERuneSynergyType::Adjacency)
+		, FirstStatName(NAME_None)
+		, SecondStatName(NAME_None)
+		, RequiredCount(1)
+	{
+	}
+};
+
 USTRUCT(BlueprintType)
 struct FGridLayoutTableRow : public FTableRowBase
 {
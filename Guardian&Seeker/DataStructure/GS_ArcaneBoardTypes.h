@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Character/Component/GS_StatRow.h"
+#include "ArcaneBoardCoreTypes.h"
 #include "GS_ArcaneBoardTypes.generated.h"
 
 UENUM(BlueprintType)
@@ -29,6 +30,27 @@ enum class EPlacementResult : uint8
 	OutOfBounds     UMETA(DisplayName = "OutOfBounds")
 };
 
+// 서버 검증 결과, 앞쪽은 ArcaneCore::EValidationResult와 같은 순서
+UENUM(BlueprintType)
+enum class EArcaneBoardValidationResult : uint8
+{
+	Accepted		UMETA(DisplayName = "Accepted"),
+	UnknownRune		UMETA(DisplayName = "UnknownRune"),
+	DuplicateRune	UMETA(DisplayName = "DuplicateRune"),
+	NotOwned		UMETA(DisplayName = "NotOwned"),
+	OutOfBounds		UMETA(DisplayName = "OutOfBounds"),
+	Overlapping		UMETA(DisplayName = "Overlapping"),
+	InvalidClass	UMETA(DisplayName = "InvalidClass"),
+	TooManyRunes	UMETA(DisplayName = "TooManyRunes")
+};
+
+UENUM(BlueprintType)
+enum class ERuneSynergyType : uint8
+{
+	Adjacency	UMETA(DisplayName = "Adjacency"),
+	Set			UMETA(DisplayName = "Set")
+};
+
 USTRUCT(BlueprintType)
 struct FStatEffect
 {
@@ -71,30 +93,94 @@ struct FArcaneBoardStats
 	}
 };
 
+// 배치 평가 결과 (보드 하나)
+struct FArcaneBoardBatchResult
+{
+	FArcaneBoardStats Stats;
+	int32 ConnectedRuneCnt = 0;
+	bool bIsValid = true;
+};
+
+/**
+ * 룬 방향(회전/반전) 유틸리티, 코어 구현을 그대로 사용
+ * - 하위 2비트: 시계방향 90도 회전 횟수, 비트 2: 좌우 반전
+ */
+namespace RuneOrientation = ArcaneCore::Orientation;
+
 USTRUCT(BlueprintType)
 struct FPlacedRuneInfo
 {
 	GENERATED_BODY()
 
+	// 외부 룬 ID (FRuneTableRow::RuneID), 기존 uint8 세이브도 그대로 로드됨
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	uint8 RuneID;
+	int32 RuneID;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	FIntPoint Pos;
 
+	// RuneOrientation 인코딩 (기존 세이브는 0으로 로드됨)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	uint8 Orientation;
+
 	FPlacedRuneInfo()
 		: RuneID(0)
 		, Pos(FIntPoint::ZeroValue)
+		, Orientation(0)
 	{
 	}
 
-	FPlacedRuneInfo(uint8 InRuneID, const FIntPoint& InPos)
+	FPlacedRuneInfo(int32 InRuneID, const FIntPoint& InPos, uint8 InOrientation = 0)
 		: RuneID(InRuneID)
 		, Pos(InPos)
+		, Orientation(InOrientation)
 	{
 	}
 };
 
+// 배치 미리보기 결과, 룬 ID는 모두 외부 ID
+USTRUCT(BlueprintType)
+struct FArcaneBoardPreview
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly)
+	bool bIsValid = false;
+
+	// 배치 후 스탯 - 현재 스탯
+	UPROPERTY(BlueprintReadOnly)
+	FArcaneBoardStats StatDelta;
+
+	UPROPERTY(BlueprintReadOnly)
+	FArcaneBoardStats ResultStats;
+
+	// 겹쳐서 빠지는 룬
+	UPROPERTY(BlueprintReadOnly)
+	TArray<int32> DisplacedRuneIDs;
+
+	// 연결 상태가 바뀌는 룬 (배치한 룬 포함)
+	UPROPERTY(BlueprintReadOnly)
+	TArray<int32> NewlyConnectedRuneIDs;
+
+	UPROPERTY(BlueprintReadOnly)
+	TArray<int32> DisconnectedRuneIDs;
+};
+
+/**
+ * 룬 조각 텍스처 (UI 전용)
+ * - 인덱스는 룬 모양 정의 순서, 코어 카탈로그의 방향별 오프셋과 같은 순서
+ */
+struct FRuneFragmentTextures
+{
+	TArray<UTexture2D*> RuneTextureFrags;
+	TArray<UTexture2D*> ConnectedRuneTextureFrags;
+};
+
+/**
+ * 셀 데이터 뷰 (레이아웃 에셋 저작 및 블루프린트용)
+ * - 런타임 보드 상태는 코어 ArcaneCore::FBoardState에 있고, 이 구조체는 필요할 때만 생성
+ * - 룬 조각 텍스처는 UGS_ArcaneBoardManager::GetCellRuneTexture로 조회
+ */
 USTRUCT(BlueprintType)
 struct FGridCellData
 {
@@ -109,26 +195,23 @@ struct FGridCellData
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	bool bIsSpecialCell;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	bool bIsConnected;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	uint8 PlacedRuneID;
+	// 특수 셀에 연결된 룬 보너스 배율
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "bIsSpecialCell", ClampMin = "0.0"))
+	float SourceWeight;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	UTexture2D* RuneTextureFrag;
+	bool bIsConnected;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	UTexture2D* ConnectedRuneTextureFrag;
+	int32 PlacedRuneID;
 
 	FGridCellData()
 		: Pos(FIntPoint::ZeroValue)
 		, State(EGridCellState::Empty)
 		, bIsSpecialCell(false)
+		, SourceWeight(1.0f)
 		, bIsConnected(false)
 		, PlacedRuneID(0)
-		, RuneTextureFrag(nullptr)
-		, ConnectedRuneTextureFrag(nullptr)
 	{
 	}
 
@@ -136,10 +219,9 @@ struct FGridCellData
 		: Pos(InPos)
 		, State(InState)
 		, bIsSpecialCell(InIsSpecialCell)
+		, SourceWeight(1.0f)
 		, bIsConnected(InIsConnected)
 		, PlacedRuneID(0)
-		, RuneTextureFrag(nullptr)
-		, ConnectedRuneTextureFrag(nullptr)
 	{
 	}
 };
@@ -0,0 +1,201 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RuneSystem/GS_GridLayoutDataAsset.h"
+#include "RuneSystem/GS_ArcaneBoardManager.h"
+#include "RuneSystem/GS_ArcaneBoardCoreAdapter.h"
+#include "Engine/DataTable.h"
+#include "UObject/ObjectSaveContext.h"
+
+UGS_GridLayoutDataAsset::UGS_GridLayoutDataAsset()
+{
+	CharacterClass = ECharacterClass::Ares;
+}
+
+void UGS_GridLayoutDataAsset::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+
+#if WITH_EDITOR
+	const UDataTable* RuneTable = LoadObject<UDataTable>(nullptr, UGS_ArcaneBoardManager::RuneDataTablePath);
+	if (!RuneTable)
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s: 룬 테이블을 찾을 수 없어 레이아웃을 굽지 않음 (%s)"), *GetPathName(), UGS_ArcaneBoardManager::RuneDataTablePath);
+		CookedLayout = FGS_CookedGridLayout();
+		return;
+	}
+
+	ArcaneCore::FRuneIdRemap Remap;
+	ArcaneCore::FRuneCatalog Catalog;
+	ArcaneBoardAdapter::BuildRuneCatalog(RuneTable, Remap, Catalog);
+
+	TArray<FString> Errors;
+	if (!CookLayout(Remap, Catalog, Errors))
+	{
+		for (const FString& Error : Errors)
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *GetPathName(), *Error);
+		}
+	}
+#endif
+}
+
+bool UGS_GridLayoutDataAsset::ShouldUseCookedLayout() const
+{
+	return FPlatformProperties::RequiresCookedData() && CookedLayout.IsValid();
+}
+
+bool UGS_GridLayoutDataAsset::InitFromCookedLayout(const ArcaneCore::FRuneIdRemap& Remap, ArcaneCore::FBoardLayout& OutLayout) const
+{
+	const FGS_CookedGridLayout& Cooked = CookedLayout;
+	if (!Cooked.IsValid() || Cooked.InitialCellIndices.Num() != Cooked.InitialCellRuneIDs.Num() ||
+		Cooked.SourceCellIndices.Num() != Cooked.SourceWeights.Num())
+	{
+		return false;
+	}
+
+	std::vector<ArcaneCore::FBoardLayout::FSourceCell> SourceCells;
+	SourceCells.reserve(Cooked.SourceCellIndices.Num());
+	for (int32 i = 0; i < Cooked.SourceCellIndices.Num(); ++i)
+	{
+		SourceCells.push_back({ Cooked.SourceCellIndices[i], Cooked.SourceWeights[i] });
+	}
+
+	std::vector<ArcaneCore::FBoardLayout::FInitialCell> InitialCells;
+	InitialCells.reserve(Cooked.InitialCellIndices.Num());
+	for (int32 i = 0; i < Cooked.InitialCellIndices.Num(); ++i)
+	{
+		InitialCells.push_back({ Cooked.InitialCellIndices[i], Remap.ToInternal(Cooked.InitialCellRuneIDs[i]) });
+	}
+
+	// 외부 ID 순서로 구운 앵커 마스크를 내부 인덱스 배치로 옮김 (룬 단위 복사)
+	const int32 RowsPerRune = ArcaneCore::Orientation::Count * Cooked.Height;
+	std::vector<uint64_t> RuneAnchorRows;
+	if (Cooked.RuneAnchorRows.Num() == Cooked.AnchorRuneIDs.Num() * RowsPerRune && Cooked.AnchorRuneIDs.Num() > 0)
+	{
+		RuneAnchorRows.assign(static_cast<size_t>(Remap.Num() + 1) * RowsPerRune, 0);
+		for (int32 i = 0; i < Cooked.AnchorRuneIDs.Num(); ++i)
+		{
+			const ArcaneCore::RuneId InternalID = Remap.ToInternal(Cooked.AnchorRuneIDs[i]);
+			if (InternalID != 0)
+			{
+				FMemory::Memcpy(&RuneAnchorRows[InternalID * RowsPerRune], &Cooked.RuneAnchorRows[i * RowsPerRune], RowsPerRune * sizeof(uint64));
+			}
+		}
+	}
+
+	ArcaneCore::FBoardLayout::FCookedData Data;
+	Data.Origin = ArcaneBoardAdapter::ToCellPos(Cooked.Origin);
+	Data.Width = Cooked.Width;
+	Data.Height = Cooked.Height;
+	Data.NumValidCells = Cooked.NumValidCells;
+	Data.CellFlags = Cooked.CellFlags.GetData();
+	Data.Neighbors = Cooked.Neighbors.Num() == Cooked.CellFlags.Num() * 4 ? Cooked.Neighbors.GetData() : nullptr;
+	Data.ValidRowMasks = Cooked.ValidRowMasks.Num() == Cooked.Height ? reinterpret_cast<const uint64_t*>(Cooked.ValidRowMasks.GetData()) : nullptr;
+	Data.InitialCells = InitialCells.data();
+	Data.NumInitialCells = static_cast<int32_t>(InitialCells.size());
+	Data.SourceCells = SourceCells.data();
+	Data.NumSourceCells = static_cast<int32_t>(SourceCells.size());
+	Data.RuneAnchorRows = RuneAnchorRows.data();
+	Data.NumRuneAnchorRows = static_cast<int32_t>(RuneAnchorRows.size());
+	return OutLayout.InitFromCooked(Data);
+}
+
+#if WITH_EDITOR
+bool UGS_GridLayoutDataAsset::CookLayout(const ArcaneCore::FRuneIdRemap& Remap, const ArcaneCore::FRuneCatalog& Catalog, TArray<FString>& OutErrors)
+{
+	OutErrors.Reset();
+
+	// 룬 테이블과 레이아웃이 맞는지 검사
+	TSet<FIntPoint> SeenPositions;
+	int32 NumSpecialCells = 0;
+	for (const FGridCellData& Cell : GridCells)
+	{
+		bool bAlreadySeen = false;
+		SeenPositions.Add(Cell.Pos, &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			OutErrors.Add(FString::Printf(TEXT("중복 셀 (%d, %d)"), Cell.Pos.X, Cell.Pos.Y));
+		}
+
+		NumSpecialCells += Cell.bIsSpecialCell ? 1 : 0;
+
+		if (Cell.State == EGridCellState::Occupied && Cell.PlacedRuneID > 0 && Remap.ToInternal(Cell.PlacedRuneID) == 0)
+		{
+			OutErrors.Add(FString::Printf(TEXT("셀 (%d, %d)의 룬 ID %d가 룬 테이블에 없음"), Cell.Pos.X, Cell.Pos.Y, Cell.PlacedRuneID));
+		}
+	}
+
+	if (NumSpecialCells < 1 || NumSpecialCells > ArcaneCore::FBoardLayout::MaxSourceCells)
+	{
+		OutErrors.Add(FString::Printf(TEXT("특수 셀은 1~%d개여야 함 (%d개)"), ArcaneCore::FBoardLayout::MaxSourceCells, NumSpecialCells));
+	}
+
+	ArcaneCore::FBoardLayout Layout;
+	ArcaneBoardAdapter::BuildLayout(GridCells, Remap, Layout);
+	if (Layout.GetNumCells() == 0)
+	{
+		OutErrors.Add(TEXT("셀이 없음"));
+	}
+
+	Layout.BakeRuneAnchorRows(Catalog);
+	const int32 RowsPerRune = ArcaneCore::Orientation::Count * Layout.GetHeight();
+	for (int32 InternalID = 1; InternalID <= Remap.Num() && !Layout.GetRuneAnchorRows().empty(); ++InternalID)
+	{
+		const uint64_t* Rows = Layout.FindRuneAnchorRows(static_cast<ArcaneCore::RuneId>(InternalID), 0);
+		if (!Rows)
+		{
+			continue;
+		}
+
+		uint64_t AnyAnchor = 0;
+		for (int32 i = 0; i < RowsPerRune; ++i)
+		{
+			AnyAnchor |= Rows[i];
+		}
+		if (AnyAnchor == 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s: 룬 %d는 이 레이아웃 어디에도 놓을 수 없음"), *GetPathName(), Remap.ToExternal(InternalID));
+		}
+	}
+
+	if (OutErrors.Num() > 0)
+	{
+		CookedLayout = FGS_CookedGridLayout();
+		return false;
+	}
+
+	FGS_CookedGridLayout Cooked;
+	Cooked.Origin = ArcaneBoardAdapter::ToIntPoint(Layout.GetOrigin());
+	Cooked.Width = Layout.GetWidth();
+	Cooked.Height = Layout.GetHeight();
+	Cooked.NumValidCells = Layout.GetNumValidCells();
+	for (const ArcaneCore::FBoardLayout::FSourceCell& Source : Layout.GetSourceCells())
+	{
+		Cooked.SourceCellIndices.Add(Source.Index);
+		Cooked.SourceWeights.Add(Source.Weight);
+	}
+	Cooked.CellFlags = TArray<uint8>(Layout.GetCellFlags().data(), Layout.GetCellFlags().size());
+	Cooked.Neighbors = TArray<int32>(Layout.GetNeighborTable().data(), Layout.GetNeighborTable().size());
+	Cooked.ValidRowMasks = TArray<uint64>(reinterpret_cast<const uint64*>(Layout.GetValidRowMasks().data()), Layout.GetValidRowMasks().size());
+
+	for (const ArcaneCore::FBoardLayout::FInitialCell& Cell : Layout.GetInitialCells())
+	{
+		Cooked.InitialCellIndices.Add(Cell.Index);
+		Cooked.InitialCellRuneIDs.Add(Remap.ToExternal(Cell.Rune));
+	}
+
+	// 64열 이하 레이아웃만 앵커 마스크가 있음, 룬 순서는 외부 ID 오름차순 (= 내부 인덱스 순)
+	for (int32 InternalID = 1; InternalID <= Remap.Num() && !Layout.GetRuneAnchorRows().empty(); ++InternalID)
+	{
+		const uint64_t* Rows = Layout.FindRuneAnchorRows(static_cast<ArcaneCore::RuneId>(InternalID), 0);
+		if (Rows)
+		{
+			Cooked.AnchorRuneIDs.Add(Remap.ToExternal(InternalID));
+			Cooked.RuneAnchorRows.Append(reinterpret_cast<const uint64*>(Rows), RowsPerRune);
+		}
+	}
+
+	CookedLayout = MoveTemp(Cooked);
+	return true;
+}
+#endif
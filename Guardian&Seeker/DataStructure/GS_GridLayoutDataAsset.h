@@ -0,0 +1,102 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GS_ArcaneBoardTypes.h"
+#include "ArcaneBoardLayout.h"
+#include "ArcaneRuneCatalog.h"
+#include "GS_GridLayoutDataAsset.generated.h"
+
+/**
+ * 구워 둔 레이아웃 테이블 (ArcaneCore::FBoardLayout::FCookedData 원본)
+ * - 룬 ID는 외부 ID, 로드할 때 내부 인덱스로 바꿈
+ */
+USTRUCT()
+struct FGS_CookedGridLayout
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FIntPoint Origin = FIntPoint::ZeroValue;
+
+	UPROPERTY()
+	int32 Width = 0;
+
+	UPROPERTY()
+	int32 Height = 0;
+
+	UPROPERTY()
+	int32 NumValidCells = 0;
+
+	UPROPERTY()
+	TArray<uint8> CellFlags;
+
+	UPROPERTY()
+	TArray<int32> Neighbors;
+
+	UPROPERTY()
+	TArray<uint64> ValidRowMasks;
+
+	// 초기 점유 셀 (셀 인덱스, 외부 룬 ID)
+	UPROPERTY()
+	TArray<int32> InitialCellIndices;
+
+	UPROPERTY()
+	TArray<int32> InitialCellRuneIDs;
+
+	// 연결 소스 (특수 셀 인덱스, 보너스 배율)
+	UPROPERTY()
+	TArray<int32> SourceCellIndices;
+
+	UPROPERTY()
+	TArray<float> SourceWeights;
+
+	// 빈 보드 기준 룬별 앵커 마스크, [(룬 순서 * 방향 수 + 방향) * Height + 행]
+	UPROPERTY()
+	TArray<int32> AnchorRuneIDs;
+
+	UPROPERTY()
+	TArray<uint64> RuneAnchorRows;
+
+	bool IsValid() const { return Width > 0 && Height > 0 && CellFlags.Num() == Width * Height; }
+};
+
+/**
+ * 클래스별 아케인 보드 레이아웃 에셋
+ * - GridCells는 저작용, 저장/쿠킹 때 바운드, 행 마스크, 이웃 테이블, 특수 셀 목록, 룬별 앵커 마스크를 구워 둠
+ * - 쿠킹된 빌드는 구운 테이블을 복사해 코어 레이아웃 생성 (셀별 계산 없음)
+ * - 에디터에서는 룬 테이블이 바뀌었을 수 있으므로 GridCells로 다시 계산
+ */
+UCLASS(BlueprintType)
+class GAS_API UGS_GridLayoutDataAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UGS_GridLayoutDataAsset();
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ArcaneBoard")
+	ECharacterClass CharacterClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ArcaneBoard")
+	TArray<FGridCellData> GridCells;
+
+	// 룬 테이블과 맞지 않으면 에러 로그 (쿠킹 실패), 구운 테이블은 비워 둠
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+
+	bool ShouldUseCookedLayout() const;
+
+	// 구운 테이블로 코어 레이아웃 초기화, 구운 데이터가 없거나 맞지 않으면 false
+	bool InitFromCookedLayout(const ArcaneCore::FRuneIdRemap& Remap, ArcaneCore::FBoardLayout& OutLayout) const;
+
+#if WITH_EDITOR
+	// 에러가 없으면 구운 테이블 갱신
+	bool CookLayout(const ArcaneCore::FRuneIdRemap& Remap, const ArcaneCore::FRuneCatalog& Catalog, TArray<FString>& OutErrors);
+#endif
+
+private:
+	UPROPERTY()
+	FGS_CookedGridLayout CookedLayout;
+};
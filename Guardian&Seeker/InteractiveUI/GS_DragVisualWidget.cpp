@@ -14,6 +14,7 @@ UGS_DragVisualWidget::UGS_DragVisualWidget(const FObjectInitializer& ObjectIniti
     ReferenceCellOffset = FVector2D::ZeroVector;
     BaseCellSize = FVector2D(64.0f, 64.0f);
     CurrentScaleFactor = 1.0f;
+    Orientation = 0;
 }
 
 void UGS_DragVisualWidget::NativeConstruct()
@@ -21,12 +22,13 @@ void UGS_DragVisualWidget::NativeConstruct()
     Super::NativeConstruct();
 }
 
-void UGS_DragVisualWidget::Setup(uint8 InRuneID, UTexture2D* InTexture, const TMap<FIntPoint, UTexture2D*>& RuneShape, const FVector2D& InBaseCellSize, float ScaleFactor)
+void UGS_DragVisualWidget::Setup(int32 InRuneID, UTexture2D* InTexture, const TMap<FIntPoint, UTexture2D*>& RuneShape, const FVector2D& InBaseCellSize, float ScaleFactor, uint8 InOrientation)
 {
     RuneID = InRuneID;
     CachedRuneShape = RuneShape;
     BaseCellSize = InBaseCellSize;
     CurrentScaleFactor = ScaleFactor;
+    Orientation = InOrientation;
 
     if (!IsValid(RuneGridPanel) || RuneShape.Num() == 0)
     {
@@ -83,9 +85,11 @@ void UGS_DragVisualWidget::CreateRuneShapeGrid(const TMap<FIntPoint, UTexture2D*
             continue;
         }
 
-        // 이미지 위젯 생성
+        // 이미지 위젯 생성 (모양은 이미 방향이 적용된 상태, 조각 텍스처만 회전/반전)
         UImage* CellImage = NewObject<UImage>(this);
         CellImage->SetBrushFromTexture(CellTexture);
+        CellImage->SetRenderTransformAngle(90.0f * RuneOrientation::GetRotation(Orientation));
+        CellImage->SetRenderScale(FVector2D(RuneOrientation::IsMirrored(Orientation) ? -1.0f : 1.0f, 1.0f));
 
         // 그리드 위치 계산 (MinPos를 원점으로 이동)
         FIntPoint GridPos = CellPos - MinPos;
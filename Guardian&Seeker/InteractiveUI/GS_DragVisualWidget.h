@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "RuneSystem/GS_ArcaneBoardTypes.h"
 #include "GS_DragVisualWidget.generated.h"
 
 class UUniformGridPanel;
@@ -24,7 +25,7 @@ public:
 	virtual void NativeConstruct() override;
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
-	void Setup(uint8 InRuneID, UTexture2D* InTexture, const TMap<FIntPoint, UTexture2D*>& RuneShape, const FVector2D& InBaseCellSize, float ScaleFactor = 1.0f);
+	void Setup(int32 InRuneID, UTexture2D* InTexture, const TMap<FIntPoint, UTexture2D*>& RuneShape, const FVector2D& InBaseCellSize, float ScaleFactor = 1.0f, uint8 InOrientation = 0);
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
 	FVector2D GetReferenceCellOffset() const;
@@ -38,9 +39,10 @@ protected:
 
 private:
 	// Setup 데이터
-	uint8 RuneID;
+	int32 RuneID;
 	FVector2D BaseCellSize;
 	float CurrentScaleFactor;
+	uint8 Orientation;
 	TMap<FIntPoint, UTexture2D*> CachedRuneShape;
 
 	// 그리드 데이터
@@ -2,7 +2,12 @@
 
 #include "UI/RuneSystem/GS_DraggableRuneWidget.h"
 #include "UI/RuneSystem/GS_ArcaneBoardWidget.h"
+#include "UI/RuneSystem/GS_RuneInventoryWidget.h"
+#include "RuneSystem/GS_ArcaneBoardManager.h"
 #include "Components/Image.h"
+#include "Components/TextBlock.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "Blueprint/WidgetLayoutLibrary.h"
 
 UGS_DraggableRuneWidget::UGS_DraggableRuneWidget(const FObjectInitializer& ObjectInitializer)
@@ -18,6 +23,43 @@ void UGS_DraggableRuneWidget::NativeConstruct()
 	Super::NativeConstruct();
 }
 
+void UGS_DraggableRuneWidget::NativeDestruct()
+{
+	CancelIconLoad();
+	Super::NativeDestruct();
+}
+
+void UGS_DraggableRuneWidget::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+	const UGS_RuneInventoryItem* Item = Cast<UGS_RuneInventoryItem>(ListItemObject);
+	if (!Item)
+	{
+		return;
+	}
+
+	RuneID = Item->RuneID;
+	ParentBoardWidget = Item->BoardWidget.Get();
+
+	// 재사용된 위젯이므로 이전 룬의 상태를 덮어씀
+	bIsPlaced = Item->bIsPlaced;
+	SetRuneVisualState(false, bIsPlaced);
+
+	if (IsValid(CountText))
+	{
+		CountText->SetText(FText::AsNumber(Item->Count));
+		CountText->SetVisibility(Item->Count > 1 ? ESlateVisibility::HitTestInvisible : ESlateVisibility::Collapsed);
+	}
+
+	const UGS_ArcaneBoardManager* BoardManager = Item->BoardManager.Get();
+	RequestRuneIcon(BoardManager ? BoardManager->GetRuneTextureAsset(RuneID) : TSoftObjectPtr<UTexture2D>());
+}
+
+void UGS_DraggableRuneWidget::NativeOnEntryReleased()
+{
+	CancelIconLoad();
+	IUserObjectListEntry::NativeOnEntryReleased();
+}
+
 FReply UGS_DraggableRuneWidget::NativeOnMouseButtonDown(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
 {
 	FReply Reply = Super::NativeOnMouseButtonDown(InGeometry, InMouseEvent);
@@ -100,14 +142,14 @@ void UGS_DraggableRuneWidget::NativeOnMouseLeave(const FPointerEvent& InMouseEve
 	}
 }
 
-void UGS_DraggableRuneWidget::InitRuneWidget(uint8 InRuneID, UTexture2D* InRuneTexture, UGS_ArcaneBoardWidget* BoardWidget)
+void UGS_DraggableRuneWidget::InitRuneWidget(int32 InRuneID, UTexture2D* InRuneTexture, UGS_ArcaneBoardWidget* BoardWidget)
 {
 	RuneID = InRuneID;
 	SetRuneTexture(InRuneTexture);
 	ParentBoardWidget = BoardWidget;
 }
 
-uint8 UGS_DraggableRuneWidget::GetRuneID() const
+int32 UGS_DraggableRuneWidget::GetRuneID() const
 {
 	return RuneID;
 }
@@ -126,6 +168,50 @@ void UGS_DraggableRuneWidget::SetRuneTexture(UTexture2D* Texture)
 	if (IsValid(RuneImage) && Texture)
 	{
 		RuneImage->SetBrushFromTexture(Texture);
+		RuneImage->SetRenderOpacity(1.0f);
+	}
+}
+
+void UGS_DraggableRuneWidget::RequestRuneIcon(const TSoftObjectPtr<UTexture2D>& Icon)
+{
+	CancelIconLoad();
+
+	if (UTexture2D* LoadedIcon = Icon.Get())
+	{
+		SetRuneTexture(LoadedIcon);
+		return;
+	}
+
+	// 로드되는 동안 이전 룬 아이콘이 보이지 않도록
+	if (IsValid(RuneImage))
+	{
+		RuneImage->SetRenderOpacity(0.0f);
+	}
+
+	if (Icon.IsNull())
+	{
+		return;
+	}
+
+	const int32 RequestedRuneID = RuneID;
+	IconLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Icon.ToSoftObjectPath(),
+		FStreamableDelegate::CreateWeakLambda(this, [this, Icon, RequestedRuneID]()
+		{
+			// 그 사이 다른 룬으로 재사용되었으면 무시
+			if (RuneID == RequestedRuneID)
+			{
+				SetRuneTexture(Icon.Get());
+			}
+			IconLoadHandle.Reset();
+		}));
+}
+
+void UGS_DraggableRuneWidget::CancelIconLoad()
+{
+	if (IconLoadHandle.IsValid())
+	{
+		IconLoadHandle->CancelHandle();
+		IconLoadHandle.Reset();
 	}
 }
 
@@ -4,16 +4,21 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Blueprint/IUserObjectListEntry.h"
 #include "GS_DraggableRuneWidget.generated.h"
 
 class UImage;
+class UTextBlock;
 class UGS_ArcaneBoardWidget;
 
+struct FStreamableHandle;
+
 /**
  * 드래그 가능한 룬 위젯
+ * - 인벤토리 타일 뷰 엔트리로 재사용, 아이콘은 보일 때 비동기 로드
  */
 UCLASS()
-class GAS_API UGS_DraggableRuneWidget : public UUserWidget
+class GAS_API UGS_DraggableRuneWidget : public UUserWidget, public IUserObjectListEntry
 {
 	GENERATED_BODY()
 
@@ -25,12 +30,13 @@ public:
 	virtual FReply NativeOnMouseButtonDown(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
 	virtual void NativeOnMouseEnter(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
 	virtual void NativeOnMouseLeave(const FPointerEvent& InMouseEvent) override;
+	virtual void NativeDestruct() override;
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
-	void InitRuneWidget(uint8 InRuneID, UTexture2D* InRuneTexture, UGS_ArcaneBoardWidget* BoardWidget = nullptr);
+	void InitRuneWidget(int32 InRuneID, UTexture2D* InRuneTexture, UGS_ArcaneBoardWidget* BoardWidget = nullptr);
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
-	uint8 GetRuneID() const;
+	int32 GetRuneID() const;
 
 	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
 	void SetPlaced(bool bPlaced);
@@ -45,13 +51,24 @@ protected:
 	UPROPERTY(BlueprintReadWrite, meta = (BindWidget))
 	UImage* SelectionIndicator;
 
+	// 2개 이상일 때만 표시
+	UPROPERTY(BlueprintReadWrite, meta = (BindWidgetOptional))
+	UTextBlock* CountText;
+
+	virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+	virtual void NativeOnEntryReleased() override;
+
 private:
-	uint8 RuneID;
+	int32 RuneID;
 	bool bIsPlaced;
 
 	UPROPERTY()
 	UGS_ArcaneBoardWidget* ParentBoardWidget;
 
+	TSharedPtr<FStreamableHandle> IconLoadHandle;
+
 	void SetRuneTexture(UTexture2D* Texture);
+	void RequestRuneIcon(const TSoftObjectPtr<UTexture2D>& Icon);
+	void CancelIconLoad();
 	void SetRuneVisualState(bool bHovered, bool bDisabled = false);
 };
\ No newline at end of file
@@ -9,7 +9,10 @@
 UGS_RuneGridCellWidget::UGS_RuneGridCellWidget(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
+	CellPos = FIntPoint::ZeroValue;
+	PlacedRuneID = 0;
 	VisualState = EGridCellVisualState::Normal;
+	AnchorHintState = EGridCellVisualState::Normal;
 	ParentBoardWidget = nullptr;
 }
 
@@ -24,7 +27,7 @@ void UGS_RuneGridCellWidget::NativeOnMouseEnter(const FGeometry& InGeometry, con
 
 	if (ParentBoardWidget)
 	{
-		if (CellData.PlacedRuneID > 0)
+		if (PlacedRuneID > 0)
 		{
 			FVector2D MousePos = InMouseEvent.GetScreenSpacePosition();
 			if (APlayerController* PC = GetOwningPlayer())
@@ -32,7 +35,7 @@ void UGS_RuneGridCellWidget::NativeOnMouseEnter(const FGeometry& InGeometry, con
 				FGeometry ScreenGeometry = UWidgetLayoutLibrary::GetPlayerScreenWidgetGeometry(PC);
 				MousePos = ScreenGeometry.AbsoluteToLocal(MousePos);
 			}
-			ParentBoardWidget->RequestShowTooltip(CellData.PlacedRuneID, MousePos);
+			ParentBoardWidget->RequestShowTooltip(PlacedRuneID, MousePos);
 		}
 		else
 		{
@@ -52,18 +55,16 @@ void UGS_RuneGridCellWidget::InitCell(const FGridCellData& InCellData, UGS_Arcan
 	}
 }
 
-void UGS_RuneGridCellWidget::SetCellData(const FGridCellData& InCellData)
+void UGS_RuneGridCellWidget::SetCellData(const FGridCellData& InCellData, UTexture2D* InRuneTexture, uint8 InOrientation)
 {
-	CellData = InCellData;
+	CellPos = InCellData.Pos;
+	PlacedRuneID = InCellData.PlacedRuneID;
 
-	// 연결 상태에 따른 텍스처 선택
-	UTexture2D* TextureToUse = CellData.bIsConnected && CellData.ConnectedRuneTextureFrag ?
-		CellData.ConnectedRuneTextureFrag : CellData.RuneTextureFrag;
-
-	SetRuneTexture(TextureToUse);
+	// 연결 상태에 따른 텍스처는 매니저가 결정해서 전달
+	SetRuneTexture(InRuneTexture, InOrientation);
 
 	// 특수 셀 배경색 설정
-	if (CellData.bIsSpecialCell && IsValid(CellBG))
+	if (InCellData.bIsSpecialCell && IsValid(CellBG))
 	{
 		CellBG->SetColorAndOpacity(FLinearColor(0.f, 0.f, 1.f, 0.5f));
 	}
@@ -71,12 +72,12 @@ void UGS_RuneGridCellWidget::SetCellData(const FGridCellData& InCellData)
 
 FIntPoint UGS_RuneGridCellWidget::GetCellPos() const
 {
-	return CellData.Pos;
+	return CellPos;
 }
 
-uint8 UGS_RuneGridCellWidget::GetPlacedRuneID() const
+int32 UGS_RuneGridCellWidget::GetPlacedRuneID() const
 {
-	return CellData.PlacedRuneID;
+	return PlacedRuneID;
 }
 
 void UGS_RuneGridCellWidget::SetPreviewVisualState(EGridCellVisualState NewState)
@@ -136,13 +137,40 @@ void UGS_RuneGridCellWidget::SetPreviewVisualState(EGridCellVisualState NewState
 	}
 }
 
-void UGS_RuneGridCellWidget::SetRuneTexture(UTexture2D* Texture)
+void UGS_RuneGridCellWidget::SetAnchorHintState(EGridCellVisualState NewState)
+{
+	if (AnchorHintState == NewState || !IsValid(AnchorHintImage))
+	{
+		return;
+	}
+
+	AnchorHintState = NewState;
+
+	switch (NewState)
+	{
+	case EGridCellVisualState::Valid:
+		AnchorHintImage->SetVisibility(ESlateVisibility::HitTestInvisible);
+		AnchorHintImage->SetColorAndOpacity(FLinearColor(0.f, 1.f, 0.f, 0.1f));
+		break;
+	case EGridCellVisualState::ReplaceExisting:
+		AnchorHintImage->SetVisibility(ESlateVisibility::HitTestInvisible);
+		AnchorHintImage->SetColorAndOpacity(FLinearColor(1.f, 0.65f, 0.f, 0.1f));
+		break;
+	default:
+		AnchorHintImage->SetVisibility(ESlateVisibility::Hidden);
+		break;
+	}
+}
+
+void UGS_RuneGridCellWidget::SetRuneTexture(UTexture2D* Texture, uint8 Orientation)
 {
 	if (IsValid(RuneImage))
 	{
 		if (Texture)
 		{
 			RuneImage->SetBrushFromTexture(Texture);
+			RuneImage->SetRenderTransformAngle(90.0f * RuneOrientation::GetRotation(Orientation));
+			RuneImage->SetRenderScale(FVector2D(RuneOrientation::IsMirrored(Orientation) ? -1.0f : 1.0f, 1.0f));
 			RuneImage->SetVisibility(ESlateVisibility::Visible);
 		}
 		else
@@ -38,17 +38,21 @@ public:
     void InitCell(const FGridCellData& InCellData, UGS_ArcaneBoardWidget* InParentBoard);
 
     UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
-    void SetCellData(const FGridCellData& InCellData);
+    void SetCellData(const FGridCellData& InCellData, UTexture2D* InRuneTexture = nullptr, uint8 InOrientation = 0);
 
     UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
     FIntPoint GetCellPos() const;
 
     UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
-    uint8 GetPlacedRuneID() const;
+    int32 GetPlacedRuneID() const;
 
     UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
     void SetPreviewVisualState(EGridCellVisualState NewState);
 
+    // 룬을 든 동안 이 셀에 놓을 수 있는지 표시 (Normal이면 숨김)
+    UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
+    void SetAnchorHintState(EGridCellVisualState NewState);
+
 protected:
     UPROPERTY(BlueprintReadWrite, meta = (BindWidget))
     UImage* RuneImage;
@@ -59,12 +63,18 @@ protected:
     UPROPERTY(BlueprintReadWrite, meta = (BindWidget))
     UImage* PreviewImage;
 
+    UPROPERTY(BlueprintReadWrite, meta = (BindWidgetOptional))
+    UImage* AnchorHintImage;
+
 private:
-    FGridCellData CellData;
+    // 셀 위젯은 위치와 배치된 룬 ID만 보관 (나머지는 보드 매니저에서 조회)
+    FIntPoint CellPos;
+    int32 PlacedRuneID;
     EGridCellVisualState VisualState;
+    EGridCellVisualState AnchorHintState;
 
     UPROPERTY()
     UGS_ArcaneBoardWidget* ParentBoardWidget;
 
-    void SetRuneTexture(UTexture2D* Texture);
+    void SetRuneTexture(UTexture2D* Texture, uint8 Orientation = 0);
 };
\ No newline at end of file
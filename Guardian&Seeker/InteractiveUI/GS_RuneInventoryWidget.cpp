@@ -0,0 +1,175 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UI/RuneSystem/GS_RuneInventoryWidget.h"
+#include "UI/RuneSystem/GS_DraggableRuneWidget.h"
+#include "RuneSystem/GS_ArcaneBoardLPS.h"
+#include "RuneSystem/GS_ArcaneBoardManager.h"
+#include "RuneSystem/GS_ArcaneBoardCoreAdapter.h"
+#include "Components/TileView.h"
+#include "Engine/LocalPlayer.h"
+
+UGS_RuneInventoryWidget::UGS_RuneInventoryWidget(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	BoardManager = nullptr;
+	ParentBoardWidget = nullptr;
+	SortMode = ERuneInventorySort::ById;
+	StatFilter = ArcaneCore::StatIndex::None;
+	bHidePlaced = false;
+	NextPrewarmItemIndex = 0;
+}
+
+void UGS_RuneInventoryWidget::InitInven(UGS_ArcaneBoardManager* InBoardManager, UGS_ArcaneBoardWidget* InBoardWidget)
+{
+	BoardManager = InBoardManager;
+	ParentBoardWidget = InBoardWidget;
+	RefreshListItems();
+}
+
+void UGS_RuneInventoryWidget::UpdatePlacedStateOfRune(int32 RuneID, bool bIsPlaced)
+{
+	if (!IsValid(BoardManager))
+	{
+		return;
+	}
+
+	const ArcaneCore::RuneId InternalID = BoardManager->ToInternalRuneID(RuneID);
+	UGS_RuneInventoryItem* Item = ItemPool.IsValidIndex(InternalID) ? ItemPool[InternalID] : nullptr;
+	if (!Item)
+	{
+		return;
+	}
+
+	Item->bIsPlaced = bIsPlaced;
+
+	if (bHidePlaced)
+	{
+		RefreshListItems();
+		return;
+	}
+
+	// 화면에 보이는 항목만 엔트리 위젯이 있음, 나머지는 보일 때 항목 데이터로 갱신
+	if (UGS_DraggableRuneWidget* EntryWidget = RuneTileView ? RuneTileView->GetEntryWidgetFromItem<UGS_DraggableRuneWidget>(Item) : nullptr)
+	{
+		EntryWidget->SetPlaced(bIsPlaced);
+	}
+}
+
+void UGS_RuneInventoryWidget::ResetItemPool()
+{
+	ItemPool.Reset();
+	ListItems.Reset();
+	NextPrewarmItemIndex = 0;
+	if (IsValid(RuneTileView))
+	{
+		RuneTileView->ClearListItems();
+	}
+}
+
+bool UGS_RuneInventoryWidget::PrewarmItemPool(double EndTime)
+{
+	const UGS_ArcaneBoardLPS* LPS = GetArcaneBoardLPS();
+	if (!LPS)
+	{
+		return true;
+	}
+
+	// 항목 내용은 RefreshListItems에서 채움, 여기서는 UObject 생성만 나눠서 함
+	const std::vector<ArcaneCore::RuneId>& View = LPS->GetRuneInventory().GetView(static_cast<ArcaneCore::EInventoryView>(SortMode));
+	const int32 NumItems = static_cast<int32>(View.size());
+	while (NextPrewarmItemIndex < NumItems)
+	{
+		GetOrCreateItem(View[NextPrewarmItemIndex++]);
+		if (FPlatformTime::Seconds() >= EndTime)
+		{
+			break;
+		}
+	}
+	return NextPrewarmItemIndex >= NumItems;
+}
+
+void UGS_RuneInventoryWidget::SetSortMode(ERuneInventorySort InSortMode)
+{
+	if (SortMode != InSortMode)
+	{
+		SortMode = InSortMode;
+		RefreshListItems();
+	}
+}
+
+void UGS_RuneInventoryWidget::SetStatFilter(FName StatName)
+{
+	const int32 NewFilter = StatName.IsNone() ? ArcaneCore::StatIndex::None : ArcaneBoardAdapter::StatIndexFromName(StatName);
+	if (StatFilter != NewFilter)
+	{
+		StatFilter = NewFilter;
+		RefreshListItems();
+	}
+}
+
+void UGS_RuneInventoryWidget::SetHidePlaced(bool bInHidePlaced)
+{
+	if (bHidePlaced != bInHidePlaced)
+	{
+		bHidePlaced = bInHidePlaced;
+		RefreshListItems();
+	}
+}
+
+UGS_ArcaneBoardLPS* UGS_RuneInventoryWidget::GetArcaneBoardLPS() const
+{
+	const ULocalPlayer* LocalPlayer = GetOwningLocalPlayer();
+	return LocalPlayer ? LocalPlayer->GetSubsystem<UGS_ArcaneBoardLPS>() : nullptr;
+}
+
+UGS_RuneInventoryItem* UGS_RuneInventoryWidget::GetOrCreateItem(uint16 InternalID)
+{
+	if (ItemPool.Num() <= InternalID)
+	{
+		ItemPool.SetNumZeroed(InternalID + 1);
+	}
+
+	if (!ItemPool[InternalID])
+	{
+		ItemPool[InternalID] = NewObject<UGS_RuneInventoryItem>(this);
+	}
+	return ItemPool[InternalID];
+}
+
+void UGS_RuneInventoryWidget::RefreshListItems()
+{
+	const UGS_ArcaneBoardLPS* LPS = GetArcaneBoardLPS();
+	if (!IsValid(RuneTileView) || !LPS || !IsValid(BoardManager))
+	{
+		return;
+	}
+
+	const ArcaneCore::FRuneInventory& Inventory = LPS->GetRuneInventory();
+	const ArcaneCore::FRuneIdSet& PlacedRunes = BoardManager->GetBoardState().GetPlacedRunes();
+
+	const std::vector<ArcaneCore::RuneId>& View = StatFilter != ArcaneCore::StatIndex::None
+		? Inventory.GetStatView(StatFilter)
+		: Inventory.GetView(static_cast<ArcaneCore::EInventoryView>(SortMode));
+
+	ListItems.Reset(static_cast<int32>(View.size()));
+	for (ArcaneCore::RuneId InternalID : View)
+	{
+		const bool bIsPlaced = PlacedRunes.Contains(InternalID);
+		if (bHidePlaced && bIsPlaced)
+		{
+			continue;
+		}
+
+		UGS_RuneInventoryItem* Item = GetOrCreateItem(InternalID);
+		Item->RuneID = BoardManager->ToExternalRuneID(InternalID);
+		Item->Count = Inventory.GetCount(InternalID);
+		Item->bIsPlaced = bIsPlaced;
+		Item->BoardManager = BoardManager;
+		Item->BoardWidget = ParentBoardWidget;
+		ListItems.Add(Item);
+	}
+
+	// 항목 데이터가 바뀌었을 수 있으므로 보이는 엔트리를 다시 바인딩 (엔트리 위젯은 풀에서 재사용)
+	RuneTileView->SetListItems(ListItems);
+	RuneTileView->RegenerateAllEntries();
+}
@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "GS_RuneInventoryWidget.generated.h"
+
+class UTileView;
+class UGS_ArcaneBoardManager;
+class UGS_ArcaneBoardWidget;
+class UGS_ArcaneBoardLPS;
+
+// ArcaneCore::EInventoryView와 같은 순서
+UENUM(BlueprintType)
+enum class ERuneInventorySort : uint8
+{
+	ById,
+	// 스탯 종류 -> 수치 내림차순
+	ByStat,
+	// 모양 칸 수 오름차순
+	ByShapeSize
+};
+
+/**
+ * 인벤토리 타일 항목 데이터
+ * - 룬별로 하나씩 만들어 재사용, 화면에 보이는 항목만 엔트리 위젯이 붙음
+ */
+UCLASS()
+class GAS_API UGS_RuneInventoryItem : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	int32 RuneID = 0;
+	int32 Count = 0;
+	bool bIsPlaced = false;
+
+	TWeakObjectPtr<UGS_ArcaneBoardManager> BoardManager;
+	TWeakObjectPtr<UGS_ArcaneBoardWidget> BoardWidget;
+};
+
+/**
+ * 룬 인벤토리 위젯
+ * - 타일 뷰로 보이는 룬만 엔트리 위젯을 만들고 스크롤 시 재사용 (엔트리 클래스는 UGS_DraggableRuneWidget)
+ * - 정렬/필터는 LPS 인벤토리의 캐시된 보기에서 항목 목록만 다시 만듦
+ */
+UCLASS()
+class GAS_API UGS_RuneInventoryWidget : public UUserWidget
+{
+	GENERATED_BODY()
+
+public:
+	UGS_RuneInventoryWidget(const FObjectInitializer& ObjectInitializer);
+
+	void InitInven(UGS_ArcaneBoardManager* InBoardManager, UGS_ArcaneBoardWidget* InBoardWidget);
+
+	void UpdatePlacedStateOfRune(int32 RuneID, bool bIsPlaced);
+
+	// 룬 내부 인덱스가 다시 부여되면 호출, 다음 갱신 때 항목을 새로 만듦
+	void ResetItemPool();
+
+	// 보드 UI를 미리 만들 때 현재 정렬 순서대로 항목을 시간 예산 안에서 이어서 만듦, 모두 만들었으면 true
+	bool PrewarmItemPool(double EndTime);
+
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Inventory")
+	void SetSortMode(ERuneInventorySort InSortMode);
+
+	// NAME_None이면 필터 해제, 필터 중에는 해당 스탯 수치 순
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Inventory")
+	void SetStatFilter(FName StatName);
+
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard|Inventory")
+	void SetHidePlaced(bool bInHidePlaced);
+
+protected:
+	UPROPERTY(BlueprintReadWrite, meta = (BindWidget))
+	UTileView* RuneTileView;
+
+private:
+	UPROPERTY()
+	UGS_ArcaneBoardManager* BoardManager;
+
+	UPROPERTY()
+	UGS_ArcaneBoardWidget* ParentBoardWidget;
+
+	// 내부 룬 인덱스로 인덱싱
+	UPROPERTY()
+	TArray<UGS_RuneInventoryItem*> ItemPool;
+
+	UPROPERTY()
+	TArray<UGS_RuneInventoryItem*> ListItems;
+
+	// PrewarmItemPool이 다음에 만들 보기 위치
+	int32 NextPrewarmItemIndex;
+
+	ERuneInventorySort SortMode;
+	int32 StatFilter;
+	bool bHidePlaced;
+
+	UGS_ArcaneBoardLPS* GetArcaneBoardLPS() const;
+	UGS_RuneInventoryItem* GetOrCreateItem(uint16 InternalID);
+	void RefreshListItems();
+};
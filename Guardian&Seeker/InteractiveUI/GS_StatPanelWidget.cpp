@@ -0,0 +1,159 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UI/RuneSystem/GS_StatPanelWidget.h"
+#include "RuneSystem/GS_ArcaneBoardManager.h"
+#include "Components/TextBlock.h"
+
+#define LOCTEXT_NAMESPACE "ArcaneBoard"
+
+namespace
+{
+	// FGS_StatRow -> ArcaneCore::StatIndex 순서 배열
+	void ToStatValues(const FGS_StatRow& StatRow, float (&OutValues)[ArcaneCore::StatIndex::Count])
+	{
+		OutValues[ArcaneCore::StatIndex::HP] = StatRow.HP;
+		OutValues[ArcaneCore::StatIndex::ATK] = StatRow.ATK;
+		OutValues[ArcaneCore::StatIndex::DEF] = StatRow.DEF;
+		OutValues[ArcaneCore::StatIndex::AGL] = StatRow.AGL;
+		OutValues[ArcaneCore::StatIndex::ATS] = StatRow.ATS;
+	}
+
+	FText FormatStatValue(float Value)
+	{
+		FNumberFormattingOptions Options;
+		Options.MaximumFractionalDigits = 1;
+		return FText::AsNumber(Value, &Options);
+	}
+
+	FText FormatBonusValue(float Value)
+	{
+		// 보너스가 없으면 칸을 비움
+		if (FMath::IsNearlyZero(Value))
+		{
+			return FText::GetEmpty();
+		}
+		return FText::Format(LOCTEXT("StatBonusFormat", "(+{0})"), FormatStatValue(Value));
+	}
+}
+
+UGS_StatPanelWidget::UGS_StatPanelWidget(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	HPValueText = nullptr;
+	ATKValueText = nullptr;
+	DEFValueText = nullptr;
+	AGLValueText = nullptr;
+	ATSValueText = nullptr;
+	HPBonusText = nullptr;
+	ATKBonusText = nullptr;
+	DEFBonusText = nullptr;
+	AGLBonusText = nullptr;
+	ATSBonusText = nullptr;
+}
+
+void UGS_StatPanelWidget::InitStatList(UGS_ArcaneBoardManager* InBoardManager)
+{
+	BoardManager = InBoardManager;
+
+	for (int32 StatIndex = 0; StatIndex < ArcaneCore::StatIndex::Count; ++StatIndex)
+	{
+		RuneFields[StatIndex].bDisplayed = false;
+		BonusFields[StatIndex].bDisplayed = false;
+	}
+}
+
+void UGS_StatPanelWidget::UpdateStats(const FArcaneBoardStats& NewStats)
+{
+	float RuneValues[ArcaneCore::StatIndex::Count];
+	float BonusValues[ArcaneCore::StatIndex::Count];
+	ToStatValues(NewStats.RuneStats, RuneValues);
+	ToStatValues(NewStats.BonusStats, BonusValues);
+
+	for (int32 StatIndex = 0; StatIndex < ArcaneCore::StatIndex::Count; ++StatIndex)
+	{
+		SetRuneStatValue(StatIndex, RuneValues[StatIndex]);
+		SetBonusStatValue(StatIndex, BonusValues[StatIndex]);
+	}
+}
+
+void UGS_StatPanelWidget::SetRuneStatValue(int32 StatIndex, float Value)
+{
+	if (StatIndex < 0 || StatIndex >= ArcaneCore::StatIndex::Count)
+	{
+		return;
+	}
+
+	FStatField& Field = RuneFields[StatIndex];
+	if (Field.bDisplayed && Field.Value == Value)
+	{
+		return;
+	}
+
+	Field.Value = Value;
+	Field.Text = FormatStatValue(Value);
+	Field.bDisplayed = true;
+	if (UTextBlock* TextBlock = GetRuneTextBlock(StatIndex))
+	{
+		TextBlock->SetText(Field.Text);
+	}
+}
+
+void UGS_StatPanelWidget::SetBonusStatValue(int32 StatIndex, float Value)
+{
+	if (StatIndex < 0 || StatIndex >= ArcaneCore::StatIndex::Count)
+	{
+		return;
+	}
+
+	FStatField& Field = BonusFields[StatIndex];
+	if (Field.bDisplayed && Field.Value == Value)
+	{
+		return;
+	}
+
+	Field.Value = Value;
+	Field.Text = FormatBonusValue(Value);
+	Field.bDisplayed = true;
+	if (UTextBlock* TextBlock = GetBonusTextBlock(StatIndex))
+	{
+		TextBlock->SetText(Field.Text);
+	}
+}
+
+const FText& UGS_StatPanelWidget::GetRuneStatText(int32 StatIndex) const
+{
+	return StatIndex >= 0 && StatIndex < ArcaneCore::StatIndex::Count ? RuneFields[StatIndex].Text : FText::GetEmpty();
+}
+
+const FText& UGS_StatPanelWidget::GetBonusStatText(int32 StatIndex) const
+{
+	return StatIndex >= 0 && StatIndex < ArcaneCore::StatIndex::Count ? BonusFields[StatIndex].Text : FText::GetEmpty();
+}
+
+UTextBlock* UGS_StatPanelWidget::GetRuneTextBlock(int32 StatIndex) const
+{
+	switch (StatIndex)
+	{
+	case ArcaneCore::StatIndex::HP:		return HPValueText;
+	case ArcaneCore::StatIndex::ATK:	return ATKValueText;
+	case ArcaneCore::StatIndex::DEF:	return DEFValueText;
+	case ArcaneCore::StatIndex::AGL:	return AGLValueText;
+	case ArcaneCore::StatIndex::ATS:	return ATSValueText;
+	default:							return nullptr;
+	}
+}
+
+UTextBlock* UGS_StatPanelWidget::GetBonusTextBlock(int32 StatIndex) const
+{
+	switch (StatIndex)
+	{
+	case ArcaneCore::StatIndex::HP:		return HPBonusText;
+	case ArcaneCore::StatIndex::ATK:	return ATKBonusText;
+	case ArcaneCore::StatIndex::DEF:	return DEFBonusText;
+	case ArcaneCore::StatIndex::AGL:	return AGLBonusText;
+	case ArcaneCore::StatIndex::ATS:	return ATSBonusText;
+	default:							return nullptr;
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
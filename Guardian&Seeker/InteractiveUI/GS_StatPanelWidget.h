@@ -0,0 +1,87 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "RuneSystem/GS_ArcaneBoardTypes.h"
+#include "GS_StatPanelWidget.generated.h"
+
+class UTextBlock;
+class UGS_ArcaneBoardManager;
+
+/**
+ * 아케인 보드 스탯 패널
+ * - 스탯마다 룬 합계/시너지 보너스 텍스트를 따로 두고 마지막으로 표시한 값과 텍스트를 캐시
+ * - 값이 바뀐 칸만 포맷하고 SetText (나머지 텍스트 블록은 무효화되지 않음)
+ */
+UCLASS()
+class GAS_API UGS_StatPanelWidget : public UUserWidget
+{
+	GENERATED_BODY()
+
+public:
+	UGS_StatPanelWidget(const FObjectInitializer& ObjectInitializer);
+
+	// 보드 화면을 다시 구성할 때 호출, 캐시를 비워 다음 UpdateStats에서 모든 칸을 채움
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
+	void InitStatList(UGS_ArcaneBoardManager* InBoardManager);
+
+	UFUNCTION(BlueprintCallable, Category = "ArcaneBoard")
+	void UpdateStats(const FArcaneBoardStats& NewStats);
+
+	// 칸 하나만 갱신 (StatIndex는 ArcaneCore::StatIndex), 표시 중인 값과 같으면 무시
+	void SetRuneStatValue(int32 StatIndex, float Value);
+	void SetBonusStatValue(int32 StatIndex, float Value);
+
+	const FText& GetRuneStatText(int32 StatIndex) const;
+	const FText& GetBonusStatText(int32 StatIndex) const;
+
+protected:
+	UPROPERTY(BlueprintReadWrite, meta = (BindWidgetOptional))
+	UTextBlock* HPValueText;
+
+	UPROPERTY(BlueprintReadWrite, meta = (BindWidgetOptional))
+	UTextBlock* ATKValueText;
+
+	UPROPERTY(BlueprintReadWrite, meta = (BindWidgetOptional))
+	UTextBlock* DEFValueText;
+
+	UPROPERTY(BlueprintReadWrite, meta = (BindWidgetOptional))
+	UTextBlock* AGLValueText;
+
+	UPROPERTY(BlueprintReadWrite, meta = (BindWidgetOptional))
+	UTextBlock* ATSValueText;
+
+	UPROPERTY(BlueprintReadWrite, meta = (BindWidgetOptional))
+	UTextBlock* HPBonusText;
+
+	UPROPERTY(BlueprintReadWrite, meta = (BindWidgetOptional))
+	UTextBlock* ATKBonusText;
+
+	UPROPERTY(BlueprintReadWrite, meta = (BindWidgetOptional))
+	UTextBlock* DEFBonusText;
+
+	UPROPERTY(BlueprintReadWrite, meta = (BindWidgetOptional))
+	UTextBlock* AGLBonusText;
+
+	UPROPERTY(BlueprintReadWrite, meta = (BindWidgetOptional))
+	UTextBlock* ATSBonusText;
+
+private:
+	// 칸별 표시 값과 포맷된 텍스트
+	struct FStatField
+	{
+		float Value = 0.0f;
+		FText Text;
+		bool bDisplayed = false;
+	};
+
+	FStatField RuneFields[ArcaneCore::StatIndex::Count];
+	FStatField BonusFields[ArcaneCore::StatIndex::Count];
+
+	TWeakObjectPtr<UGS_ArcaneBoardManager> BoardManager;
+
+	UTextBlock* GetRuneTextBlock(int32 StatIndex) const;
+	UTextBlock* GetBonusTextBlock(int32 StatIndex) const;
+};